@@ -16,10 +16,12 @@ struct CE_ECS_ComponentStaticData {
     uint16_t m_uid;
     uint16_t m_initialCapacity;
     size_t m_storageSizeOf;
+    bool m_isTrivial; // New instances are zero filled by storage instead of calling m_initFunction
     
     // Component methods
     CE_Result (*m_initFunction)(INOUT CE_ECS_Context* context, INOUT void* component);
     CE_Result (*m_cleanupFunction)(INOUT CE_ECS_Context* context, INOUT void* component);
+    CE_Result (*m_copyFunction)(INOUT CE_ECS_Context* context, INOUT void* component); // Optional, fixes up a memcpy'd instance
 };
 
 // Declare a dummy component type for components that don't require storage, to avoid null pointers and simplify logic.
@@ -32,11 +34,21 @@ typedef struct CE_NoStorageComponent {
 // Macro to help define a no storage component, adds some hidden data we'll use later
 #define CE_NS_COMPONENT_DESC(name, uid) CE_COMPONENT_DESC(name, uid, CE_NO_STORAGE_COMPONENT_STORAGE, 0, CE_NO_STORAGE_COMPONENT_GEN(name))
 
+// Macro to define a trivially initializable component, one whose default state is all zeroes.
+// Storage memsets new instances instead of calling init, so only the cleanup function needs to be written.
+#define CE_TRIVIAL_COMPONENT_DESC(name, uid, storage, initial_capacity, ...) CE_COMPONENT_DESC(name, uid, storage, initial_capacity, CE_TRIVIAL_COMPONENT_GEN(name) __VA_ARGS__)
+
+// Descriptor extra for components that can't be duplicated with a plain memcpy (owned containers, cached assets...)
+// Pass it as the last argument of the descriptor and implement the hook with CE_DEFINE_COMPONENT_COPY.
+// The hook runs on the new copy right after the memcpy and must take its own references.
+#define CE_COMPONENT_COPY_HOOK(name) CE_COMPONENT_COPY_GEN(name)
+
 //// Component macros
 
 // Component method shortcuts
 #define CE_DEFINE_COMPONENT_INIT(name) CE_Result name##_init(INOUT CE_ECS_Context* context, INOUT name##_StorageType* component)
 #define CE_DEFINE_COMPONENT_CLEANUP(name) CE_Result name##_cleanup(INOUT CE_ECS_Context* context, INOUT name##_StorageType* component)
+#define CE_DEFINE_COMPONENT_COPY(name) CE_Result name##_copy(INOUT CE_ECS_Context* context, INOUT name##_StorageType* component)
 
 // Component data shortcuts
 #define CE_COMPONENT_DATA(name) name##_StorageType
@@ -52,8 +64,10 @@ typedef storage CE_COMPONENT_DATA(name);\
 static const uint16_t CE_COMPONENT_UID(name) = c_uid;\
 CE_DEFINE_COMPONENT_INIT(name); \
 CE_DEFINE_COMPONENT_CLEANUP(name); \
+CE_DEFINE_COMPONENT_COPY(name); \
 CE_Result name##_init_wrapper(INOUT CE_ECS_Context* context, INOUT void* component);\
 CE_Result name##_cleanup_wrapper(INOUT CE_ECS_Context* context, INOUT void* component);\
+CE_Result name##_copy_wrapper(INOUT CE_ECS_Context* context, INOUT void* component);\
 _Static_assert(initial_capacity <= CE_BITSET_MAX_BITS, #name ": Component initial capacity exceeds bitset max bits, increase CE_BITSET_MAX_BITS or reduce initial capacity.");
 
 
@@ -78,8 +92,10 @@ void name##_description(OUT CE_ECS_ComponentStaticData *data) \
     data->m_uid = c_uid; \
     data->m_storageSizeOf = sizeof(storage); \
     data->m_initialCapacity = initial_capacity; \
+    data->m_isTrivial = false; \
     data->m_initFunction = name##_init_wrapper; \
     data->m_cleanupFunction = name##_cleanup_wrapper; \
+    data->m_copyFunction = NULL; \
 } \
 __VA_ARGS__\
 
@@ -11,6 +11,18 @@
 CE_Result name##_init(INOUT CE_ECS_Context* context, INOUT name##_StorageType* component) { return CE_OK; } \
 CE_Result name##_cleanup(INOUT CE_ECS_Context* context, INOUT name##_StorageType* component) { return CE_OK; }
 
+// Helper to generate the zero fill init function, storage skips it but it keeps the wrapper valid
+#define CE_TRIVIAL_COMPONENT_GEN(name) \
+CE_Result name##_init(INOUT CE_ECS_Context* context, INOUT name##_StorageType* component) { memset(component, 0, sizeof(*component)); return CE_OK; }
+
+// Helper to generate the copy hook wrapper, the hook itself is written with CE_DEFINE_COMPONENT_COPY
+#define CE_COMPONENT_COPY_GEN(name) \
+CE_Result name##_copy_wrapper(INOUT CE_ECS_Context* context, INOUT void* component) \
+{ \
+    if (!component) return CE_ERROR; \
+    return name##_copy(context, (name##_StorageType*)component); \
+}
+
 // Generate wrappers and description functions for all registered components in one TU.
 #define CE_COMPONENT_DESC(name, uid, storage, initial_capacity, ...) CE_GENERATE_COMPONENT_IMP(name, uid, storage, initial_capacity, __VA_ARGS__)
 CE_COMPONENT_DESC_CORE(CE_COMPONENT_DESC)
@@ -21,4 +33,6 @@ CE_COMPONENT_DESC_GAME(CE_COMPONENT_DESC)
 #undef CE_COMPONENT_DESC
 
 #undef CE_NO_STORAGE_COMPONENT_GEN
+#undef CE_TRIVIAL_COMPONENT_GEN
+#undef CE_COMPONENT_COPY_GEN
 
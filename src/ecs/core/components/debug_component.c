@@ -19,6 +19,7 @@ CE_DEFINE_COMPONENT_INIT(CE_CORE_DEBUG_COMPONENT)
     component->m_ticked_half = false;
     component->m_ticked_second = false;
     component->m_ticked_rel = false;
+    component->m_ticked_oneWay = false;
     component->m_tickedDebugSystem = false;
 #endif
     return CE_OK;
@@ -34,6 +35,7 @@ CE_DEFINE_GLOBAL_COMPONENT_INIT(CE_CORE_GLOBAL_DEBUG_COMPONENT)
 {
     component->m_enabled = false;
     component->m_showFPS = false;
+    component->m_showRenderStats = false;
 #ifdef CE_CORE_TEST_MODE
     component->m_testValue = 0;
     component->m_tickedGlobalSystem = false;
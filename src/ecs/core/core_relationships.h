@@ -10,5 +10,15 @@
 #define CE_RELATIONSHIP_DESC_CORE(CE_RELATIONSHIP_DESC) \
 	CE_RELATIONSHIP_DESC(CE_RELATIONSHIP_PARENT, CE_RELATIONSHIP_CHILD)\
 
+#ifdef CE_CORE_TEST_MODE
+#define CE_ONE_WAY_RELATIONSHIP_TEST_CORE(CE_ONE_WAY_RELATIONSHIP_DESC) \
+	CE_ONE_WAY_RELATIONSHIP_DESC(CE_RELATIONSHIP_TEST_TARGETS)
+#else
+#define CE_ONE_WAY_RELATIONSHIP_TEST_CORE(CE_ONE_WAY_RELATIONSHIP_DESC)
+#endif
+
+#define CE_ONE_WAY_RELATIONSHIP_DESC_CORE(CE_ONE_WAY_RELATIONSHIP_DESC) \
+	CE_ONE_WAY_RELATIONSHIP_TEST_CORE(CE_ONE_WAY_RELATIONSHIP_DESC)
+
 	
 #endif // CORGO_CORE_RELATIONSHIPS_H
@@ -21,6 +21,11 @@
     REQUIRE_COMPONENT(CE_CORE_DEBUG_COMPONENT, debugComponent)\
     REQUIRE_RELATIONSHIP(CE_RELATIONSHIP_PARENT, relatedComponent)
 
+// Test dependency with a one-way relationship
+#define CE_CORE_TEST_SYSTEM_DEPENDENCIES_ONE_WAY \
+    REQUIRE_COMPONENT(CE_CORE_DEBUG_COMPONENT, debugComponent)\
+    REQUIRE_RELATIONSHIP(CE_RELATIONSHIP_TEST_TARGETS, targetEntity)
+
 #define CE_CORE_TEST_SYSTEM_DEPENDENCIES_NO_STORAGE \
     REQUIRE_COMPONENT(CE_CORE_DEBUG_COMPONENT, debugComponent)\
     REQUIRE_COMPONENT(CE_CORE_NO_STORAGE_COMPONENT_TEST, noStorageComponent)
@@ -32,6 +37,7 @@
     CE_SYSTEM_DESC(CE_CORE_TEST_SYSTEM_HALF_DISPLAY, CE_ECS_SYSTEM_RUN_ORDER_AUTO, CE_ECS_SYSTEM_RUN_PHASE_EARLY, CE_ECS_SYSTEM_RUN_FREQUENCY_HALF_DISPLAY, CE_CORE_TEST_SYSTEM_DEPENDENCIES)\
     CE_SYSTEM_DESC(CE_CORE_TEST_SYSTEM_SECOND, CE_ECS_SYSTEM_RUN_ORDER_AUTO, CE_ECS_SYSTEM_RUN_PHASE_LATE, CE_ECS_SYSTEM_RUN_FREQUENCY_ONCE_PER_SECOND, CE_CORE_TEST_SYSTEM_DEPENDENCIES)\
     CE_SYSTEM_DESC(CE_CORE_TEST_SYSTEM_REL, CE_ECS_SYSTEM_RUN_ORDER_AUTO, CE_ECS_SYSTEM_RUN_PHASE_DEFAULT, CE_ECS_SYSTEM_RUN_FREQUENCY_DISPLAY, CE_CORE_TEST_SYSTEM_DEPENDENCIES_REL)\
+    CE_SYSTEM_DESC(CE_CORE_TEST_SYSTEM_ONE_WAY, CE_ECS_SYSTEM_RUN_ORDER_AUTO, CE_ECS_SYSTEM_RUN_PHASE_DEFAULT, CE_ECS_SYSTEM_RUN_FREQUENCY_DISPLAY, CE_CORE_TEST_SYSTEM_DEPENDENCIES_ONE_WAY)\
     CE_SYSTEM_DESC(CE_CORE_TEST_SYSTEM_SCENE_ORDER, CE_ECS_SYSTEM_RUN_ORDER_SCENETREE, CE_ECS_SYSTEM_RUN_PHASE_DEFAULT, CE_ECS_SYSTEM_RUN_FREQUENCY_DISPLAY, CE_CORE_TEST_SYSTEM_DEPENDENCIES)\
     CE_SYSTEM_DESC(CE_CORE_TEST_SYSTEM_NO_STORAGE, CE_ECS_SYSTEM_RUN_ORDER_AUTO, CE_ECS_SYSTEM_RUN_PHASE_DEFAULT, CE_ECS_SYSTEM_RUN_FREQUENCY_DISPLAY, CE_CORE_TEST_SYSTEM_DEPENDENCIES_NO_STORAGE)\
     CE_SYSTEM_DESC(CE_CORE_TEST_SYSTEM_DEBUG, CE_ECS_SYSTEM_RUN_ORDER_AUTO, CE_ECS_SYSTEM_RUN_PHASE_DEBUG, CE_ECS_SYSTEM_RUN_FREQUENCY_DISPLAY, CE_CORE_TEST_SYSTEM_DEPENDENCIES)
@@ -23,20 +23,29 @@ CE_Result CE_ECS_Init(INOUT CE_ECS_Context* context, OUT_OPT CE_ERROR_CODE *erro
             .m_uid = 0,
             .m_storageSizeOf = 0, 
             .m_initialCapacity = 0,
+            .m_isTrivial = false,
             .m_initFunction = NULL,
-            .m_cleanupFunction = NULL
+            .m_cleanupFunction = NULL,
+            .m_copyFunction = NULL
         };
     }
 
     CE_Debug("Initializing ECS context");
     // Gather component descriptions into the context
-#define CE_COMPONENT_DESC(name, uid, storage, initial_capacity, ...) name##_description(&context->m_componentDefinitions[name]);
+    // The descriptor extras are expanded here too so components can flag themselves as trivial or register a copy hook
+#define CE_NO_STORAGE_COMPONENT_GEN(name)
+#define CE_TRIVIAL_COMPONENT_GEN(name) context->m_componentDefinitions[name].m_isTrivial = true;
+#define CE_COMPONENT_COPY_GEN(name) context->m_componentDefinitions[name].m_copyFunction = name##_copy_wrapper;
+#define CE_COMPONENT_DESC(name, uid, storage, initial_capacity, ...) name##_description(&context->m_componentDefinitions[name]); __VA_ARGS__
     CE_COMPONENT_DESC_CORE(CE_COMPONENT_DESC)
     CE_COMPONENT_DESC_ENGINE(CE_COMPONENT_DESC)
     #ifndef CE_CORE_TEST_MODE
     CE_COMPONENT_DESC_GAME(CE_COMPONENT_DESC)
     #endif
 #undef CE_COMPONENT_DESC
+#undef CE_COMPONENT_COPY_GEN
+#undef CE_TRIVIAL_COMPONENT_GEN
+#undef CE_NO_STORAGE_COMPONENT_GEN
 
 #ifdef CE_DEBUG_BUILD
     #define CE_COMPONENT_DESC(name, uid, storage, initial_capacity, ...) CE_Debug("Registered component: %s (Type: %d, UID: %d, Initial Capacity: %u)", #name, name, name##_UID, initial_capacity);
@@ -206,6 +215,30 @@ CE_Result CE_ECS_Cleanup(INOUT CE_ECS_Context* context, OUT_OPT CE_ERROR_CODE* e
     return CE_OK;
 }
 
+void CE_ECS_SwapEntities(INOUT CE_ECS_Context* context, INOUT CE_ECS_Context* other)
+{
+    // Pools live on the heap, only their pointers move
+    for (int x = 0; x < CE_COMPONENT_TYPES_COUNT; x++) {
+        CE_ECS_ComponentStorage* storageEntry = context->m_storage.m_componentTypeStorage[x];
+        context->m_storage.m_componentTypeStorage[x] = other->m_storage.m_componentTypeStorage[x];
+        other->m_storage.m_componentTypeStorage[x] = storageEntry;
+    }
+
+    // The entity table is embedded in the context
+    CE_ECS_SwapMemory(&context->m_storage.m_entityStorage, &other->m_storage.m_entityStorage, sizeof(CE_ECS_EntityStorage));
+}
+
+void CE_ECS_SwapMemory(INOUT void* a, INOUT void* b, IN size_t size)
+{
+    uint8_t* bytesA = (uint8_t*)a;
+    uint8_t* bytesB = (uint8_t*)b;
+    for (size_t i = 0; i < size; i++) {
+        const uint8_t tmp = bytesA[i];
+        bytesA[i] = bytesB[i];
+        bytesB[i] = tmp;
+    }
+}
+
 CE_Result CE_ECS_RunSystemsHelper(CE_ECS_Context* context, IN float deltaTime, IN CE_ECS_SYSTEM_RUN_PHASE runPhase, IN CE_ECS_SYSTEM_RUN_FREQUENCY runFrequency, OUT_OPT CE_ERROR_CODE* errorCode)
 {
     CE_Result result = CE_ERROR;
@@ -76,6 +76,200 @@ CE_Result CE_Entity_AddComponent(INOUT CE_ECS_Context* context, IN CE_Id entity,
     return result;
 }
 
+// Shared by the bulk add functions, validates every type up front, creates the components and rolls back on failure
+static CE_Result CE_Entity_addComponentsInternal(INOUT CE_ECS_Context* context, IN CE_Id entity, INOUT CE_ECS_EntityData* entityData, IN size_t count, IN const CE_TypeId types[], IN_OPT const void* const initialData[], OUT CE_Id newIds[], OUT_OPT void* newData[], OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_Result result = CE_OK;
+    uint16_t needed[CE_COMPONENT_TYPES_COUNT] = { 0 };
+    size_t storageCount = 0;
+
+    // Count how many instances of each type are requested, the same type may appear more than once
+    for (size_t i = 0; i < count; i++) {
+        if (types[i] >= CE_COMPONENT_TYPES_COUNT) {
+            CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INVALID_COMPONENT_TYPE);
+            return CE_ERROR;
+        }
+        needed[types[i]]++;
+    }
+
+    // Validate all of them before creating anything
+    for (size_t componentType = 0; componentType < CE_COMPONENT_TYPES_COUNT; componentType++) {
+        const CE_ECS_ComponentStaticData *componentDataPtr = &context->m_componentDefinitions[componentType];
+        if (needed[componentType] == 0 || componentDataPtr->m_initialCapacity == 0) {
+            continue;
+        }
+
+        CE_ECS_ComponentStorage* componentStorage = context->m_storage.m_componentTypeStorage[componentType];
+        if (!componentStorage) {
+            CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_STORAGE_COMPONENT_NOT_INITIALIZED);
+            return CE_ERROR;
+        }
+        while (componentStorage->m_capacity - componentStorage->m_count < needed[componentType]) {
+            if (CE_ECS_MainStorage_growStorageForComponent(&context->m_storage, componentDataPtr, errorCode) != CE_OK) {
+                return CE_ERROR;
+            }
+        }
+        storageCount += needed[componentType];
+    }
+
+    // Grow the component set once instead of on every insert
+    if (!cc_reserve(&entityData->m_components, cc_size(&entityData->m_components) + storageCount)) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+
+    // Keep the old signature around so a failed init can be rolled back cleanly
+    const CE_Bitset previousComponentBitset = entityData->m_entityComponentBitset;
+    size_t created = 0;
+
+    context->m_callingContext.m_currentEntity = entity; // Set context to current entity
+    for (created = 0; created < count; created++) {
+        const CE_TypeId componentType = types[created];
+        const CE_ECS_ComponentStaticData *componentDataPtr = &context->m_componentDefinitions[componentType];
+        void *componentData = NULL;
+
+        if (componentDataPtr->m_initialCapacity == 0) {
+            newIds[created] = CE_Id_NoStorageComponentId(componentType);
+        } else {
+            const void *sourceData = initialData ? initialData[created] : NULL;
+            result = CE_ECS_ComponentStorage_createComponent(context->m_storage.m_componentTypeStorage[componentType], context, componentDataPtr, sourceData, &newIds[created], &componentData, errorCode);
+            if (result != CE_OK) {
+                break;
+            }
+            // Cannot fail, space was reserved above
+            cc_insert(&entityData->m_components, newIds[created]);
+        }
+        if (newData != NULL) {
+            newData[created] = componentData;
+        }
+        CE_Bitset_setBit(&entityData->m_entityComponentBitset, componentType);
+    }
+
+    if (result != CE_OK) {
+        for (size_t i = 0; i < created; i++) {
+            const CE_ECS_ComponentStaticData *componentDataPtr = &context->m_componentDefinitions[types[i]];
+            if (componentDataPtr->m_initialCapacity != 0) {
+                CE_ECS_MainStorage_destroyComponent(&context->m_storage, context, componentDataPtr, newIds[i], NULL);
+                cc_erase(&entityData->m_components, newIds[i]);
+            }
+        }
+        entityData->m_entityComponentBitset = previousComponentBitset;
+        context->m_callingContext.m_currentEntity = CE_INVALID_ID;
+        return CE_ERROR;
+    }
+    context->m_callingContext.m_currentEntity = CE_INVALID_ID;
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+CE_Result CE_Entity_AddComponents(INOUT CE_ECS_Context* context, IN CE_Id entity, IN const CE_Bitset* componentTypes, OUT_OPT CE_Id results[], IN size_t bufsize, OUT_OPT size_t *resultCount, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_Result result;
+    const size_t bitsPerWord = sizeof(CE_BITSET_STORAGE_TYPE) * 8;
+    CE_TypeId types[CE_COMPONENT_TYPES_COUNT];
+    CE_Id newIds[CE_COMPONENT_TYPES_COUNT];
+    size_t typeCount = 0;
+
+    CE_ECS_EntityData* entityData = NULL;
+    result = CE_ECS_MainStorage_getEntityData(&context->m_storage, entity, &entityData, errorCode);
+    if (result != CE_OK) {
+        return CE_ERROR;
+    }
+
+    // Gather the requested types a word at a time
+    for (size_t word = 0; word < CE_BITSET_ARRAY_SIZE; word++) {
+        CE_BITSET_STORAGE_TYPE bits = componentTypes->m_bits[word];
+        while (bits != 0) {
+            const size_t componentType = word * bitsPerWord + CE_ctz(bits);
+            bits &= bits - 1;
+
+            if (componentType >= CE_COMPONENT_TYPES_COUNT) {
+                CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INVALID_COMPONENT_TYPE);
+                return CE_ERROR;
+            }
+            types[typeCount++] = (CE_TypeId)componentType;
+        }
+    }
+
+    result = CE_Entity_addComponentsInternal(context, entity, entityData, typeCount, types, NULL, newIds, NULL, errorCode);
+    if (result != CE_OK) {
+        return CE_ERROR;
+    }
+
+    if (results != NULL) {
+        for (size_t i = 0; i < typeCount && i < bufsize; i++) {
+            results[i] = newIds[i];
+        }
+    }
+
+    if (resultCount != NULL) {
+        *resultCount = typeCount;
+    }
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+CE_Result CE_Entity_AddComponentsFromData(INOUT CE_ECS_Context* context, IN CE_Id entity, IN size_t count, IN const CE_TypeId types[], IN_OPT const void* const initialData[], OUT CE_Id results[], OUT_OPT void* componentData[], OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_Result result;
+
+    CE_ECS_EntityData* entityData = NULL;
+    result = CE_ECS_MainStorage_getEntityData(&context->m_storage, entity, &entityData, errorCode);
+    if (result != CE_OK) {
+        return CE_ERROR;
+    }
+
+    return CE_Entity_addComponentsInternal(context, entity, entityData, count, types, initialData, results, componentData, errorCode);
+}
+
+CE_Result CE_ECS_CopyComponentData(INOUT CE_ECS_Context* context, IN CE_TypeId componentType, OUT void* destination, IN const void* source, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    if (componentType >= CE_COMPONENT_TYPES_COUNT) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INVALID_COMPONENT_TYPE);
+        return CE_ERROR;
+    }
+
+    const CE_ECS_ComponentStaticData *componentDataPtr = &context->m_componentDefinitions[componentType];
+    memcpy(destination, source, componentDataPtr->m_storageSizeOf);
+
+    if (componentDataPtr->m_copyFunction && componentDataPtr->m_copyFunction(context, destination) != CE_OK) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_STORAGE_COMPONENT_INIT_FAILED);
+        return CE_ERROR;
+    }
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+CE_Result CE_ECS_CleanupComponentData(INOUT CE_ECS_Context* context, IN CE_TypeId componentType, INOUT void* data, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    if (componentType >= CE_COMPONENT_TYPES_COUNT) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INVALID_COMPONENT_TYPE);
+        return CE_ERROR;
+    }
+
+    const CE_ECS_ComponentStaticData *componentDataPtr = &context->m_componentDefinitions[componentType];
+    if (componentDataPtr->m_cleanupFunction(context, data) != CE_OK) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_STORAGE_COMPONENT_CLEANUP_FAILED);
+        return CE_ERROR;
+    }
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+size_t CE_ECS_GetComponentSize(INOUT CE_ECS_Context* context, IN CE_TypeId componentType)
+{
+    if (componentType >= CE_COMPONENT_TYPES_COUNT) {
+        return 0;
+    }
+    // No-storage components carry no data even though they have a dummy storage type
+    const CE_ECS_ComponentStaticData *componentDataPtr = &context->m_componentDefinitions[componentType];
+    return componentDataPtr->m_initialCapacity == 0 ? 0 : componentDataPtr->m_storageSizeOf;
+}
+
 CE_Result CE_Entity_RemoveComponent(INOUT CE_ECS_Context* context, IN CE_Id entity, IN CE_Id componentId, OUT_OPT CE_ERROR_CODE* errorCode)
 {
     CE_Result result;
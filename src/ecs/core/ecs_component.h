@@ -33,6 +33,47 @@
  */
 CE_Result CE_Entity_AddComponent(INOUT CE_ECS_Context* context, IN CE_Id entity, IN CE_TypeId componentType, OUT CE_Id* componentId, OUT_OPT void **componentData, OUT_OPT CE_ERROR_CODE* errorCode);
 
+/**
+ * @brief Add one component of each type in a mask to an entity.
+ * 
+ * Bulk version of CE_Entity_AddComponent, the entity and every requested type are validated once up front
+ * and the entity's component set is grown a single time.
+ * Trivially initializable components are zero filled without calling their init function.
+ * If any component fails to initialize, the ones already added by this call are removed again.
+ * 
+ * @param[in,out] context The ECS context.
+ * @param[in] entity The ID of the entity to add the components to.
+ * @param[in] componentTypes Bitset of CE_COMPONENT_TYPES_COUNT bits with one bit set per component type to add.
+ * @param[out] results Optional buffer to receive the new component IDs, in ascending type order.
+ * @param[in] bufsize Maximum number of component IDs to write to results.
+ * @param[out] resultCount Optional pointer to receive the number of components added.
+ * @param[out] errorCode Optional error code if addition fails.
+ * 
+ * @return CE_OK on success, CE_ERROR on failure (e.g., invalid type or a component storage is full).
+ */
+CE_Result CE_Entity_AddComponents(INOUT CE_ECS_Context* context, IN CE_Id entity, IN const CE_Bitset* componentTypes, OUT_OPT CE_Id results[], IN size_t bufsize, OUT_OPT size_t *resultCount, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Add a list of components to an entity, copying each one from existing data.
+ * 
+ * Used to stamp out copies of a template (see the engine prefabs). Each component with data is created with a memcpy
+ * of its source followed by the component's copy hook, if it has one, so the copy takes its own references.
+ * Components without source data are initialized as usual. The same type may appear several times.
+ * If any component fails, the ones already added by this call are removed again.
+ * 
+ * @param[in,out] context The ECS context.
+ * @param[in] entity The ID of the entity to add the components to.
+ * @param[in] count Number of entries in types.
+ * @param[in] types Component type of each new component.
+ * @param[in] initialData Optional array of count pointers to source data, NULL entries (or a NULL array) use the init function.
+ * @param[out] results Buffer of at least count entries to receive the new component IDs, in the order of types.
+ * @param[out] componentData Optional buffer of count entries to receive the new component data pointers.
+ * @param[out] errorCode Optional error code if addition fails.
+ * 
+ * @return CE_OK on success, CE_ERROR on failure (e.g., invalid type or a component storage is full).
+ */
+CE_Result CE_Entity_AddComponentsFromData(INOUT CE_ECS_Context* context, IN CE_Id entity, IN size_t count, IN const CE_TypeId types[], IN_OPT const void* const initialData[], OUT CE_Id results[], OUT_OPT void* componentData[], OUT_OPT CE_ERROR_CODE* errorCode);
+
 /**
  * @brief Remove a component from an entity.
  * 
@@ -133,6 +174,45 @@ CE_Result CE_Entity_GetAllComponentsIter(INOUT CE_ECS_Context* context, IN CE_Id
  */
 #define CE_Id_NoStorageComponentId(component) ((component << CE_ID_SHIFT_TYPE) | (CE_ID_COMPONENT_REFERENCE_KIND << CE_ID_SHIFT_KIND) | (CE_NO_STORAGE_COMPONENT_ID << CE_ID_SHIFT_UNIQUE))
 
+////////////////////////////////////
+/// Detached component data functions
+/// Operate on component data that lives outside of the ECS storage, like templates
+////////////////////////////////////
+
+/**
+ * @brief Get the size of the data of a component type.
+ * 
+ * @param[in,out] context The ECS context.
+ * @param[in] componentType The component type.
+ * @return Size in bytes of the component data, 0 for no-storage or invalid types.
+ */
+size_t CE_ECS_GetComponentSize(INOUT CE_ECS_Context* context, IN CE_TypeId componentType);
+
+/**
+ * @brief Copy component data into a buffer outside of the ECS storage.
+ * The copy hook of the component runs on the destination, so it owns its own references and must be
+ * released with CE_ECS_CleanupComponentData.
+ * 
+ * @param[in,out] context The ECS context.
+ * @param[in] componentType The component type of the data.
+ * @param[out] destination Buffer of at least CE_ECS_GetComponentSize bytes.
+ * @param[in] source The component data to copy.
+ * @param[out] errorCode Optional error code if the copy fails.
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+CE_Result CE_ECS_CopyComponentData(INOUT CE_ECS_Context* context, IN CE_TypeId componentType, OUT void* destination, IN const void* source, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Run the cleanup function of a component on data outside of the ECS storage.
+ * 
+ * @param[in,out] context The ECS context.
+ * @param[in] componentType The component type of the data.
+ * @param[in,out] data The component data to clean up.
+ * @param[out] errorCode Optional error code if the cleanup fails.
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+CE_Result CE_ECS_CleanupComponentData(INOUT CE_ECS_Context* context, IN CE_TypeId componentType, INOUT void* data, OUT_OPT CE_ERROR_CODE* errorCode);
+
 ////////////////////////////////////
 /// Global component access functions
 ////////////////////////////////////
@@ -13,6 +13,9 @@
 #include "engine/core/platform.h"
 
 #include "ecs_relationships.h"
+#include "ecs/relationships.h"
+
+#include <stdlib.h>
 
 CE_Result CE_ECS_CreateEntity(INOUT CE_ECS_Context* context, OUT CE_Id* outId, OUT_OPT CE_ERROR_CODE* errorCode)
 {
@@ -20,6 +23,11 @@ CE_Result CE_ECS_CreateEntity(INOUT CE_ECS_Context* context, OUT CE_Id* outId, O
     return CE_ECS_MainStorage_createEntity(&context->m_storage, outId, errorCode);
 }
 
+CE_Result CE_ECS_CreateEntities(INOUT CE_ECS_Context* context, IN size_t count, OUT CE_Id outIds[], OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    return CE_ECS_MainStorage_createEntities(&context->m_storage, count, outIds, errorCode);
+}
+
 CE_Result CE_ECS_DestroyEntity(INOUT CE_ECS_Context* context, IN CE_Id entity, OUT_OPT CE_ERROR_CODE* errorCode)
 {
     CE_Result result;
@@ -53,6 +61,10 @@ CE_Result CE_ECS_DestroyEntity(INOUT CE_ECS_Context* context, IN CE_Id entity, O
     cc_for_each(&entityData->m_relationships, relationshipIdPtr) 
     {
         const CE_Id relationshipId = *relationshipIdPtr;
+        if (CE_ECS_IsOneWayRelationship(CE_Id_getRelationshipTypeId(relationshipId))) {
+            continue; // Nothing to unlink on the target, the slot is wiped below
+        }
+
         CE_Id targetId = CE_INVALID_ID;
         result = CE_Id_make(CE_ID_ENTITY_REFERENCE_KIND, CE_Id_getRelationshipTypeId(relationshipId), CE_Id_getGeneration(relationshipId), CE_Id_getUniqueId(relationshipId), &targetId);
         if (result != CE_OK) {
@@ -77,6 +89,199 @@ CE_Result CE_ECS_DestroyEntity(INOUT CE_ECS_Context* context, IN CE_Id entity, O
     return CE_ECS_MainStorage_destroyEntity(&context->m_storage, entity, errorCode);
 }
 
+// Component to destroy during a bulk teardown, with the entity it belongs to for the cleanup context
+typedef struct CE_ECS_DoomedComponent {
+    CE_Id m_componentId;
+    CE_Id m_entity;
+} CE_ECS_DoomedComponent;
+
+// Component ids sort by type then by slot, which is the layout of the component pools
+static int CE_ECS_compareDoomedComponents(const void* a, const void* b)
+{
+    const CE_Id idA = ((const CE_ECS_DoomedComponent*)a)->m_componentId;
+    const CE_Id idB = ((const CE_ECS_DoomedComponent*)b)->m_componentId;
+    return (idA > idB) - (idA < idB);
+}
+
+// Destroy a set of entities in one pass.
+// Components are cleaned up pool by pool in slot order, and relationships are only unlinked on entities that survive.
+static CE_Result CE_ECS_destroyEntities(INOUT CE_ECS_Context* context, IN size_t count, IN const CE_Id entities[], OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_Bitset doomed;
+    CE_Bitset_init(&doomed, CE_MAX_ENTITIES);
+
+    // Validate everything before touching anything
+    size_t componentCount = 0;
+    for (size_t i = 0; i < count; i++) {
+        CE_ECS_EntityData* entityData = NULL;
+        if (CE_ECS_MainStorage_getEntityData(&context->m_storage, entities[i], &entityData, errorCode) != CE_OK) {
+            return CE_ERROR;
+        }
+        CE_Bitset_setBit(&doomed, CE_Id_getUniqueId(entities[i]));
+        componentCount += cc_size(&entityData->m_components);
+    }
+
+    cc_vec(CE_ECS_DoomedComponent) components;
+    cc_init(&components);
+    if (!cc_reserve(&components, componentCount)) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+
+    bool success = true;
+    CE_ERROR_CODE localErrorCode = CE_ERROR_CODE_NONE;
+
+    for (size_t i = 0; i < count; i++) {
+        CE_ECS_EntityData* entityData = CE_ECS_MainStorage_getEntityDataDirectly(&context->m_storage, CE_Id_getUniqueId(entities[i]));
+
+        cc_for_each(&entityData->m_components, componentIdPtr)
+        {
+            CE_ECS_DoomedComponent doomedComponent = { .m_componentId = *componentIdPtr, .m_entity = entities[i] };
+            cc_push(&components, doomedComponent); // Space was reserved above
+        }
+
+        // Only the surviving end of a relationship needs its set updated, the doomed end is wiped with its slot
+        cc_for_each(&entityData->m_relationships, relationshipIdPtr)
+        {
+            const CE_Id targetId = CE_Id_relationshipToEntityReference(*relationshipIdPtr);
+            if (CE_Bitset_isBitSet(&doomed, CE_Id_getUniqueId(targetId))) {
+                continue;
+            }
+
+            const CE_TypeId relationshipType = CE_Id_getRelationshipTypeId(*relationshipIdPtr);
+            if (CE_ECS_IsOneWayRelationship(relationshipType)) {
+                continue;
+            }
+
+            const CE_TypeId reciprocalType = (CE_TypeId)CE_RELATIONSHIPS_RECIPROCALS[relationshipType];
+            CE_Id reciprocalId = CE_INVALID_ID;
+            CE_ECS_EntityData* targetData = NULL;
+            if (CE_ECS_MainStorage_getEntityData(&context->m_storage, targetId, &targetData, &localErrorCode) != CE_OK
+                || CE_Id_make(CE_ID_ENTITY_RELATIONSHIP_KIND, reciprocalType, CE_Id_getGeneration(entities[i]), CE_Id_getUniqueId(entities[i]), &reciprocalId) != CE_OK
+                || !cc_erase(&targetData->m_relationships, reciprocalId)) {
+                CE_Error("Failed to remove relationship with ID %d with code %s", *relationshipIdPtr, CE_GetErrorMessage(localErrorCode));
+                success = false;
+                continue;
+            }
+
+            // If no more relationships of this type exist, clear the bit
+            if (CE_ECS_MainStorage_removeRelationshipTarget(&context->m_storage, CE_Id_getUniqueId(targetId), reciprocalId) == 0) {
+                CE_Bitset_clearBit(&targetData->m_entityRelationshipBitset, reciprocalType);
+            }
+        }
+    }
+
+    qsort(cc_first(&components), cc_size(&components), sizeof(CE_ECS_DoomedComponent), CE_ECS_compareDoomedComponents);
+
+    cc_for_each(&components, doomedComponent)
+    {
+        const CE_ECS_ComponentStaticData *componentDataPtr = &context->m_componentDefinitions[CE_Id_getComponentTypeId(doomedComponent->m_componentId)];
+        context->m_callingContext.m_currentEntity = doomedComponent->m_entity;
+        if (CE_ECS_MainStorage_destroyComponent(&context->m_storage, context, componentDataPtr, doomedComponent->m_componentId, &localErrorCode) != CE_OK) {
+            // Just print and error and continue, its not ideal but we want to ensure cleanup continues
+            CE_Error("Failed to destroy component with ID %d with code %s", doomedComponent->m_componentId, CE_GetErrorMessage(localErrorCode));
+            success = false;
+        }
+        context->m_callingContext.m_currentEntity = CE_INVALID_ID;
+    }
+    cc_cleanup(&components);
+
+    for (size_t i = 0; i < count; i++) {
+        if (CE_ECS_MainStorage_destroyEntity(&context->m_storage, entities[i], &localErrorCode) != CE_OK) {
+            success = false;
+        }
+    }
+
+    if (!success) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_STORAGE_COMPONENT_CLEANUP_FAILED);
+        return CE_ERROR;
+    }
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+CE_Result CE_ECS_DestroySubtree(INOUT CE_ECS_Context* context, IN CE_Id root, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_Debug("Destroying subtree of entity %u", root);
+
+    cc_vec(CE_Id) subtree;
+    cc_init(&subtree);
+    if (!cc_push(&subtree, root)) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+
+    // The list doubles as the work queue
+    for (size_t i = 0; i < cc_size(&subtree); i++) {
+        CE_ECS_EntityData* entityData = NULL;
+        if (CE_ECS_MainStorage_getEntityData(&context->m_storage, *cc_get(&subtree, i), &entityData, errorCode) != CE_OK) {
+            cc_cleanup(&subtree);
+            return CE_ERROR;
+        }
+        if (!CE_Bitset_isBitSet(&entityData->m_entityRelationshipBitset, CE_RELATIONSHIP_CHILD)) {
+            continue;
+        }
+        CE_Id_Vector *children = CE_ECS_MainStorage_getRelationshipTargetsDirectly(&context->m_storage, CE_Id_getUniqueId(*cc_get(&subtree, i)), CE_RELATIONSHIP_CHILD);
+        if (!cc_push_n(&subtree, cc_first(children), cc_size(children))) {
+            cc_cleanup(&subtree);
+            CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+            return CE_ERROR;
+        }
+    }
+
+    const CE_Result result = CE_ECS_destroyEntities(context, cc_size(&subtree), cc_first(&subtree), errorCode);
+    cc_cleanup(&subtree);
+    return result;
+}
+
+CE_Result CE_ECS_DeactivateEntity(INOUT CE_ECS_Context* context, IN CE_Id entity, OUT CE_Id* newId, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_ECS_EntityData* entityData = NULL;
+    if (CE_ECS_MainStorage_getEntityData(&context->m_storage, entity, &entityData, errorCode) != CE_OK) {
+        return CE_ERROR;
+    }
+
+    if (CE_ECS_MainStorage_deactivateEntity(&context->m_storage, entity, newId, errorCode) != CE_OK) {
+        return CE_ERROR;
+    }
+
+    // The other end of each relationship stores this entity's generation, swap it in place
+    cc_for_each(&entityData->m_relationships, relationshipIdPtr)
+    {
+        const CE_TypeId relationshipType = CE_Id_getRelationshipTypeId(*relationshipIdPtr);
+        if (CE_ECS_IsOneWayRelationship(relationshipType)) {
+            continue; // Links pointing here go stale with the old generation and are dropped lazily
+        }
+
+        const CE_TypeId reciprocalType = (CE_TypeId)CE_RELATIONSHIPS_RECIPROCALS[relationshipType];
+        CE_ECS_EntityData* targetData = NULL;
+        CE_Id oldReciprocal = CE_INVALID_ID;
+        CE_Id newReciprocal = CE_INVALID_ID;
+
+        if (CE_ECS_MainStorage_getEntityData(&context->m_storage, CE_Id_relationshipToEntityReference(*relationshipIdPtr), &targetData, errorCode) != CE_OK
+            || CE_Id_make(CE_ID_ENTITY_RELATIONSHIP_KIND, reciprocalType, CE_Id_getGeneration(entity), CE_Id_getUniqueId(entity), &oldReciprocal) != CE_OK
+            || CE_Id_make(CE_ID_ENTITY_RELATIONSHIP_KIND, reciprocalType, CE_Id_getGeneration(*newId), CE_Id_getUniqueId(*newId), &newReciprocal) != CE_OK) {
+            CE_Error("Failed to update relationship %u while deactivating entity %u", *relationshipIdPtr, entity);
+            return CE_ERROR;
+        }
+
+        // Erase then insert cannot grow the set, so this cannot fail on memory
+        if (targetData != entityData && cc_erase(&targetData->m_relationships, oldReciprocal)) {
+            cc_insert(&targetData->m_relationships, newReciprocal);
+            CE_ECS_MainStorage_replaceRelationshipTarget(&context->m_storage, CE_Id_getUniqueId(*relationshipIdPtr), oldReciprocal, newReciprocal);
+        }
+    }
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+CE_Result CE_ECS_ActivateEntity(INOUT CE_ECS_Context* context, IN CE_Id entity, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    return CE_ECS_MainStorage_activateEntity(&context->m_storage, entity, errorCode);
+}
+
 bool CE_Entity_IsValid(INOUT CE_ECS_Context* context, IN CE_Id entity)
 {
     if (entity == CE_INVALID_ID) {
@@ -90,6 +295,12 @@ bool CE_Entity_IsValid(INOUT CE_ECS_Context* context, IN CE_Id entity)
     return result == CE_OK;
 }
 
+bool CE_Entity_IsActive(INOUT CE_ECS_Context* context, IN CE_Id entity)
+{
+    return CE_Entity_IsValid(context, entity)
+        && !CE_Bitset_isBitSet(&context->m_storage.m_entityStorage.m_entityInactiveBitset, CE_Id_getUniqueId(entity));
+}
+
 size_t CE_Entity_GetComponentCount(INOUT CE_ECS_Context* context, IN CE_Id entity)
 {
     CE_Result result;
@@ -131,6 +342,7 @@ bool CE_Entity_HasRelationship(INOUT CE_ECS_Context* context, IN CE_Id entity, I
     if (entityData == NULL || result != CE_OK) {
         return 0;
     }
+    CE_ECS_MainStorage_pruneOneWayRelationshipTargets(&context->m_storage, CE_Id_getUniqueId(entity), relationshipType);
     return CE_Bitset_isBitSet(&entityData->m_entityRelationshipBitset, relationshipType);
 }
 
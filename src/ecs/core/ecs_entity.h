@@ -29,6 +29,22 @@
  */
 CE_Result CE_ECS_CreateEntity(INOUT CE_ECS_Context* context, OUT CE_Id* outId, OUT_OPT CE_ERROR_CODE* errorCode);
 
+/**
+ * @brief Create several entities in one call.
+ * 
+ * Validates the storage once and hands out free slots in index order, which is much cheaper
+ * than calling CE_ECS_CreateEntity in a loop when building a scene.
+ * Either all entities are created or none are.
+ * 
+ * @param[in,out] context The ECS context.
+ * @param[in] count Number of entities to create.
+ * @param[out] outIds Array of at least count elements to receive the new entity IDs.
+ * @param[out] errorCode Optional error code if creation fails.
+ * 
+ * @return CE_OK on success, CE_ERROR on failure (e.g., not enough free entity slots).
+ */
+CE_Result CE_ECS_CreateEntities(INOUT CE_ECS_Context* context, IN size_t count, OUT CE_Id outIds[], OUT_OPT CE_ERROR_CODE* errorCode);
+
 /**
  * @brief Destroy an entity and remove all its components.
  * 
@@ -44,6 +60,50 @@ CE_Result CE_ECS_CreateEntity(INOUT CE_ECS_Context* context, OUT CE_Id* outId, O
  */
 CE_Result CE_ECS_DestroyEntity(INOUT CE_ECS_Context* context, IN CE_Id entity, OUT_OPT CE_ERROR_CODE* errorCode);
 
+/**
+ * @brief Destroy an entity and every entity below it, following child relationships.
+ * 
+ * Much cheaper than calling CE_ECS_DestroyEntity on each entity of a hierarchy:
+ * components are cleaned up pool by pool in slot order, and relationships between two destroyed
+ * entities are dropped with their slots instead of being unlinked one side at a time.
+ * Only entities outside the subtree (e.g., the parent of the root) get their relationship sets updated.
+ * 
+ * @param[in,out] context The ECS context.
+ * @param[in] root The ID of the topmost entity to destroy.
+ * @param[out] errorCode Optional error code if destruction fails.
+ * 
+ * @return CE_OK on success, CE_ERROR on failure (e.g., an entity in the subtree is not found).
+ */
+CE_Result CE_ECS_DestroySubtree(INOUT CE_ECS_Context* context, IN CE_Id root, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Park an entity so it can be reused later without being rebuilt.
+ * 
+ * The entity keeps its slot, components and relationships but systems skip it until it is activated again.
+ * Its generation is bumped, so the ID passed in becomes stale and newId must be used from now on.
+ * Relationships on other entities that point to this one are updated to the new ID.
+ * Used by the engine entity pools.
+ * 
+ * @param[in,out] context The ECS context.
+ * @param[in] entity The ID of the entity to deactivate.
+ * @param[out] newId Receives the new ID of the entity.
+ * @param[out] errorCode Optional error code if deactivation fails.
+ * 
+ * @return CE_OK on success, CE_ERROR on failure (e.g., entity not found).
+ */
+CE_Result CE_ECS_DeactivateEntity(INOUT CE_ECS_Context* context, IN CE_Id entity, OUT CE_Id* newId, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Make a deactivated entity visible to systems again.
+ * 
+ * @param[in,out] context The ECS context.
+ * @param[in] entity The ID returned by CE_ECS_DeactivateEntity.
+ * @param[out] errorCode Optional error code if activation fails.
+ * 
+ * @return CE_OK on success, CE_ERROR on failure (e.g., entity not found).
+ */
+CE_Result CE_ECS_ActivateEntity(INOUT CE_ECS_Context* context, IN CE_Id entity, OUT_OPT CE_ERROR_CODE* errorCode);
+
 ////////////////////////////////////
 // Entity Metadata
 ////////////////////////////////////
@@ -62,6 +122,16 @@ CE_Result CE_ECS_DestroyEntity(INOUT CE_ECS_Context* context, IN CE_Id entity, O
  */
 bool CE_Entity_IsValid(INOUT CE_ECS_Context* context, IN CE_Id entity);
 
+/**
+ * @brief Check if a valid entity is active, that is, not parked by CE_ECS_DeactivateEntity.
+ * 
+ * @param[in,out] context The ECS context.
+ * @param[in] entity The entity ID to check.
+ * 
+ * @return true if the entity is valid and active, false otherwise.
+ */
+bool CE_Entity_IsActive(INOUT CE_ECS_Context* context, IN CE_Id entity);
+
 /**
  * @brief Get the number of components attached to an entity.
  * 
@@ -22,8 +22,9 @@ CE_Result CE_ECS_RunSystems_AutoOrder(INOUT CE_ECS_Context* context, IN float de
     // TODO: optimize entity order for cache access
     for (int entityIndex = 0; entityIndex < CE_MAX_ENTITIES; entityIndex++) 
     {
-        if (!CE_Bitset_isBitSet(&context->m_storage.m_entityStorage.m_entityIndexBitset, entityIndex)) {
-            continue; // Skip unused entity slots
+        if (!CE_Bitset_isBitSet(&context->m_storage.m_entityStorage.m_entityIndexBitset, entityIndex)
+            || CE_Bitset_isBitSet(&context->m_storage.m_entityStorage.m_entityInactiveBitset, entityIndex)) {
+            continue; // Skip unused and pooled entity slots
         }
 
         // Since we are doing direct iteration we don't need to do as many checks for getting entity data
@@ -53,8 +54,21 @@ CE_Result CE_ECS_RunSystemOnEntity(INOUT CE_ECS_Context* context, IN float delta
     }
 
     // Check if entity matches system requirements
-    if (!CE_Bitset_containsBits(&entityData->m_entityComponentBitset, &sysData->m_requiredComponentBitset) ||
-        !CE_Bitset_containsBits(&entityData->m_entityRelationshipBitset, &sysData->m_requiredRelationshipBitset)) {
+    if (!CE_Bitset_containsBits(&entityData->m_entityComponentBitset, &sysData->m_requiredComponentBitset)) {
+        return CE_OK; // Entity does not match requirements
+    }
+
+    // Drop dead one-way targets first, otherwise the stale bit would match and the system would fail to fetch them
+    if (sysData->m_requiresOneWayRelationship) {
+        for (CE_TypeId relationshipType = 0; relationshipType < CE_RELATIONSHIP_TYPES_COUNT; relationshipType++) {
+            if (CE_Bitset_isBitSet(&sysData->m_requiredRelationshipBitset, relationshipType)
+                && CE_Bitset_isBitSet(&entityData->m_entityRelationshipBitset, relationshipType)) {
+                CE_ECS_MainStorage_pruneOneWayRelationshipTargets(&context->m_storage, CE_Id_getUniqueId(entityData->m_entityId), relationshipType);
+            }
+        }
+    }
+
+    if (!CE_Bitset_containsBits(&entityData->m_entityRelationshipBitset, &sysData->m_requiredRelationshipBitset)) {
         return CE_OK; // Entity does not match requirements
     }
 
@@ -105,23 +119,27 @@ CE_Result CE_ECS_RunSystems_RenderOrder(INOUT CE_ECS_Context* context, IN float
         return CE_OK;
     }
 
-    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_SCENE_GRAPH_COMPONENT, sceneGraph);
+    const CE_SceneGraphRenderQueueEntry *renderQueue = NULL;
+    size_t renderQueueCount = 0;
+    CE_Engine_SceneGraph_GetRenderQueue(context, &renderQueue, &renderQueueCount);
     
-    cc_for_each(&sceneGraph->m_renderList, index, renderNodePtr)
+    for (size_t i = 0; i < renderQueueCount; i++)
     {
         CE_ECS_EntityData* entityData;
 
-        result = CE_ECS_MainStorage_getEntityDataByUniqueId(&context->m_storage, *index, &entityData, errorCode);
+        result = CE_ECS_MainStorage_getEntityDataByUniqueId(&context->m_storage, renderQueue[i].m_uniqueId, &entityData, errorCode);
         if (entityData == NULL || result != CE_OK) {
             return CE_ERROR;
         }
 
-        // Run each system in the cached list
+        // Run each system in the cached list, entities in a static layer being baked draw into its bitmap
+        CE_RenderCommands_SetTarget(context, renderQueue[i].m_target);
         cc_for_each(&systemList->m_systems, sysTypeIdPtr) 
         {
             CE_ECS_RunSystemOnEntity(context, deltaTime, *sysTypeIdPtr, entityData);
         }
     }
+    CE_RenderCommands_SetTarget(context, CE_RENDER_TARGET_SCREEN);
 
     CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
     return CE_OK;
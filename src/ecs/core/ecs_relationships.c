@@ -13,6 +13,8 @@
 #include "engine/core/platform.h"
 #include "ecs/relationships.h"
 
+#include <string.h>
+
 CE_Result CE_Entity_AddRelationship_Internal(INOUT CE_ECS_Context* context, IN CE_Id entity, IN CE_Id relationshipToAdd, OUT_OPT CE_ERROR_CODE* errorCode)
 {
     CE_ECS_EntityData* entityData = NULL;
@@ -20,12 +22,23 @@ CE_Result CE_Entity_AddRelationship_Internal(INOUT CE_ECS_Context* context, IN C
         return CE_ERROR;
     }
 
+    // Adding an existing relationship again is a no-op, the index must not get a duplicate
+    if (cc_get(&entityData->m_relationships, relationshipToAdd) != NULL) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+        return CE_OK;
+    }
+
     if (cc_insert(&entityData->m_relationships, relationshipToAdd) == NULL)
     {
         CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
         return CE_ERROR;
     };
 
+    if (CE_ECS_MainStorage_addRelationshipTarget(&context->m_storage, CE_Id_getUniqueId(entity), relationshipToAdd, errorCode) != CE_OK) {
+        cc_erase(&entityData->m_relationships, relationshipToAdd);
+        return CE_ERROR;
+    }
+
     if (CE_Bitset_setBit(&entityData->m_entityRelationshipBitset, CE_Id_getRelationshipTypeId(relationshipToAdd)) != CE_OK) {
         CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INTERNAL_ERROR);
         return CE_ERROR;
@@ -47,6 +60,13 @@ CE_Result CE_Entity_AddRelationship(INOUT CE_ECS_Context* context, IN CE_Id enti
         return CE_ERROR;
     }
 
+    // The target is never written for one-way relationships, make sure it is alive before linking to it
+    CE_ECS_EntityData* targetData = NULL;
+    if (CE_ECS_IsOneWayRelationship(relationshipType)
+        && CE_ECS_MainStorage_getEntityData(&context->m_storage, targetEntity, &targetData, errorCode) != CE_OK) {
+        return CE_ERROR;
+    }
+
     CE_Id newRel = CE_INVALID_ID;
     if (CE_Id_make(CE_ID_ENTITY_RELATIONSHIP_KIND, relationshipType, CE_Id_getGeneration(targetEntity), CE_Id_getUniqueId(targetEntity), &newRel) != CE_OK) {
         CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INTERNAL_ERROR);
@@ -57,6 +77,12 @@ CE_Result CE_Entity_AddRelationship(INOUT CE_ECS_Context* context, IN CE_Id enti
         return CE_ERROR;
     }
 
+    // One-way relationships live on the source only
+    if (CE_ECS_IsOneWayRelationship(relationshipType)) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+        return CE_OK;
+    }
+
     // Make reciprocal relationship
     if (CE_Id_make(CE_ID_ENTITY_RELATIONSHIP_KIND, CE_RELATIONSHIPS_RECIPROCALS[relationshipType], CE_Id_getGeneration(entity), CE_Id_getUniqueId(entity), &newRel) != CE_OK) {
         CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INTERNAL_ERROR);
@@ -91,16 +117,7 @@ CE_Result CE_Entity_RemoveRelationship_Internal(INOUT CE_ECS_Context* context, I
     };
 
     // If no more relationships of this type exist, clear the bit
-    bool hasMoreOfType = false;
-    cc_for_each(&entityData->m_relationships, el)
-    {
-        if (CE_Id_getRelationshipTypeId(*el) == relationshipType) {
-            hasMoreOfType = true;
-            break;
-        }
-    }
-
-    if (!hasMoreOfType) {
+    if (CE_ECS_MainStorage_removeRelationshipTarget(&context->m_storage, CE_Id_getUniqueId(entity), relationshipToRemove) == 0) {
         CE_Bitset_clearBit(&entityData->m_entityRelationshipBitset, relationshipType);
     }
 
@@ -130,6 +147,11 @@ CE_Result CE_Entity_RemoveRelationship(INOUT CE_ECS_Context* context, IN CE_Id e
         return CE_ERROR;
     }
 
+    if (CE_ECS_IsOneWayRelationship(relationshipType)) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+        return CE_OK;
+    }
+
     if (CE_Id_make(CE_ID_ENTITY_RELATIONSHIP_KIND, CE_RELATIONSHIPS_RECIPROCALS[relationshipType], CE_Id_getGeneration(entity), CE_Id_getUniqueId(entity), &newRel) != CE_OK) {
         CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INTERNAL_ERROR);
         return CE_ERROR;
@@ -160,19 +182,15 @@ CE_Result CE_Entity_FindFirstRelationship(INOUT CE_ECS_Context* context, IN CE_I
         return CE_ERROR;
     }
 
+    CE_ECS_MainStorage_pruneOneWayRelationshipTargets(&context->m_storage, CE_Id_getUniqueId(entity), relationshipType);
+
     // First check that the entity actually has this relationship
     if (!CE_Bitset_isBitSet(&entityData->m_entityRelationshipBitset, relationshipType)) {
         CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENTITY_DOES_NOT_HAVE_RELATIONSHIP);
         return CE_ERROR;
     }
 
-    cc_for_each(&entityData->m_relationships, el) 
-    {
-        if (CE_Id_getRelationshipTypeId(*el) == relationshipType) {
-            *relationshipEntityId = CE_Id_relationshipToEntityReference(*el);
-            break;
-        }
-    }
+    *relationshipEntityId = *cc_first(CE_ECS_MainStorage_getRelationshipTargetsDirectly(&context->m_storage, CE_Id_getUniqueId(entity), relationshipType));
 
     CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
     return CE_OK;
@@ -195,25 +213,19 @@ CE_Result CE_Entity_FindAllRelationships(INOUT CE_ECS_Context* context, IN CE_Id
         return CE_ERROR;
     }
 
+    CE_ECS_MainStorage_pruneOneWayRelationshipTargets(&context->m_storage, CE_Id_getUniqueId(entity), relationshipType);
+
     // First check that the entity actually has this relationship
     if (!CE_Bitset_isBitSet(&entityData->m_entityRelationshipBitset, relationshipType)) {
         CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENTITY_DOES_NOT_HAVE_RELATIONSHIP);
         return CE_ERROR;
     }
 
-    int index = 0;
-
-    cc_for_each(&entityData->m_relationships, el) 
-    {
-        if (CE_Id_getRelationshipTypeId(*el) == relationshipType) {
-            results[index++] = CE_Id_relationshipToEntityReference(*el);
-            if (index >= bufsize) {
-                break;
-            }
-        }
-    }
+    CE_Id_Vector *targets = CE_ECS_MainStorage_getRelationshipTargetsDirectly(&context->m_storage, CE_Id_getUniqueId(entity), relationshipType);
+    const size_t count = cc_size(targets) < bufsize ? cc_size(targets) : bufsize;
+    memcpy(results, cc_first(targets), count * sizeof(CE_Id));
 
-    *resultCount = index;
+    *resultCount = count;
 
     CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
     return CE_OK;
@@ -244,14 +256,16 @@ CE_Result CE_Entity_HasSpecificRelationship(INOUT CE_ECS_Context* context, IN CE
         return CE_ERROR;
     }
 
+    CE_ECS_MainStorage_pruneOneWayRelationshipTargets(&context->m_storage, CE_Id_getUniqueId(entity), relationshipType);
+
     if (!CE_Bitset_isBitSet(&entityData->m_entityRelationshipBitset, relationshipType)) {
         return CE_OK;
     }
 
-    cc_for_each(&entityData->m_relationships, el) 
+    cc_for_each(CE_ECS_MainStorage_getRelationshipTargetsDirectly(&context->m_storage, CE_Id_getUniqueId(entity), relationshipType), el)
     {
-        if (CE_Id_getRelationshipTypeId(*el) == relationshipType) {
-            *exists = CE_Id_entityMatches(*el, targetEntity);
+        if (CE_Id_entityMatches(*el, targetEntity)) {
+            *exists = true;
             break;
         }
     }
@@ -271,8 +285,53 @@ CE_Result CE_Entity_GetAllRelationshipsIter(INOUT CE_ECS_Context* context, IN CE
         return CE_ERROR;
     }
 
+    // Drop dead one-way targets so the set only holds live links
+    for (CE_TypeId relationshipType = 0; relationshipType < CE_RELATIONSHIP_TYPES_COUNT; relationshipType++) {
+        if (CE_Bitset_isBitSet(&entityData->m_entityRelationshipBitset, relationshipType)) {
+            CE_ECS_MainStorage_pruneOneWayRelationshipTargets(&context->m_storage, CE_Id_getUniqueId(entity), relationshipType);
+        }
+    }
+
     *relationships = &entityData->m_relationships;
     
     CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
     return CE_OK;
 }
+
+CE_Result CE_Entity_GetRelationshipTargets(INOUT CE_ECS_Context* context, IN CE_Id entity, IN CE_TypeId relationshipType, OUT const CE_Id** targets, OUT size_t* count, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    *targets = NULL;
+    *count = 0;
+
+    if (entity == CE_INVALID_ID) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INVALID_ENTITY_ID);
+        return CE_ERROR;
+    }
+
+    if (relationshipType >= CE_RELATIONSHIP_TYPES_COUNT) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INVALID_RELATIONSHIP_TYPE);
+        return CE_ERROR;
+    }
+
+    CE_ECS_EntityData* entityData = NULL;
+    if (CE_ECS_MainStorage_getEntityData(&context->m_storage, entity, &entityData, errorCode) != CE_OK) {
+        return CE_ERROR;
+    }
+
+    CE_ECS_MainStorage_pruneOneWayRelationshipTargets(&context->m_storage, CE_Id_getUniqueId(entity), relationshipType);
+
+    CE_Id_Vector *indexTargets = CE_ECS_MainStorage_getRelationshipTargetsDirectly(&context->m_storage, CE_Id_getUniqueId(entity), relationshipType);
+    *count = cc_size(indexTargets);
+    *targets = *count > 0 ? cc_first(indexTargets) : NULL;
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+uint32_t CE_ECS_GetRelationshipVersion(INOUT CE_ECS_Context* context, IN CE_TypeId relationshipType)
+{
+    if (relationshipType >= CE_RELATIONSHIP_TYPES_COUNT) {
+        return 0;
+    }
+    return context->m_storage.m_entityStorage.m_relationshipIndex[relationshipType].m_version;
+}
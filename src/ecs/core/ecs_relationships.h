@@ -18,7 +18,8 @@
  * @brief Add a relationship from one entity to another.
  * 
  * Creates a relationship of the specified type from the source entity to the target entity.
- * Optionally, a reciprocal relationship can be created on the target entity.
+ * The reciprocal relationship is created on the target entity, unless the type is one-way.
+ * One-way relationships are only stored on the source and are dropped on the next query once the target is destroyed.
  * 
  * @param[in,out] context The ECS context.
  * @param[in] entity The ID of the source entity.
@@ -34,7 +35,7 @@ CE_Result CE_Entity_AddRelationship(INOUT CE_ECS_Context* context, IN CE_Id enti
  * @brief Remove a relationship from one entity to another.
  * 
  * Removes the specified relationship from the source entity to the target entity.
- * Optionally, removes the reciprocal relationship from the target entity.
+ * The reciprocal relationship is removed from the target entity, unless the type is one-way.
  * 
  * @param[in,out] context The ECS context.
  * @param[in] entity The ID of the source entity.
@@ -54,8 +55,7 @@ CE_Result CE_Entity_RemoveRelationship(INOUT CE_ECS_Context* context, IN CE_Id e
  * @brief Find the first relationship of a specific type on an entity.
  * 
  * Searches for the first relationship matching the given type ID on the entity.
- * If the entity has multiple relationships of the same type, only the first is returned.
- * The order of the relationships is not guaranteed, use this if you are sure there is only one relationship of this type on the entity.
+ * If the entity has multiple relationships of the same type, only the first one added is returned.
  * 
  * @param[in,out] context The ECS context.
  * @param[in] entity The ID of the entity to search.
@@ -106,6 +106,7 @@ CE_Result CE_Entity_HasSpecificRelationship(INOUT CE_ECS_Context* context, IN CE
  * @brief Retrieve a cc_set reference to all relationships of an entity.
  * 
  * The returned container is the raw data, so it should not be altered unless you know what you are doing.
+ * One-way relationships to entities that were destroyed are dropped before it is returned.
  * 
  * @param[in,out] context The ECS context.
  * @param[in] entity The ID of the entity to search.
@@ -117,6 +118,36 @@ CE_Result CE_Entity_HasSpecificRelationship(INOUT CE_ECS_Context* context, IN CE
  */
 CE_Result CE_Entity_GetAllRelationshipsIter(INOUT CE_ECS_Context* context, IN CE_Id entity, OUT CE_Id_Set **relationships, OUT_OPT CE_ERROR_CODE* errorCode);
 
+/**
+ * @brief Get the targets of all relationships of one type on an entity as a packed array.
+ * 
+ * The targets are kept in the order the relationships were added, so this is the fast way to walk children.
+ * The array is owned by the ECS and stays valid until the next relationship change on this entity.
+ * 
+ * @param[in,out] context The ECS context.
+ * @param[in] entity The ID of the entity to search.
+ * @param[in] relationshipType The type ID of the relationships to get.
+ * @param[out] targets Pointer to receive the array of target entity IDs, NULL if there are none. Do not modify it.
+ * @param[out] count Pointer to receive the number of targets.
+ * @param[out] errorCode Optional error code if retrieval fails.
+ * 
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+CE_Result CE_Entity_GetRelationshipTargets(INOUT CE_ECS_Context* context, IN CE_Id entity, IN CE_TypeId relationshipType, OUT const CE_Id** targets, OUT size_t* count, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Get the change counter of a relationship type.
+ * 
+ * The counter is bumped every time a relationship of this type is added, removed or retargeted on any entity,
+ * so data built from relationships (like the flattened scene hierarchy) can tell when it needs a rebuild.
+ * 
+ * @param[in,out] context The ECS context.
+ * @param[in] relationshipType The type ID of the relationship.
+ * 
+ * @return The current counter, 0 for invalid types.
+ */
+uint32_t CE_ECS_GetRelationshipVersion(INOUT CE_ECS_Context* context, IN CE_TypeId relationshipType);
+
 ////////////////////////////////////
 /// Internal ECS functions, exposed here because user code may need to call them
 /// But regular should not use it directly
@@ -18,6 +18,13 @@ const char* CE_ECS_GetRelationshipTypeNameDebugStr(IN CE_TypeId typeId)
 	CE_RELATIONSHIP_DESC_GAME(CE_RELATIONSHIP_DESC)
 #endif
 #undef CE_RELATIONSHIP_DESC
+#define CE_ONE_WAY_RELATIONSHIP_DESC(name) case name: return #name;
+	CE_ONE_WAY_RELATIONSHIP_DESC_CORE(CE_ONE_WAY_RELATIONSHIP_DESC)
+	CE_ONE_WAY_RELATIONSHIP_DESC_ENGINE(CE_ONE_WAY_RELATIONSHIP_DESC)
+#ifndef CE_CORE_TEST_MODE
+	CE_ONE_WAY_RELATIONSHIP_DESC_GAME(CE_ONE_WAY_RELATIONSHIP_DESC)
+#endif
+#undef CE_ONE_WAY_RELATIONSHIP_DESC
         default: return "InvalidRelationshipType";
     }
 #else
@@ -98,10 +98,17 @@ CE_Result CE_ECS_MainStorage_init(OUT CE_ECS_MainStorage *storage, IN CE_ECS_Con
         
         cc_init(&storage->m_entityStorage.m_entityDataArray[i].m_components);
         cc_init(&storage->m_entityStorage.m_entityDataArray[i].m_relationships);
+        for (int type = 0; type < CE_RELATIONSHIP_TYPES_COUNT; type++) {
+            cc_init(&storage->m_entityStorage.m_relationshipIndex[type].m_targets[i]);
+        }
+    }
+    for (int type = 0; type < CE_RELATIONSHIP_TYPES_COUNT; type++) {
+        storage->m_entityStorage.m_relationshipIndex[type].m_version = 0;
     }
 
     storage->m_entityStorage.m_count = 0;
-    if (CE_Bitset_init(&storage->m_entityStorage.m_entityIndexBitset, CE_MAX_ENTITIES) != CE_OK) {
+    if (CE_Bitset_init(&storage->m_entityStorage.m_entityIndexBitset, CE_MAX_ENTITIES) != CE_OK
+        || CE_Bitset_init(&storage->m_entityStorage.m_entityInactiveBitset, CE_MAX_ENTITIES) != CE_OK) {
         CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INTERNAL_ERROR);
         return CE_ERROR;
     }
@@ -148,6 +155,9 @@ CE_Result CE_ECS_MainStorage_cleanup(OUT CE_ECS_MainStorage* storage, IN CE_ECS_
         for (int i=0; i < CE_MAX_ENTITIES; i++) {
             cc_cleanup(&storage->m_entityStorage.m_entityDataArray[i].m_components);
             cc_cleanup(&storage->m_entityStorage.m_entityDataArray[i].m_relationships);
+            for (int type = 0; type < CE_RELATIONSHIP_TYPES_COUNT; type++) {
+                cc_cleanup(&storage->m_entityStorage.m_relationshipIndex[type].m_targets[i]);
+            }
         }
 
         storage->m_initialized = false;
@@ -180,67 +190,56 @@ void* CE_ECS_ComponentStorage_getComponentDataPointerById(INOUT CE_ECS_Component
     return CE_ECS_ComponentStorage_getComponentDataPointer(storage, componentStaticData, CE_Id_getUniqueId(id));
 }
 
-CE_Result CE_ECS_MainStorage_createComponent(INOUT CE_ECS_MainStorage* storage, IN CE_ECS_Context *context, IN const CE_ECS_ComponentStaticData *componentStaticData, OUT CE_Id* id, OUT_OPT void **componentData, OUT_OPT CE_ERROR_CODE* errorCode)
+CE_Result CE_ECS_ComponentStorage_createComponent(INOUT CE_ECS_ComponentStorage* componentStorage, IN CE_ECS_Context *context, IN const CE_ECS_ComponentStaticData *componentStaticData, IN_OPT const void* initialData, OUT CE_Id* id, OUT_OPT void **componentData, OUT_OPT CE_ERROR_CODE* errorCode)
 {
     CE_Result result = CE_OK;
 
-    if (storage->m_initialized == false) {
-        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_STORAGE_MAIN_NOT_INITIALIZED);
-        return CE_ERROR;
-    }
-
-    CE_ECS_ComponentStorage* componentStorage = storage->m_componentTypeStorage[componentStaticData->m_type];
-    if (!componentStorage) {
-        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_STORAGE_COMPONENT_NOT_INITIALIZED);
-        return CE_ERROR;
-    }
-
-    if (componentStorage->m_count >= componentStorage->m_capacity) {
-        // At capacity, need to grow
-        result = CE_ECS_MainStorage_growStorageForComponent(storage, componentStaticData, errorCode);
-        if (result != CE_OK) {
-            return result;
-        }
-    }
-
     // Find the first available slot
-    // TODO: optimize bitset traversal
-    uint16_t index;
-    for (index = 0; index < componentStorage->m_capacity; index++) {
-        if (!CE_Bitset_isBitSet(&componentStorage->m_componentIndexBitset, index))
-        {
-            // Set this here to reserve the space
-            CE_Bitset_setBit(&componentStorage->m_componentIndexBitset, index);
-            break;
-        }
-    }
-    
-    if (index == componentStorage->m_capacity) {
-        // No available slot found, should not happen due to previous checks
+    const uint16_t index = (uint16_t)CE_Bitset_findFirstClear(&componentStorage->m_componentIndexBitset, 0);
+    if (index >= componentStorage->m_capacity) {
+        // No available slot found, callers check capacity first
         CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INTERNAL_ERROR);
         return CE_ERROR;
     }
 
+    // Set this here to reserve the space
+    CE_Bitset_setBit(&componentStorage->m_componentIndexBitset, index);
+
     // Generate new component id
     CE_Id_make(CE_ID_COMPONENT_REFERENCE_KIND, componentStaticData->m_type, 0, (uint32_t)index, id);
 
     // Initialize component
-    void* componentPtr = CE_ECS_ComponentStorage_getComponentDataPointer(componentStorage, componentStaticData, index);
-    if (!componentPtr) {
-        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INTERNAL_ERROR);
-        return CE_ERROR;
-    }
-
-    // Call the component's init function with the right context
-    context->m_callingContext.m_currentComponent = *id;
-    result = componentStaticData->m_initFunction(context, componentPtr);
-    context->m_callingContext.m_currentComponent = CE_INVALID_ID;
+    void* componentPtr = (uint8_t*)componentStorage->m_componentDataPool + (index * componentStaticData->m_storageSizeOf);
+
+    if (initialData) {
+        // Copy the source bytes, then let the copy hook take its own references (assets, owned containers)
+        memcpy(componentPtr, initialData, componentStaticData->m_storageSizeOf);
+        if (componentStaticData->m_copyFunction) {
+            context->m_callingContext.m_currentComponent = *id;
+            result = componentStaticData->m_copyFunction(context, componentPtr);
+            context->m_callingContext.m_currentComponent = CE_INVALID_ID;
+
+            if (result != CE_OK) {
+                CE_Bitset_clearBit(&componentStorage->m_componentIndexBitset, index);
+                CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_STORAGE_COMPONENT_INIT_FAILED);
+                return result;
+            }
+        }
+    } else if (componentStaticData->m_isTrivial) {
+        // Trivial components only need zeroing, skip the init call
+        memset(componentPtr, 0, componentStaticData->m_storageSizeOf);
+    } else {
+        // Call the component's init function with the right context
+        context->m_callingContext.m_currentComponent = *id;
+        result = componentStaticData->m_initFunction(context, componentPtr);
+        context->m_callingContext.m_currentComponent = CE_INVALID_ID;
 
-    if (result != CE_OK) {
-        // Init failed, free the slot
-        CE_Bitset_clearBit(&componentStorage->m_componentIndexBitset, index);
-        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_STORAGE_COMPONENT_INIT_FAILED);
-        return result;
+        if (result != CE_OK) {
+            // Init failed, free the slot
+            CE_Bitset_clearBit(&componentStorage->m_componentIndexBitset, index);
+            CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_STORAGE_COMPONENT_INIT_FAILED);
+            return result;
+        }
     }
 
     // Set header and generate id
@@ -262,6 +261,32 @@ CE_Result CE_ECS_MainStorage_createComponent(INOUT CE_ECS_MainStorage* storage,
     return CE_OK;
 }
 
+CE_Result CE_ECS_MainStorage_createComponent(INOUT CE_ECS_MainStorage* storage, IN CE_ECS_Context *context, IN const CE_ECS_ComponentStaticData *componentStaticData, OUT CE_Id* id, OUT_OPT void **componentData, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_Result result = CE_OK;
+
+    if (storage->m_initialized == false) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_STORAGE_MAIN_NOT_INITIALIZED);
+        return CE_ERROR;
+    }
+
+    CE_ECS_ComponentStorage* componentStorage = storage->m_componentTypeStorage[componentStaticData->m_type];
+    if (!componentStorage) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_STORAGE_COMPONENT_NOT_INITIALIZED);
+        return CE_ERROR;
+    }
+
+    if (componentStorage->m_count >= componentStorage->m_capacity) {
+        // At capacity, need to grow
+        result = CE_ECS_MainStorage_growStorageForComponent(storage, componentStaticData, errorCode);
+        if (result != CE_OK) {
+            return result;
+        }
+    }
+
+    return CE_ECS_ComponentStorage_createComponent(componentStorage, context, componentStaticData, NULL, id, componentData, errorCode);
+}
+
 CE_Result CE_ECS_MainStorage_destroyComponent(INOUT CE_ECS_MainStorage* storage, IN CE_ECS_Context *context, IN const CE_ECS_ComponentStaticData *componentStaticData, IN CE_Id id, OUT_OPT CE_ERROR_CODE* errorCode)
 {
     CE_Result result = CE_OK;
@@ -314,33 +339,9 @@ CE_Result CE_ECS_MainStorage_destroyComponent(INOUT CE_ECS_MainStorage* storage,
     return CE_OK;
 }
 
-CE_Result CE_ECS_MainStorage_createEntity(INOUT CE_ECS_MainStorage* storage, OUT CE_Id* id, OUT_OPT CE_ERROR_CODE* errorCode)
+// Next generation for an entity slot, wrapping around
+static uint8_t CE_ECS_MainStorage_nextGeneration(IN const CE_ECS_EntityData* entityData)
 {
-    if (storage->m_initialized == false) {
-        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_STORAGE_MAIN_NOT_INITIALIZED);
-        return CE_ERROR;
-    }
-
-    if (storage->m_entityStorage.m_count >= CE_MAX_ENTITIES) {
-        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_MAX_ENTITIES_REACHED);
-        return CE_ERROR;
-    }
-
-    // Find the first available slot for a new entity
-    size_t index;
-    for (index = 0; index < CE_MAX_ENTITIES; index++) {
-        if (!CE_Bitset_isBitSet(&storage->m_entityStorage.m_entityIndexBitset, index)) {
-            break;
-        }
-    }
-
-    if (index >= CE_MAX_ENTITIES) {
-        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_MAX_ENTITIES_REACHED);
-        return CE_ERROR;
-    }
-
-    CE_ECS_EntityData* entityData = &storage->m_entityStorage.m_entityDataArray[index];
-    
     uint8_t generation = 0;
     if (entityData->m_entityId != CE_INVALID_ID) {
         generation = CE_Id_getGeneration(entityData->m_entityId) + 1;
@@ -348,6 +349,26 @@ CE_Result CE_ECS_MainStorage_createEntity(INOUT CE_ECS_MainStorage* storage, OUT
             generation = 0;
         }
     }
+    return generation;
+}
+
+// Empties the relationship index of an entity slot, the arrays keep their memory for the next occupant
+static void CE_ECS_MainStorage_clearRelationshipTargets(INOUT CE_ECS_MainStorage* storage, IN CE_ShortId index)
+{
+    for (int type = 0; type < CE_RELATIONSHIP_TYPES_COUNT; type++) {
+        CE_ECS_RelationshipIndex *relationshipIndex = &storage->m_entityStorage.m_relationshipIndex[type];
+        if (cc_size(&relationshipIndex->m_targets[index]) > 0) {
+            cc_clear(&relationshipIndex->m_targets[index]);
+            relationshipIndex->m_version++;
+        }
+    }
+}
+
+// Activates a free entity slot, bumping its generation so ids from the previous occupant become stale
+static CE_Result CE_ECS_MainStorage_activateEntitySlot(INOUT CE_ECS_MainStorage* storage, IN size_t index, OUT CE_Id* id, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_ECS_EntityData* entityData = &storage->m_entityStorage.m_entityDataArray[index];
+    const uint8_t generation = CE_ECS_MainStorage_nextGeneration(entityData);
     
     CE_Id newId = CE_INVALID_ID;
     CE_Result result = CE_Id_make(CE_ID_ENTITY_REFERENCE_KIND, (CE_TypeId)0, generation, (uint32_t)index, &newId);
@@ -358,15 +379,18 @@ CE_Result CE_ECS_MainStorage_createEntity(INOUT CE_ECS_MainStorage* storage, OUT
 
     entityData->m_entityId = newId;
     CE_Bitset_setBit(&storage->m_entityStorage.m_entityIndexBitset, index);
+    CE_Bitset_clearBit(&storage->m_entityStorage.m_entityInactiveBitset, index);
     CE_Bitset_clear(&entityData->m_entityComponentBitset);
     CE_Bitset_clear(&entityData->m_entityRelationshipBitset);
     cc_clear(&entityData->m_components);
     cc_clear(&entityData->m_relationships);
+    CE_ECS_MainStorage_clearRelationshipTargets(storage, (CE_ShortId)index);
 
     // Initialize component and relationship arrays with initial capacity to prevent reallocations
     if (!cc_reserve(&entityData->m_components, CE_INITIAL_ENTITY_COMPONENTS_CAPACITY)
         || !cc_reserve(&entityData->m_relationships, CE_INITIAL_ENTITY_RELATIONSHIPS_CAPACITY))
     {
+        CE_Bitset_clearBit(&storage->m_entityStorage.m_entityIndexBitset, index);
         CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
         return CE_ERROR;
     }
@@ -376,6 +400,67 @@ CE_Result CE_ECS_MainStorage_createEntity(INOUT CE_ECS_MainStorage* storage, OUT
 
     CE_Debug("Created entity with ID %u", *id);
 
+    return CE_OK;
+}
+
+CE_Result CE_ECS_MainStorage_createEntity(INOUT CE_ECS_MainStorage* storage, OUT CE_Id* id, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    if (storage->m_initialized == false) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_STORAGE_MAIN_NOT_INITIALIZED);
+        return CE_ERROR;
+    }
+
+    if (storage->m_entityStorage.m_count >= CE_MAX_ENTITIES) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_MAX_ENTITIES_REACHED);
+        return CE_ERROR;
+    }
+
+    // Find the first available slot for a new entity
+    const size_t index = CE_Bitset_findFirstClear(&storage->m_entityStorage.m_entityIndexBitset, 0);
+    if (index >= CE_MAX_ENTITIES) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_MAX_ENTITIES_REACHED);
+        return CE_ERROR;
+    }
+
+    if (CE_ECS_MainStorage_activateEntitySlot(storage, index, id, errorCode) != CE_OK) {
+        return CE_ERROR;
+    }
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+CE_Result CE_ECS_MainStorage_createEntities(INOUT CE_ECS_MainStorage* storage, IN size_t count, OUT CE_Id ids[], OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    if (storage->m_initialized == false) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_STORAGE_MAIN_NOT_INITIALIZED);
+        return CE_ERROR;
+    }
+
+    // All or nothing, check there is room for every entity before touching any slot
+    if (count > (size_t)(CE_MAX_ENTITIES - storage->m_entityStorage.m_count)) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_MAX_ENTITIES_REACHED);
+        return CE_ERROR;
+    }
+
+    // Slots are handed out in index order, so each search resumes where the previous one stopped
+    size_t index = 0;
+    for (size_t i = 0; i < count; i++) {
+        index = CE_Bitset_findFirstClear(&storage->m_entityStorage.m_entityIndexBitset, index);
+        if (index >= CE_MAX_ENTITIES || CE_ECS_MainStorage_activateEntitySlot(storage, index, &ids[i], errorCode) != CE_OK) {
+            // Should not happen due to the capacity check, undo the slots taken so far
+            for (size_t j = 0; j < i; j++) {
+                CE_ECS_MainStorage_destroyEntity(storage, ids[j], NULL);
+                ids[j] = CE_INVALID_ID;
+            }
+            if (index >= CE_MAX_ENTITIES) {
+                CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INTERNAL_ERROR);
+            }
+            return CE_ERROR;
+        }
+        index++;
+    }
+
     CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
     return CE_OK;
 }
@@ -408,11 +493,47 @@ CE_Result CE_ECS_MainStorage_destroyEntity(INOUT CE_ECS_MainStorage* storage, IN
     }
 
     CE_Bitset_clearBit(&storage->m_entityStorage.m_entityIndexBitset, index);
+    CE_Bitset_clearBit(&storage->m_entityStorage.m_entityInactiveBitset, index);
     storage->m_entityStorage.m_count--;
     CE_Bitset_clear(&entityData->m_entityComponentBitset);
     CE_Bitset_clear(&entityData->m_entityRelationshipBitset);
     cc_clear(&entityData->m_components);
     cc_clear(&entityData->m_relationships);
+    CE_ECS_MainStorage_clearRelationshipTargets(storage, index);
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+CE_Result CE_ECS_MainStorage_deactivateEntity(INOUT CE_ECS_MainStorage* storage, IN CE_Id id, OUT CE_Id* newId, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_ECS_EntityData* entityData = NULL;
+    if (CE_ECS_MainStorage_getEntityData(storage, id, &entityData, errorCode) != CE_OK) {
+        return CE_ERROR;
+    }
+
+    const uint16_t index = CE_Id_getUniqueId(id);
+    if (CE_Id_make(CE_ID_ENTITY_REFERENCE_KIND, (CE_TypeId)0, CE_ECS_MainStorage_nextGeneration(entityData), (uint32_t)index, newId) != CE_OK) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INTERNAL_ERROR);
+        return CE_ERROR;
+    }
+
+    // Components and relationships stay in place, only the id changes
+    entityData->m_entityId = *newId;
+    CE_Bitset_setBit(&storage->m_entityStorage.m_entityInactiveBitset, index);
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+CE_Result CE_ECS_MainStorage_activateEntity(INOUT CE_ECS_MainStorage* storage, IN CE_Id id, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_ECS_EntityData* entityData = NULL;
+    if (CE_ECS_MainStorage_getEntityData(storage, id, &entityData, errorCode) != CE_OK) {
+        return CE_ERROR;
+    }
+
+    CE_Bitset_clearBit(&storage->m_entityStorage.m_entityInactiveBitset, CE_Id_getUniqueId(id));
 
     CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
     return CE_OK;
@@ -473,3 +594,90 @@ CE_Result CE_ECS_MainStorage_getEntityDataByUniqueId(INOUT CE_ECS_MainStorage* s
     CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
     return CE_OK;
 }
+
+CE_Result CE_ECS_MainStorage_addRelationshipTarget(INOUT CE_ECS_MainStorage* storage, IN CE_ShortId source, IN CE_Id relationship, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    const CE_TypeId relationshipType = CE_Id_getRelationshipTypeId(relationship);
+    if (relationshipType >= CE_RELATIONSHIP_TYPES_COUNT) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INVALID_RELATIONSHIP_TYPE);
+        return CE_ERROR;
+    }
+
+    if (!cc_push(CE_ECS_MainStorage_getRelationshipTargetsDirectly(storage, source, relationshipType), CE_Id_relationshipToEntityReference(relationship))) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+    storage->m_entityStorage.m_relationshipIndex[relationshipType].m_version++;
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+size_t CE_ECS_MainStorage_removeRelationshipTarget(INOUT CE_ECS_MainStorage* storage, IN CE_ShortId source, IN CE_Id relationship)
+{
+    const CE_TypeId relationshipType = CE_Id_getRelationshipTypeId(relationship);
+    if (relationshipType >= CE_RELATIONSHIP_TYPES_COUNT) {
+        return 0;
+    }
+
+    CE_Id_Vector *targets = CE_ECS_MainStorage_getRelationshipTargetsDirectly(storage, source, relationshipType);
+    const CE_Id target = CE_Id_relationshipToEntityReference(relationship);
+    for (size_t i = 0; i < cc_size(targets); i++) {
+        if (*cc_get(targets, i) == target) {
+            // Ordered erase, siblings keep their insertion order
+            cc_erase(targets, i);
+            storage->m_entityStorage.m_relationshipIndex[relationshipType].m_version++;
+            break;
+        }
+    }
+    return cc_size(targets);
+}
+
+void CE_ECS_MainStorage_replaceRelationshipTarget(INOUT CE_ECS_MainStorage* storage, IN CE_ShortId source, IN CE_Id oldRelationship, IN CE_Id newRelationship)
+{
+    const CE_TypeId relationshipType = CE_Id_getRelationshipTypeId(oldRelationship);
+    if (relationshipType >= CE_RELATIONSHIP_TYPES_COUNT) {
+        return;
+    }
+
+    CE_Id_Vector *targets = CE_ECS_MainStorage_getRelationshipTargetsDirectly(storage, source, relationshipType);
+    const CE_Id oldTarget = CE_Id_relationshipToEntityReference(oldRelationship);
+    for (size_t i = 0; i < cc_size(targets); i++) {
+        if (*cc_get(targets, i) == oldTarget) {
+            *cc_get(targets, i) = CE_Id_relationshipToEntityReference(newRelationship);
+            storage->m_entityStorage.m_relationshipIndex[relationshipType].m_version++;
+            break;
+        }
+    }
+}
+
+void CE_ECS_MainStorage_pruneOneWayRelationshipTargets(INOUT CE_ECS_MainStorage* storage, IN CE_ShortId source, IN CE_TypeId relationshipType)
+{
+    if (relationshipType >= CE_RELATIONSHIP_TYPES_COUNT || !CE_ECS_IsOneWayRelationship(relationshipType)) {
+        return;
+    }
+
+    CE_ECS_EntityData* sourceData = CE_ECS_MainStorage_getEntityDataDirectly(storage, source);
+    CE_Id_Vector *targets = CE_ECS_MainStorage_getRelationshipTargetsDirectly(storage, source, relationshipType);
+    for (size_t i = 0; i < cc_size(targets);) {
+        const CE_Id target = *cc_get(targets, i);
+        const CE_ShortId targetIndex = CE_Id_getUniqueId(target);
+        if (CE_Bitset_isBitSet(&storage->m_entityStorage.m_entityIndexBitset, targetIndex)
+            && CE_Id_entityMatches(CE_ECS_MainStorage_getEntityDataDirectly(storage, targetIndex)->m_entityId, target)) {
+            i++;
+            continue;
+        }
+
+        // The generation no longer matches, the target was destroyed or recycled since the link was made
+        CE_Id relationship = CE_INVALID_ID;
+        if (CE_Id_make(CE_ID_ENTITY_RELATIONSHIP_KIND, relationshipType, CE_Id_getGeneration(target), targetIndex, &relationship) == CE_OK) {
+            cc_erase(&sourceData->m_relationships, relationship);
+        }
+        cc_erase(targets, i);
+        storage->m_entityStorage.m_relationshipIndex[relationshipType].m_version++;
+    }
+
+    if (cc_size(targets) == 0) {
+        CE_Bitset_clearBit(&sourceData->m_entityRelationshipBitset, relationshipType);
+    }
+}
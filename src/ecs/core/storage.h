@@ -12,6 +12,7 @@
 #include "entity.h"
 #include "../components.h"
 #include "../systems.h"
+#include "../relationships.h"
 
 // Component storage structures
 // Component header is used to track metadata for each component instance in storage
@@ -28,10 +29,19 @@ typedef struct CE_ECS_ComponentStorage {
     CE_Bitset m_componentIndexBitset; // Bitset to track used indices
 } CE_ECS_ComponentStorage;
 
+// Adjacency index for one relationship type, the targets of each entity are packed in one array in insertion order
+// so walking them is a linear scan. The entity relationship sets stay the source of truth for membership checks.
+typedef struct CE_ECS_RelationshipIndex {
+    CE_Id_Vector m_targets[CE_MAX_ENTITIES]; // Entity references, indexed by the source entity unique ID
+    uint32_t m_version; // Bumped on every change, lets caches built from these relationships detect they are stale
+} CE_ECS_RelationshipIndex;
+
 typedef struct CE_ECS_EntityStorage {
     uint16_t m_count; // Number of currently alive entities
     CE_Bitset m_entityIndexBitset; // Bitset to track used indices
+    CE_Bitset m_entityInactiveBitset; // Entities parked by a pool, they keep their data but systems skip them
     CE_ECS_EntityData m_entityDataArray[CE_MAX_ENTITIES]; // Fixed-size array for entity data, indexed by entity unique ID
+    CE_ECS_RelationshipIndex m_relationshipIndex[CE_RELATIONSHIP_TYPES_COUNT]; // Relationship targets per type
 } CE_ECS_EntityStorage;
 
 // Global component storage definitions
@@ -60,6 +70,9 @@ CE_Result CE_ECS_MainStorage_cleanup(INOUT CE_ECS_MainStorage* storage, IN CE_EC
 // Component creation and management functions
 CE_Result CE_ECS_MainStorage_createComponent(INOUT CE_ECS_MainStorage* storage, IN CE_ECS_Context *context, IN const CE_ECS_ComponentStaticData *componentStaticData, OUT CE_Id* id, OUT_OPT void **componentData, OUT_OPT CE_ERROR_CODE* errorCode);
 CE_Result CE_ECS_MainStorage_destroyComponent(INOUT CE_ECS_MainStorage* storage, IN CE_ECS_Context *context, IN const CE_ECS_ComponentStaticData *componentStaticData, IN CE_Id id, OUT_OPT CE_ERROR_CODE* errorCode);
+// Creates a component directly on a type storage, callers must validate the storage and its capacity first
+// When initialData is given the new instance is copied from it (plus the copy hook) instead of being initialized
+CE_Result CE_ECS_ComponentStorage_createComponent(INOUT CE_ECS_ComponentStorage* componentStorage, IN CE_ECS_Context *context, IN const CE_ECS_ComponentStaticData *componentStaticData, IN_OPT const void* initialData, OUT CE_Id* id, OUT_OPT void **componentData, OUT_OPT CE_ERROR_CODE* errorCode);
 CE_Result CE_ECS_MainStorage_growStorageForComponent(INOUT CE_ECS_MainStorage* storage, IN const CE_ECS_ComponentStaticData *componentStaticData, OUT_OPT CE_ERROR_CODE* errorCode);
 
 // Component data access
@@ -68,7 +81,11 @@ void* CE_ECS_ComponentStorage_getComponentDataPointer(INOUT CE_ECS_ComponentStor
 
 // Entity creation and management functions
 CE_Result CE_ECS_MainStorage_createEntity(INOUT CE_ECS_MainStorage* storage, OUT CE_Id* id, OUT_OPT CE_ERROR_CODE* errorCode);
+CE_Result CE_ECS_MainStorage_createEntities(INOUT CE_ECS_MainStorage* storage, IN size_t count, OUT CE_Id ids[], OUT_OPT CE_ERROR_CODE* errorCode);
 CE_Result CE_ECS_MainStorage_destroyEntity(INOUT CE_ECS_MainStorage* storage, IN CE_Id id, OUT_OPT CE_ERROR_CODE* errorCode);
+// Park an entity without freeing its slot, bumps the generation so outstanding ids become stale
+CE_Result CE_ECS_MainStorage_deactivateEntity(INOUT CE_ECS_MainStorage* storage, IN CE_Id id, OUT CE_Id* newId, OUT_OPT CE_ERROR_CODE* errorCode);
+CE_Result CE_ECS_MainStorage_activateEntity(INOUT CE_ECS_MainStorage* storage, IN CE_Id id, OUT_OPT CE_ERROR_CODE* errorCode);
 
 // Entity access functions
 CE_Result CE_ECS_MainStorage_getEntityData(INOUT CE_ECS_MainStorage* storage, IN CE_Id id, OUT CE_ECS_EntityData** outData, OUT_OPT CE_ERROR_CODE* errorCode);
@@ -79,4 +96,19 @@ inline CE_ECS_EntityData* CE_ECS_MainStorage_getEntityDataDirectly(INOUT CE_ECS_
     return &(storage->m_entityStorage.m_entityDataArray[id]);
 }
 
+// Relationship index maintenance, callers keep it in sync with the entity relationship sets
+CE_Result CE_ECS_MainStorage_addRelationshipTarget(INOUT CE_ECS_MainStorage* storage, IN CE_ShortId source, IN CE_Id relationship, OUT_OPT CE_ERROR_CODE* errorCode);
+// Returns the number of targets of the same type the source has left
+size_t CE_ECS_MainStorage_removeRelationshipTarget(INOUT CE_ECS_MainStorage* storage, IN CE_ShortId source, IN CE_Id relationship);
+// Swaps a target in place, keeping its position
+void CE_ECS_MainStorage_replaceRelationshipTarget(INOUT CE_ECS_MainStorage* storage, IN CE_ShortId source, IN CE_Id oldRelationship, IN CE_Id newRelationship);
+// One-way relationships are not unlinked when their target goes away, this drops the targets whose entity was destroyed
+// or recycled before they are read. Does nothing for paired relationships
+void CE_ECS_MainStorage_pruneOneWayRelationshipTargets(INOUT CE_ECS_MainStorage* storage, IN CE_ShortId source, IN CE_TypeId relationshipType);
+
+// Helper function to directly get the packed targets of an entity for a relationship type without error checking (for internal use)
+inline CE_Id_Vector* CE_ECS_MainStorage_getRelationshipTargetsDirectly(INOUT CE_ECS_MainStorage* storage, IN CE_ShortId source, IN CE_TypeId relationshipType) {
+    return &(storage->m_entityStorage.m_relationshipIndex[relationshipType].m_targets[source]);
+}
+
 #endif // CORGO_ECS_CORE_STORAGE_H
\ No newline at end of file
@@ -17,7 +17,8 @@
 
 #undef REQUIRE_RELATIONSHIP
 #define REQUIRE_RELATIONSHIP(relationshipType, varName) \
-    CE_Bitset_setBit(&data->m_requiredRelationshipBitset, relationshipType);
+    CE_Bitset_setBit(&data->m_requiredRelationshipBitset, relationshipType);\
+    data->m_requiresOneWayRelationship |= CE_ECS_IsOneWayRelationship(relationshipType);
 
 #define CE_GENERATE_SYSTEM_DESCRIPTION_FUNCTION(name, ...) \
 void name##_description(OUT CE_ECS_SystemStaticData *data) \
@@ -31,6 +32,7 @@ void name##_description(OUT CE_ECS_SystemStaticData *data) \
     CE_Bitset_init(&data->m_requiredRelationshipBitset, CE_RELATIONSHIP_TYPES_COUNT);\
     data->m_isValid = true;\
     data->m_enabled = true;\
+    data->m_requiresOneWayRelationship = false;\
     __VA_ARGS__ \
 }
 
@@ -42,6 +42,7 @@ struct CE_ECS_SystemStaticData {
     CE_ECS_SYSTEM_RUN_FREQUENCY m_runFrequency;
     CE_Bitset m_requiredComponentBitset; // Bitset of required component types for this system
     CE_Bitset m_requiredRelationshipBitset; // Bitset of required relationship types for this system
+    bool m_requiresOneWayRelationship; // True if any required relationship is one-way, stale targets are pruned before matching
     CE_Result (*m_runFunction)(INOUT struct CE_ECS_Context* context, const IN CE_ECS_SystemStaticData *systemDesc, const IN CE_Id entity, const IN float deltaTime, OUT_OPT CE_ERROR_CODE* errorCode);
 };
 
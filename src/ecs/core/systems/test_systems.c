@@ -35,6 +35,13 @@ CE_START_SYSTEM_IMPLEMENTATION(CE_CORE_TEST_SYSTEM_REL, CE_CORE_TEST_SYSTEM_DEPE
 }
 CE_END_SYSTEM_IMPLEMENTATION
 
+CE_START_SYSTEM_IMPLEMENTATION(CE_CORE_TEST_SYSTEM_ONE_WAY, CE_CORE_TEST_SYSTEM_DEPENDENCIES_ONE_WAY)
+{
+    (void)targetEntity_Id;
+    debugComponent->m_ticked_oneWay = true;
+}
+CE_END_SYSTEM_IMPLEMENTATION
+
 CE_START_SYSTEM_IMPLEMENTATION(CE_CORE_TEST_SYSTEM_SCENE_ORDER, CE_CORE_TEST_SYSTEM_DEPENDENCIES)
 {
     if (!CE_Entity_HasRelationship(context, entity, CE_RELATIONSHIP_PARENT))
@@ -50,6 +50,39 @@ CE_Result CE_ECS_Init(INOUT CE_ECS_Context* context, OUT_OPT CE_ERROR_CODE *erro
  */
 CE_Result CE_ECS_Cleanup(INOUT CE_ECS_Context* context, OUT_OPT CE_ERROR_CODE* errorCode);
 
+/**
+ * @brief Exchange all entities and components between two contexts.
+ * 
+ * Component pools are swapped by pointer and the entity table is swapped in place,
+ * so the cost does not depend on how many components are alive.
+ * Global components are not touched, use CE_ECS_SwapGlobalComponent for the ones that should follow the entities.
+ * Entity IDs keep working in the context their entity ends up in.
+ * Both contexts must have been initialized and must not be running systems on the swapped data.
+ * 
+ * @param[in,out] context The first ECS context.
+ * @param[in,out] other The second ECS context.
+ */
+void CE_ECS_SwapEntities(INOUT CE_ECS_Context* context, INOUT CE_ECS_Context* other);
+
+/**
+ * @brief Exchange the contents of two memory blocks of the same size in place.
+ * 
+ * @param[in,out] a First block.
+ * @param[in,out] b Second block.
+ * @param[in] size Size of each block in bytes.
+ */
+void CE_ECS_SwapMemory(INOUT void* a, INOUT void* b, IN size_t size);
+
+/**
+ * @brief Macro: Exchange the data of a global component between two contexts.
+ * 
+ * @param[in,out] context The first ECS context.
+ * @param[in,out] other The second ECS context.
+ * @param[in] name The name of the global component to swap.
+ */
+#define CE_ECS_SwapGlobalComponent(context, other, name) \
+    CE_ECS_SwapMemory(CE_ECS_AccessGlobalComponent(context, name), CE_ECS_AccessGlobalComponent(other, name), sizeof(CE_GLOBAL_COMPONENT_DATA(name)))
+
 /**
  * @brief Update the ECS and execute all non-render systems.
  * 
@@ -15,18 +15,27 @@
 #ifndef CE_RELATIONSHIP_DESC_CORE
 #define CE_RELATIONSHIP_DESC_CORE(CE_RELATIONSHIP_DESC)
 #endif
+#ifndef CE_ONE_WAY_RELATIONSHIP_DESC_CORE
+#define CE_ONE_WAY_RELATIONSHIP_DESC_CORE(CE_ONE_WAY_RELATIONSHIP_DESC)
+#endif
 
 // Engine relationships
 #include "../engine/relationships.h"
 #ifndef CE_RELATIONSHIP_DESC_ENGINE
 #define CE_RELATIONSHIP_DESC_ENGINE(CE_RELATIONSHIP_DESC)
 #endif
+#ifndef CE_ONE_WAY_RELATIONSHIP_DESC_ENGINE
+#define CE_ONE_WAY_RELATIONSHIP_DESC_ENGINE(CE_ONE_WAY_RELATIONSHIP_DESC)
+#endif
 
 // Game relationships
 #include "../game/relationships.h"
 #ifndef CE_RELATIONSHIP_DESC_GAME
 #define CE_RELATIONSHIP_DESC_GAME(CE_RELATIONSHIP_DESC)
 #endif
+#ifndef CE_ONE_WAY_RELATIONSHIP_DESC_GAME
+#define CE_ONE_WAY_RELATIONSHIP_DESC_GAME(CE_ONE_WAY_RELATIONSHIP_DESC)
+#endif
 
 //// Generate relationship Types Enum
 typedef enum CE_RELATIONSHIP_TYPES_ENUM {
@@ -37,9 +46,20 @@ typedef enum CE_RELATIONSHIP_TYPES_ENUM {
 	CE_RELATIONSHIP_DESC_GAME(CE_RELATIONSHIP_DESC)
 #endif
 #undef CE_RELATIONSHIP_DESC
+	// One-way relationships go after the paired ones
+#define CE_ONE_WAY_RELATIONSHIP_DESC(relationship) relationship,
+	CE_ONE_WAY_RELATIONSHIP_DESC_CORE(CE_ONE_WAY_RELATIONSHIP_DESC)
+	CE_ONE_WAY_RELATIONSHIP_DESC_ENGINE(CE_ONE_WAY_RELATIONSHIP_DESC)
+#ifndef CE_CORE_TEST_MODE
+	CE_ONE_WAY_RELATIONSHIP_DESC_GAME(CE_ONE_WAY_RELATIONSHIP_DESC)
+#endif
+#undef CE_ONE_WAY_RELATIONSHIP_DESC
 	CE_RELATIONSHIP_TYPES_COUNT //Invalid system count
 } CE_RELATIONSHIP_TYPES;
 
+// Reciprocal of a one-way relationship, nothing is stored on the target
+#define CE_RELATIONSHIP_NO_RECIPROCAL CE_INVALID_TYPE_ID
+
 static const int CE_RELATIONSHIPS_RECIPROCALS[CE_RELATIONSHIP_TYPES_COUNT] = {
 #define CE_RELATIONSHIP_DESC(relationship, reciprocal) reciprocal, relationship,
 	CE_RELATIONSHIP_DESC_CORE(CE_RELATIONSHIP_DESC)
@@ -48,8 +68,20 @@ static const int CE_RELATIONSHIPS_RECIPROCALS[CE_RELATIONSHIP_TYPES_COUNT] = {
 	CE_RELATIONSHIP_DESC_GAME(CE_RELATIONSHIP_DESC)
 #endif
 #undef CE_RELATIONSHIP_DESC
+#define CE_ONE_WAY_RELATIONSHIP_DESC(relationship) CE_RELATIONSHIP_NO_RECIPROCAL,
+	CE_ONE_WAY_RELATIONSHIP_DESC_CORE(CE_ONE_WAY_RELATIONSHIP_DESC)
+	CE_ONE_WAY_RELATIONSHIP_DESC_ENGINE(CE_ONE_WAY_RELATIONSHIP_DESC)
+#ifndef CE_CORE_TEST_MODE
+	CE_ONE_WAY_RELATIONSHIP_DESC_GAME(CE_ONE_WAY_RELATIONSHIP_DESC)
+#endif
+#undef CE_ONE_WAY_RELATIONSHIP_DESC
 };
 
+// One-way relationships are only stored on the source, stale targets are dropped when queried
+static inline bool CE_ECS_IsOneWayRelationship(IN CE_TypeId relationshipType) {
+    return CE_RELATIONSHIPS_RECIPROCALS[relationshipType] == CE_RELATIONSHIP_NO_RECIPROCAL;
+}
+
 //// Debug helpers
 const char* CE_ECS_GetRelationshipTypeNameDebugStr(IN CE_TypeId typeId);
 
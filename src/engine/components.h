@@ -18,12 +18,21 @@
 #include "engine/assets.h"
 #include "components/camera.h"
 #include "components/input.h"
+#include "core/prefab.h"
+#include "core/entity_pool.h"
+#include "core/frame_arena.h"
+#include "core/render_commands.h"
+#include "core/dirty_region.h"
+#include "core/bitmap_cache.h"
 
 // Include component headers
 #include "components/text_label.h"
 #include "components/transform.h"
 #include "components/sprite.h"
 #include "components/image.h"
+#include "components/sprite_animation.h"
+#include "components/tilemap.h"
+#include "components/particle_emitter.h"
 
 // Include demo scene components if sample scenes are enabled
 #ifdef CE_ENGINE_INCLUDE_SAMPLE_SCENES
@@ -39,21 +48,31 @@
 // Engine components uid range: 10-99
 
 #define CE_COMPONENT_DESC_ENGINE(CE_COMPONENT_DESC) \
-	CE_COMPONENT_DESC(CE_TRANSFORM_COMPONENT, 10, CE_TransformComponent, CE_DEFAULT_COMPONENT_CAPACITY)\
+	CE_TRIVIAL_COMPONENT_DESC(CE_TRANSFORM_COMPONENT, 10, CE_TransformComponent, CE_DEFAULT_COMPONENT_CAPACITY, CE_COMPONENT_COPY_HOOK(CE_TRANSFORM_COMPONENT))\
 	CE_COMPONENT_DESC(CE_SPRITE_COMPONENT, 11, CE_SpriteComponent, 32)\
-	CE_COMPONENT_DESC(CE_TEXT_LABEL_COMPONENT, 12, CE_TextLabelComponent, 16)\
-	CE_COMPONENT_DESC(CE_IMAGE_COMPONENT, 13, CE_ImageComponent, 32)\
+	CE_COMPONENT_DESC(CE_TEXT_LABEL_COMPONENT, 12, CE_TextLabelComponent, 16, CE_COMPONENT_COPY_HOOK(CE_TEXT_LABEL_COMPONENT))\
+	CE_COMPONENT_DESC(CE_IMAGE_COMPONENT, 13, CE_ImageComponent, 32, CE_COMPONENT_COPY_HOOK(CE_IMAGE_COMPONENT))\
+	CE_COMPONENT_DESC(CE_SPRITE_ANIMATION_COMPONENT, 14, CE_SpriteAnimationComponent, 32, CE_COMPONENT_COPY_HOOK(CE_SPRITE_ANIMATION_COMPONENT))\
+	CE_COMPONENT_DESC(CE_TILEMAP_COMPONENT, 15, CE_TilemapComponent, 4, CE_COMPONENT_COPY_HOOK(CE_TILEMAP_COMPONENT))\
+	CE_COMPONENT_DESC(CE_PARTICLE_EMITTER_COMPONENT, 16, CE_ParticleEmitterComponent, 16, CE_COMPONENT_COPY_HOOK(CE_PARTICLE_EMITTER_COMPONENT))\
 	CE_COMPONENT_DESC_SAMPLE_COMPONENTS(CE_COMPONENT_DESC)\
 
 
 
+// Prefabs, background scene contexts and the bitmap cache hold asset references, keep them before the asset cache so they are cleaned up first
 #define CE_GLOBAL_COMPONENT_DESC_ENGINE(CE_GLOBAL_COMPONENT_DESC) \
+	CE_GLOBAL_COMPONENT_DESC(CE_ENGINE_PREFAB_REGISTRY, CE_PrefabRegistryComponent)\
+	CE_GLOBAL_COMPONENT_DESC(CE_ENGINE_ENTITY_POOL_REGISTRY, CE_EntityPoolRegistryComponent)\
+	CE_GLOBAL_COMPONENT_DESC(CE_ENGINE_SCENE_SCRIPT_COMPONENT, CE_SceneScriptComponent)\
+	CE_GLOBAL_COMPONENT_DESC(CE_ENGINE_BITMAP_CACHE, CE_BitmapCacheComponent)\
     CE_GLOBAL_COMPONENT_DESC(CE_ENGINE_ASSET_CACHE, CE_Engine_AssetCacheComponent)\
 	CE_GLOBAL_COMPONENT_DESC(CE_ENGINE_SCENE_GRAPH_COMPONENT, CE_SceneGraphComponent)\
 	CE_GLOBAL_COMPONENT_DESC(CE_ENGINE_DISPLAY_COMPONENT, CE_DisplayComponent)\
 	CE_GLOBAL_COMPONENT_DESC(CE_ENGINE_CAMERA_COMPONENT, CE_CameraComponent)\
-	CE_GLOBAL_COMPONENT_DESC(CE_ENGINE_SCENE_SCRIPT_COMPONENT, CE_SceneScriptComponent)\
 	CE_GLOBAL_COMPONENT_DESC(CE_ENGINE_INPUT_COMPONENT, CE_InputComponent)\
+	CE_GLOBAL_COMPONENT_DESC(CE_ENGINE_FRAME_ARENA, CE_FrameArenaComponent)\
+	CE_GLOBAL_COMPONENT_DESC(CE_ENGINE_RENDER_COMMANDS, CE_RenderCommandBufferComponent)\
+	CE_GLOBAL_COMPONENT_DESC(CE_ENGINE_DIRTY_REGION, CE_DirtyRegionComponent)\
 
 
 #endif // CORGO_ENGINE_COMPONENTS_H
\ No newline at end of file
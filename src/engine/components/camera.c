@@ -10,6 +10,8 @@ CE_DEFINE_GLOBAL_COMPONENT_INIT(CE_ENGINE_CAMERA_COMPONENT)
 {
     component->m_x = 0;
     component->m_y = 0;
+    component->m_shakeX = 0;
+    component->m_shakeY = 0;
     return CE_OK;
 }
 
@@ -30,8 +32,29 @@ CE_Result CE_Engine_Camera_SetPosition(INOUT CE_ECS_Context* context,IN int16_t
     cameraComponent->m_x = x;
     cameraComponent->m_y = y;
 
-    // Mark the scene graph as dirty to ensure the new camera position is applied in the next render
+    // Only a redraw is needed, the render nodes do not depend on the camera
     CE_Engine_SceneGraph_MarkDirty(context);
 
     return CE_OK;
 }
+
+CE_Result CE_Engine_Camera_SetShake(INOUT CE_ECS_Context* context, IN int16_t x, IN int16_t y)
+{
+    CE_CameraComponent* cameraComponent = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_CAMERA_COMPONENT);
+
+    if (cameraComponent->m_shakeX == x && cameraComponent->m_shakeY == y) {
+        return CE_OK;
+    }
+
+    cameraComponent->m_shakeX = x;
+    cameraComponent->m_shakeY = y;
+    CE_Engine_SceneGraph_MarkDirty(context);
+
+    return CE_OK;
+}
+
+void CE_Engine_Camera_ApplyDrawOffset(INOUT CE_ECS_Context* context)
+{
+    const CE_CameraComponent* cameraComponent = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_CAMERA_COMPONENT);
+    CE_Display_SetDrawOffset(context, cameraComponent->m_shakeX - cameraComponent->m_x, cameraComponent->m_shakeY - cameraComponent->m_y);
+}
@@ -12,11 +12,16 @@ typedef struct CE_CameraComponent {
     // Position
     int16_t m_x;
     int16_t m_y;
+    // Screen shake, added on top of the position
+    int16_t m_shakeX;
+    int16_t m_shakeY;
 } CE_CameraComponent;
 
 /**
  * Sets the camera position. The camera's position determines the offset applied to all rendered entities, allowing for scrolling and panning effects.
+ * The offset is applied as a display draw offset when rendering, render nodes stay in world space so moving the camera does not recompute them.
  * Use this to guarantee that the screen is updated
+ * Small pans scroll what is already on screen and only redraw the strips scrolled in, see CE_ENGINE_ENABLE_SCROLL_BLIT
  * 
  * @param context[inout] Pointer to the ECS context.
  * @param x[in] The new X position of the camera.
@@ -26,6 +31,18 @@ typedef struct CE_CameraComponent {
  */
 CE_Result CE_Engine_Camera_SetPosition(INOUT CE_ECS_Context* context,IN int16_t x, IN int16_t y);
 
+/**
+ * Sets the screen shake offset. It moves the world in the given direction on top of the camera position, entities with a fixed position stay steady.
+ * The shake is not animated, update it every frame and set it back to 0, 0 when done.
+ * 
+ * @param context[inout] Pointer to the ECS context.
+ * @param x[in] The horizontal shake offset in pixels.
+ * @param y[in] The vertical shake offset in pixels.
+ * 
+ * @return CE_OK if the shake offset was successfully updated, or an appropriate error code if the operation failed.
+ */
+CE_Result CE_Engine_Camera_SetShake(INOUT CE_ECS_Context* context, IN int16_t x, IN int16_t y);
+
 /**
  * Function like macro to get the current X position of the camera.
  * 
@@ -44,4 +61,8 @@ CE_Result CE_Engine_Camera_SetPosition(INOUT CE_ECS_Context* context,IN int16_t
  */
 #define CE_Engine_Camera_GetY(context) (CE_ECS_AccessGlobalComponent(context, CE_ENGINE_CAMERA_COMPONENT)->m_y);
 
+/// Private API
+// Apply the camera and shake as the display draw offset, called once per frame before rendering
+void CE_Engine_Camera_ApplyDrawOffset(INOUT CE_ECS_Context* context);
+
 #endif // CORGO_ENGINE_COMPONENTS_CAMERA_H
\ No newline at end of file
@@ -22,6 +22,16 @@ CE_DEFINE_COMPONENT_CLEANUP(CE_IMAGE_COMPONENT)
     return CE_OK;
 }
 
+CE_DEFINE_COMPONENT_COPY(CE_IMAGE_COMPONENT)
+{
+    // The copy shares the bitmap, take a reference so both can release it
+    if (component->m_imagePtr)
+    {
+        return CE_RETAIN_ASSET(context, CE_ASSET_TYPE_BITMAP, component->m_imagePtr);
+    }
+    return CE_OK;
+}
+
 CE_Result CE_ImageComponent_setImage(INOUT CE_ECS_Context* context, INOUT CE_ImageComponent* component, IN CE_TransformComponent *transform, IN const char* imageName)
 {
     if (component->m_imagePtr)
@@ -73,6 +83,6 @@ CE_Result CE_ImageComponent_getImageBounds(INOUT CE_ECS_Context* context, INOUT
 
 CE_Result CE_ImageComponent_update(INOUT CE_ECS_Context* context, INOUT CE_ImageComponent* component, IN CE_TransformComponent *transform)
 {
-    CE_Engine_SceneGraph_MarkDirty(context);
+    CE_TransformComponent_markDirty(context, transform);
     return CE_ImageComponent_getImageBounds(context, component, &transform->m_width, &transform->m_height);
 }
@@ -0,0 +1,341 @@
+//
+//  engine/components/particle_emitter.c
+//  Particle emitter component definition.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#include "engine/corgo.h"
+
+// Bytes of pool per particle, the float arrays come first so every array stays aligned
+#define CE_PARTICLE_EMITTER_PARTICLE_SIZE (6 * sizeof(float) + sizeof(uint8_t))
+
+// Table frames a particle can go through, frames are stored in a byte
+#define CE_PARTICLE_EMITTER_MAX_FRAMES 256
+
+// Split one allocation in the per field arrays
+static void CE_ParticleEmitterComponent_setArrays(INOUT CE_ParticleEmitterComponent* component)
+{
+    float *floats = component->m_pool;
+    const size_t capacity = component->m_capacity;
+    component->m_x = floats;
+    component->m_y = floats + capacity;
+    component->m_velocityX = floats + capacity * 2;
+    component->m_velocityY = floats + capacity * 3;
+    component->m_life = floats + capacity * 4;
+    component->m_lifeScale = floats + capacity * 5;
+    component->m_frame = component->m_pool == NULL ? NULL : (uint8_t*)(floats + capacity * 6);
+}
+
+CE_DEFINE_COMPONENT_INIT(CE_PARTICLE_EMITTER_COMPONENT)
+{
+    component->m_settings = (CE_ParticleEmitterSettings){
+        .m_rate = 0.0f,
+        .m_lifetime = 1.0f,
+        .m_lifetimeVariance = 0.0f,
+        .m_speedMin = 0.0f,
+        .m_speedMax = 0.0f,
+        .m_gravity = 0.0f,
+        .m_angle = 0,
+        .m_spread = 180,
+        .m_areaWidth = 0,
+        .m_areaHeight = 0
+    };
+    component->m_tablePtr = NULL;
+    component->m_frameCount = 0;
+    component->m_frameWidth = 1;
+    component->m_frameHeight = 1;
+    component->m_pool = NULL;
+    component->m_capacity = 0;
+    component->m_count = 0;
+    CE_ParticleEmitterComponent_setArrays(component);
+    component->m_emitting = false;
+    component->m_emitCredit = 0.0f;
+    component->m_random = 0x9E3779B9u;
+    component->m_minX = 0.0f;
+    component->m_minY = 0.0f;
+    component->m_maxX = 0.0f;
+    component->m_maxY = 0.0f;
+    return CE_OK;
+}
+
+CE_DEFINE_COMPONENT_CLEANUP(CE_PARTICLE_EMITTER_COMPONENT)
+{
+    CE_free(component->m_pool);
+    component->m_pool = NULL;
+    component->m_capacity = 0;
+    component->m_count = 0;
+    CE_ParticleEmitterComponent_setArrays(component);
+    if (component->m_tablePtr)
+    {
+        CE_RELEASE_ASSET(context, CE_ASSET_TYPE_BITMAP_TABLE, component->m_tablePtr);
+        component->m_tablePtr = NULL;
+    }
+    return CE_OK;
+}
+
+// New random state for a copy, so instances of the same emitter do not play the same pattern. Every copy
+// mixes in a different count, the state of the source alone would give the same seed to all of them
+static uint32_t CE_ParticleEmitterComponent_reseed(IN uint32_t state)
+{
+    static uint32_t copyCount = 0;
+    state ^= ++copyCount * 0x9E3779B9u;
+    state ^= state >> 16;
+    state *= 0x85EBCA6Bu;
+    state ^= state >> 13;
+    state *= 0xC2B2AE35u;
+    state ^= state >> 16;
+    return state != 0 ? state : 0x9E3779B9u; // Xorshift never leaves 0
+}
+
+CE_DEFINE_COMPONENT_COPY(CE_PARTICLE_EMITTER_COMPONENT)
+{
+    // The copy has the settings and a pool of the same size, without the live particles
+    const uint16_t capacity = component->m_capacity;
+    component->m_pool = NULL;
+    component->m_capacity = 0;
+    component->m_count = 0;
+    component->m_emitCredit = 0.0f;
+    component->m_random = CE_ParticleEmitterComponent_reseed(component->m_random);
+    CE_ParticleEmitterComponent_setArrays(component);
+    if (component->m_tablePtr && CE_RETAIN_ASSET(context, CE_ASSET_TYPE_BITMAP_TABLE, component->m_tablePtr) != CE_OK)
+    {
+        component->m_tablePtr = NULL;
+        return CE_ERROR;
+    }
+    return capacity > 0 ? CE_ParticleEmitterComponent_setCapacity(context, component, capacity, NULL) : CE_OK;
+}
+
+// Xorshift, enough for effects and cheap on the device. Returns [0, 1)
+static inline float CE_ParticleEmitterComponent_random(INOUT CE_ParticleEmitterComponent* component)
+{
+    uint32_t state = component->m_random;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    component->m_random = state;
+    return (float)(state >> 8) * (1.0f / 16777216.0f);
+}
+
+// Bhaskara's approximation, within 0.002 of the sine and without the math library
+static float CE_ParticleEmitterComponent_sinDegrees(IN float degrees)
+{
+    degrees -= 360.0f * (float)(int32_t)(degrees / 360.0f);
+    if (degrees < 0.0f)
+    {
+        degrees += 360.0f;
+    }
+    const float sign = degrees >= 180.0f ? -1.0f : 1.0f;
+    if (degrees >= 180.0f)
+    {
+        degrees -= 180.0f;
+    }
+    const float product = degrees * (180.0f - degrees);
+    return sign * 4.0f * product / (40500.0f - product);
+}
+
+// Add up to count particles from the settings, returns how many fit
+static uint16_t CE_ParticleEmitterComponent_emit(INOUT CE_ParticleEmitterComponent* component, IN uint32_t count)
+{
+    const CE_ParticleEmitterSettings *settings = &component->m_settings;
+    const uint16_t room = (uint16_t)(component->m_capacity - component->m_count);
+    const uint16_t emitted = (uint16_t)(count < room ? count : room);
+    for (uint16_t n = 0; n < emitted; n++)
+    {
+        const uint16_t i = component->m_count++;
+        const float angle = (float)settings->m_angle + (CE_ParticleEmitterComponent_random(component) * 2.0f - 1.0f) * (float)settings->m_spread;
+        const float speed = settings->m_speedMin + CE_ParticleEmitterComponent_random(component) * (settings->m_speedMax - settings->m_speedMin);
+        float life = settings->m_lifetime + (CE_ParticleEmitterComponent_random(component) * 2.0f - 1.0f) * settings->m_lifetimeVariance;
+        if (life < 0.001f)
+        {
+            life = 0.001f;
+        }
+
+        component->m_x[i] = CE_ParticleEmitterComponent_random(component) * (float)settings->m_areaWidth;
+        component->m_y[i] = CE_ParticleEmitterComponent_random(component) * (float)settings->m_areaHeight;
+        component->m_velocityX[i] = CE_ParticleEmitterComponent_sinDegrees(angle + 90.0f) * speed;
+        component->m_velocityY[i] = CE_ParticleEmitterComponent_sinDegrees(angle) * speed;
+        component->m_life[i] = life;
+        component->m_lifeScale[i] = 1.0f / life;
+        component->m_frame[i] = 0;
+
+        // Drawn before the next update moves them, the area must already cover them
+        if (i == 0)
+        {
+            component->m_minX = component->m_maxX = component->m_x[i];
+            component->m_minY = component->m_maxY = component->m_y[i];
+            continue;
+        }
+        component->m_minX = component->m_x[i] < component->m_minX ? component->m_x[i] : component->m_minX;
+        component->m_minY = component->m_y[i] < component->m_minY ? component->m_y[i] : component->m_minY;
+        component->m_maxX = component->m_x[i] > component->m_maxX ? component->m_x[i] : component->m_maxX;
+        component->m_maxY = component->m_y[i] > component->m_maxY ? component->m_y[i] : component->m_maxY;
+    }
+    return emitted;
+}
+
+CE_Result CE_ParticleEmitterComponent_setCapacity(INOUT CE_ECS_Context* context, INOUT CE_ParticleEmitterComponent* component, IN uint16_t capacity, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    if (capacity > CE_ENGINE_PARTICLE_MAX_POOL_SIZE)
+    {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENGINE_PARTICLE_POOL_TOO_LARGE);
+        return CE_ERROR;
+    }
+
+    CE_free(component->m_pool);
+    component->m_pool = NULL;
+    component->m_capacity = 0;
+    component->m_count = 0;
+    if (capacity > 0)
+    {
+        component->m_pool = CE_realloc(NULL, (size_t)capacity * CE_PARTICLE_EMITTER_PARTICLE_SIZE);
+        if (component->m_pool == NULL)
+        {
+            CE_ParticleEmitterComponent_setArrays(component);
+            CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+            return CE_ERROR;
+        }
+        component->m_capacity = capacity;
+    }
+    CE_ParticleEmitterComponent_setArrays(component);
+    CE_Engine_SceneGraph_MarkDirty(context);
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+CE_Result CE_ParticleEmitterComponent_setTable(INOUT CE_ECS_Context* context, INOUT CE_ParticleEmitterComponent* component, IN_OPT const char* tableName)
+{
+    if (component->m_tablePtr)
+    {
+        CE_RELEASE_ASSET(context, CE_ASSET_TYPE_BITMAP_TABLE, component->m_tablePtr);
+        component->m_tablePtr = NULL;
+    }
+    component->m_frameCount = 0;
+    component->m_frameWidth = 1;
+    component->m_frameHeight = 1;
+    if (tableName == NULL)
+    {
+        return CE_OK;
+    }
+
+    component->m_tablePtr = CE_CACHE_ASSET(context, CE_ASSET_TYPE_BITMAP_TABLE, tableName, NULL);
+    if (component->m_tablePtr == NULL)
+    {
+        return CE_ERROR;
+    }
+#ifdef CE_BACKEND_PLAYDATE
+    PlaydateAPI* pd = CE_GetPlaydateAPI();
+    while (component->m_frameCount < CE_PARTICLE_EMITTER_MAX_FRAMES && pd->graphics->getTableBitmap(component->m_tablePtr, component->m_frameCount) != NULL)
+    {
+        component->m_frameCount++;
+    }
+    if (component->m_frameCount > 0)
+    {
+        int iwidth, iheight;
+        pd->graphics->getBitmapData(pd->graphics->getTableBitmap(component->m_tablePtr, 0), &iwidth, &iheight, NULL, NULL, NULL);
+        component->m_frameWidth = (uint8_t)(iwidth > UINT8_MAX ? UINT8_MAX : iwidth);
+        component->m_frameHeight = (uint8_t)(iheight > UINT8_MAX ? UINT8_MAX : iheight);
+    }
+#endif
+    return CE_OK;
+}
+
+// Edge of the particle area in pixels, kept in the range of the transform overflow
+static inline int16_t CE_ParticleEmitterComponent_clampEdge(IN float edge)
+{
+    return (int16_t)(edge < (float)INT16_MIN ? INT16_MIN : (edge > (float)INT16_MAX ? INT16_MAX : edge));
+}
+
+// The scene graph tracks the particles as part of the emitter node, moving ones are redrawn every frame.
+// A pixel on each side covers the rounding of the positions, frames are drawn centered
+static void CE_ParticleEmitterComponent_setOverflow(INOUT CE_ECS_Context* context, IN const CE_ParticleEmitterComponent* component, INOUT CE_TransformComponent* transform)
+{
+    if (component->m_count == 0)
+    {
+        CE_TransformComponent_setOverflow(context, transform, 0, 0, 0, 0);
+        return;
+    }
+    const float halfWidth = (float)(component->m_frameWidth / 2);
+    const float halfHeight = (float)(component->m_frameHeight / 2);
+    CE_TransformComponent_setOverflow(context, transform,
+        CE_ParticleEmitterComponent_clampEdge(component->m_minX - halfWidth - 1.0f),
+        CE_ParticleEmitterComponent_clampEdge(component->m_minY - halfHeight - 1.0f),
+        CE_ParticleEmitterComponent_clampEdge(component->m_maxX - halfWidth + (float)component->m_frameWidth + 1.0f),
+        CE_ParticleEmitterComponent_clampEdge(component->m_maxY - halfHeight + (float)component->m_frameHeight + 1.0f));
+    CE_TransformComponent_markDirty(context, transform);
+}
+
+uint16_t CE_ParticleEmitterComponent_burst(INOUT CE_ECS_Context* context, INOUT CE_ParticleEmitterComponent* component, INOUT CE_TransformComponent* transform, IN uint16_t count)
+{
+    const uint16_t emitted = CE_ParticleEmitterComponent_emit(component, count);
+    if (emitted > 0)
+    {
+        CE_ParticleEmitterComponent_setOverflow(context, component, transform);
+    }
+    return emitted;
+}
+
+void CE_ParticleEmitterComponent_update(INOUT CE_ECS_Context* context, INOUT CE_ParticleEmitterComponent* component, INOUT CE_TransformComponent* transform, IN float deltaTime)
+{
+    if (component->m_emitting && component->m_settings.m_rate > 0.0f)
+    {
+        component->m_emitCredit += component->m_settings.m_rate * deltaTime;
+        const uint32_t due = (uint32_t)component->m_emitCredit;
+        component->m_emitCredit -= (float)due;
+        CE_ParticleEmitterComponent_emit(component, due); // What does not fit is dropped, not delayed
+    }
+
+    // Dead particles are replaced by the last one, the arrays stay packed and order does not matter
+    float *x = component->m_x, *y = component->m_y;
+    float *velocityX = component->m_velocityX, *velocityY = component->m_velocityY;
+    float *life = component->m_life, *lifeScale = component->m_lifeScale;
+    uint8_t *frame = component->m_frame;
+    const float gravity = component->m_settings.m_gravity * deltaTime;
+    const float frameCount = (float)component->m_frameCount;
+    const uint8_t lastFrame = (uint8_t)(component->m_frameCount > 0 ? component->m_frameCount - 1 : 0);
+    float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+    uint16_t count = component->m_count;
+    for (uint16_t i = 0; i < count; )
+    {
+        life[i] -= deltaTime;
+        if (life[i] <= 0.0f)
+        {
+            count--;
+            x[i] = x[count];
+            y[i] = y[count];
+            velocityX[i] = velocityX[count];
+            velocityY[i] = velocityY[count];
+            life[i] = life[count];
+            lifeScale[i] = lifeScale[count];
+            frame[i] = frame[count];
+            continue;
+        }
+
+        velocityY[i] += gravity;
+        x[i] += velocityX[i] * deltaTime;
+        y[i] += velocityY[i] * deltaTime;
+        const uint32_t tableFrame = (uint32_t)((1.0f - life[i] * lifeScale[i]) * frameCount);
+        frame[i] = tableFrame < lastFrame ? (uint8_t)tableFrame : lastFrame;
+
+        if (i == 0)
+        {
+            minX = maxX = x[i];
+            minY = maxY = y[i];
+        }
+        else
+        {
+            minX = x[i] < minX ? x[i] : minX;
+            minY = y[i] < minY ? y[i] : minY;
+            maxX = x[i] > maxX ? x[i] : maxX;
+            maxY = y[i] > maxY ? y[i] : maxY;
+        }
+        i++;
+    }
+
+    component->m_count = count;
+    component->m_minX = minX;
+    component->m_minY = minY;
+    component->m_maxX = maxX;
+    component->m_maxY = maxY;
+
+    CE_ParticleEmitterComponent_setOverflow(context, component, transform);
+}
@@ -0,0 +1,114 @@
+//
+//  engine/components/particle_emitter.h
+//  Particle emitter component definition.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#ifndef CORGO_ENGINE_COMPONENTS_PARTICLE_EMITTER_H
+#define CORGO_ENGINE_COMPONENTS_PARTICLE_EMITTER_H
+
+#include "ecs/types.h"
+#include "engine/assets.h"
+
+// How new particles start, read on every emission so it can change at any time
+typedef struct CE_ParticleEmitterSettings {
+	float m_rate; // Particles per second while emitting
+	float m_lifetime; // Seconds
+	float m_lifetimeVariance; // Lifetimes are up to this many seconds shorter or longer
+	float m_speedMin; // Pixels per second
+	float m_speedMax;
+	float m_gravity; // Pixels per second squared, downwards
+	int16_t m_angle; // Direction in degrees, clockwise from the right
+	int16_t m_spread; // Degrees on either side of the direction
+	uint16_t m_areaWidth; // Particles start anywhere in this area from the emitter position, 0 for a point
+	uint16_t m_areaHeight;
+} CE_ParticleEmitterSettings;
+
+//// Particle Emitter Component
+// Particles are not entities. Each emitter owns a pool of them laid out as one array per field, so the update
+// is a single loop over packed memory, and they are drawn as small bitmaps or single pixels
+typedef struct CEParticleEmitterComponent {
+	CE_ParticleEmitterSettings m_settings;
+	CE_ASSET_PTR(CE_ASSET_TYPE_BITMAP_TABLE) m_tablePtr; // NULL draws black pixels
+	uint16_t m_frameCount; // Table frames, played once over the lifetime of each particle
+	uint8_t m_frameWidth; // Size of the table frames, particles are drawn centered on their position
+	uint8_t m_frameHeight;
+	// Pool, one allocation split in m_capacity long arrays. Live particles are packed at the front
+	void *m_pool;
+	float *m_x; // Relative to the emitter, particles move with it
+	float *m_y;
+	float *m_velocityX; // Pixels per second
+	float *m_velocityY;
+	float *m_life; // Seconds left
+	float *m_lifeScale; // One over the lifetime, turns the life left into the frame
+	uint8_t *m_frame;
+	uint16_t m_capacity;
+	uint16_t m_count;
+	bool m_emitting;
+	float m_emitCredit; // Fraction of a particle carried over to the next update
+	uint32_t m_random; // Xorshift state, never 0
+	// Positions covered by the live particles, relative to the emitter. Only valid while there are some
+	float m_minX;
+	float m_minY;
+	float m_maxX;
+	float m_maxY;
+} CE_ParticleEmitterComponent;
+
+typedef struct CE_TransformComponent CE_TransformComponent;
+
+// Helpers
+/**
+ * @brief Allocate the particle pool, live particles are dropped.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in,out] component The particle emitter component to update.
+ * @param[in] capacity Most particles alive at once, up to CE_ENGINE_PARTICLE_MAX_POOL_SIZE.
+ * @param[out] errorCode Optional error code.
+ *
+ * @return CE_OK on success, CE_ERROR if the pool is too large or could not be allocated.
+ */
+CE_Result CE_ParticleEmitterComponent_setCapacity(INOUT CE_ECS_Context* context, INOUT CE_ParticleEmitterComponent* component, IN uint16_t capacity, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Set the bitmap table particles are drawn with. All frames are expected to have the same size.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in,out] component The particle emitter component to update.
+ * @param[in] tableName The name of the bitmap table to set, NULL to draw pixels.
+ *
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+CE_Result CE_ParticleEmitterComponent_setTable(INOUT CE_ECS_Context* context, INOUT CE_ParticleEmitterComponent* component, IN_OPT const char* tableName);
+
+/**
+ * @brief Emit particles at once, for explosions and impacts. Particles that do not fit in the pool are dropped.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in,out] component The particle emitter component to update.
+ * @param[in,out] transform The transform component of the emitter, its overflow covers the particles.
+ * @param[in] count Number of particles to emit.
+ *
+ * @return Number of particles emitted.
+ */
+uint16_t CE_ParticleEmitterComponent_burst(INOUT CE_ECS_Context* context, INOUT CE_ParticleEmitterComponent* component, INOUT CE_TransformComponent* transform, IN uint16_t count);
+
+/**
+ * @brief Function like macro to emit continuously at the rate of the settings.
+ *
+ * @param[in,out] component The particle emitter component to update.
+ */
+#define CE_ParticleEmitterComponent_start(component) ((component)->m_emitting = true)
+
+/**
+ * @brief Function like macro to stop emitting, live particles play out their lifetime.
+ *
+ * @param[in,out] component The particle emitter component to update.
+ */
+#define CE_ParticleEmitterComponent_stop(component) ((component)->m_emitting = false)
+
+/// Private API
+// Emit at the rate, move and age every particle, drop the dead ones and set the area they cover as the transform overflow,
+// so the scene graph culls and erases the particles with the emitter node
+void CE_ParticleEmitterComponent_update(INOUT CE_ECS_Context* context, INOUT CE_ParticleEmitterComponent* component, INOUT CE_TransformComponent* transform, IN float deltaTime);
+
+#endif // CORGO_ENGINE_COMPONENTS_PARTICLE_EMITTER_H
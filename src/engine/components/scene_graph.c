@@ -7,18 +7,45 @@
 #include "engine/corgo.h"
 #include "engine/assets.h"
 
+#include <string.h>
+
 CE_DEFINE_GLOBAL_COMPONENT_INIT(CE_ENGINE_SCENE_GRAPH_COMPONENT)
 {
     component->m_rootEntityId = CE_INVALID_ID;
     component->m_needsRedraw = true;
+    component->m_hierarchyVersion = 0;
+    component->m_hierarchyValid = false;
+    component->m_renderListValid = false;
+    component->m_culledCount = 0;
 
     cc_init(&component->m_renderList);
+    cc_init(&component->m_renderQueue);
+    cc_init(&component->m_renderQueueScratch);
+    cc_init(&component->m_hierarchy);
+    cc_init(&component->m_localPositions);
+    cc_init(&component->m_worldPositions);
+    cc_init(&component->m_propagationParents);
+    CE_SpatialHash_init(&component->m_spatialHash);
+    for (size_t i = 0; i < CE_ENGINE_STATIC_LAYER_MAX; i++) {
+        component->m_staticLayers[i] = (CE_SceneGraphStaticLayer){ .m_entityId = CE_INVALID_ID, .m_bitmap = NULL };
+    }
     return CE_OK;
 }
 
 CE_DEFINE_GLOBAL_COMPONENT_CLEANUP(CE_ENGINE_SCENE_GRAPH_COMPONENT)
 {
     cc_cleanup(&component->m_renderList);
+    cc_cleanup(&component->m_renderQueue);
+    cc_cleanup(&component->m_renderQueueScratch);
+    cc_cleanup(&component->m_hierarchy);
+    cc_cleanup(&component->m_localPositions);
+    cc_cleanup(&component->m_worldPositions);
+    cc_cleanup(&component->m_propagationParents);
+    CE_SpatialHash_cleanup(&component->m_spatialHash);
+    for (size_t i = 0; i < CE_ENGINE_STATIC_LAYER_MAX; i++) {
+        CE_Display_FreeBitmap(context, component->m_staticLayers[i].m_bitmap);
+        component->m_staticLayers[i].m_bitmap = NULL;
+    }
     return CE_OK;
 }
 
@@ -47,6 +74,7 @@ CE_Result CE_Engine_SceneGraph_Init(CE_ECS_Context* context, CE_ERROR_CODE* erro
             return CE_ERROR;
         }
         CE_TransformComponent_setFlags(transformComponent, CE_TransformComponent_Flags_InSceneGraph);
+        sceneGraph->m_hierarchyValid = false;
     }
 
     CE_Debug("Scene graph initialized with root entity ID: %u", sceneGraph->m_rootEntityId);
@@ -116,7 +144,7 @@ CE_Result CE_Scene_RemoveChild(INOUT CE_ECS_Context* context, IN CE_Id parentId,
     if (CE_Entity_FindFirstComponent(context, childId, CE_TRANSFORM_COMPONENT, &componentId, (void**)&transformComp, errorCode) != CE_OK) {
         return CE_ERROR;
     }
-    CE_TransformComponent_clearFlags(transformComp, CE_TransformComponent_Flags_InSceneGraph);
+    CE_TransformComponent_clearFlags(transformComp, CE_TransformComponent_Flags_InSceneGraph | CE_TransformComponent_Flags_InStaticLayer);
 
     // Removing a component needs a redraw
     CE_Engine_SceneGraph_MarkDirty(context);
@@ -132,97 +160,149 @@ typedef struct NodeInfo {
 
 CE_Result CE_Engine_SceneGraph_Traverse(INOUT CE_ECS_Context* context, IN CE_Id entityId, IN CE_SceneGraphTraverseCallback callback, INOUT void* userData, CE_ERROR_CODE* errorCode)
 {
-    CE_SceneGraphComponent* sceneGraph = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_SCENE_GRAPH_COMPONENT);
-
-    cc_vec(NodeInfo) expansionList;
-    cc_init(&expansionList);
-    if (!cc_reserve(&expansionList, 6)) // Reserve an average of 6 children per entity
+    // Every entity is pushed at most once, the stack lives in the frame arena and is given back on exit
+    const size_t arenaMark = CE_FrameArena_GetMark(context);
+    NodeInfo *expansionList = CE_FrameArena_AllocArray(context, NodeInfo, CE_MAX_ENTITIES);
+    if (expansionList == NULL)
     {
         CE_Error("Failed to reserve memory for SceneGraph expansion list");
         CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
         return CE_ERROR;
     }
 
-    NodeInfo rootNode = { .entityId = sceneGraph->m_rootEntityId, .parentId = CE_INVALID_ID };
-    cc_push(&expansionList, rootNode);
+    CE_Result result = CE_OK;
+    size_t expansionCount = 0;
+    expansionList[expansionCount++] = (NodeInfo){ .entityId = entityId, .parentId = CE_INVALID_ID };
 
-    while(cc_size(&expansionList) > 0)
+    while (result == CE_OK && expansionCount > 0)
     {
-        NodeInfo currentNode = *cc_last(&expansionList);
-        cc_erase(&expansionList, cc_size(&expansionList) - 1);
+        const NodeInfo currentNode = expansionList[--expansionCount];
 
         // Get children of the current entity and add them to the expansion list
-        CE_Id_Set *children;
-        if (CE_Entity_GetAllRelationshipsIter(context, currentNode.entityId, &children, errorCode) != CE_OK)
+        const CE_Id *children = NULL;
+        size_t childCount = 0;
+        result = CE_Entity_GetRelationshipTargets(context, currentNode.entityId, CE_RELATIONSHIP_CHILD, &children, &childCount, errorCode);
+        if (result == CE_OK && expansionCount + childCount > CE_MAX_ENTITIES)
         {
-            cc_cleanup(&expansionList);
-            return CE_ERROR;
+            CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+            result = CE_ERROR;
         }
 
-        cc_for_each(children, childRel)
+        // Pushed backwards so siblings are visited in the order they were added
+        for (size_t i = childCount; result == CE_OK && i > 0; i--)
         {
-            if (CE_Id_getRelationshipTypeId(*childRel) == CE_RELATIONSHIP_CHILD) {
-                NodeInfo childNode = { .entityId = CE_Id_relationshipToEntityReference(*childRel), .parentId = currentNode.entityId };
-                cc_push(&expansionList, childNode);
-            }
+            expansionList[expansionCount++] = (NodeInfo){ .entityId = children[i - 1], .parentId = currentNode.entityId };
         }
 
         // Process the current entity last in case it gets deleted
-        if (callback(context, currentNode.entityId, currentNode.parentId, userData, errorCode) != CE_OK)
+        if (result == CE_OK)
+        {
+            result = callback(context, currentNode.entityId, currentNode.parentId, userData, errorCode);
+        }
+    }
+
+    CE_FrameArena_Rewind(context, arenaMark);
+    return result;
+}
+
+// Rebuild the flattened hierarchy from the child relationships, reusing its memory
+static CE_Result CE_Engine_SceneGraph_rebuildHierarchy(INOUT CE_ECS_Context* context, INOUT CE_SceneGraphComponent* sceneGraph, CE_ERROR_CODE* errorCode)
+{
+    cc_clear(&sceneGraph->m_hierarchy);
+    sceneGraph->m_hierarchyValid = false;
+
+    CE_SceneGraphHierarchyNode rootNode = { .m_entityId = sceneGraph->m_rootEntityId, .m_parentIndex = CE_SCENE_GRAPH_NO_PARENT };
+    if (cc_push(&sceneGraph->m_hierarchy, rootNode) == NULL)
+    {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+
+    // The array doubles as the work queue
+    for (size_t i = 0; i < cc_size(&sceneGraph->m_hierarchy); i++)
+    {
+        const CE_Id *children = NULL;
+        size_t childCount = 0;
+        if (CE_Entity_GetRelationshipTargets(context, cc_get(&sceneGraph->m_hierarchy, i)->m_entityId, CE_RELATIONSHIP_CHILD, &children, &childCount, errorCode) != CE_OK)
         {
-            cc_cleanup(&expansionList);
             return CE_ERROR;
         }
+
+        if (cc_size(&sceneGraph->m_hierarchy) + childCount >= CE_SCENE_GRAPH_NO_PARENT
+            || !cc_reserve(&sceneGraph->m_hierarchy, cc_size(&sceneGraph->m_hierarchy) + childCount))
+        {
+            CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+            return CE_ERROR;
+        }
+        for (size_t c = 0; c < childCount; c++)
+        {
+            CE_SceneGraphHierarchyNode childNode = { .m_entityId = children[c], .m_parentIndex = (uint16_t)i };
+            cc_push(&sceneGraph->m_hierarchy, childNode); // Space was reserved above
+        }
     }
 
-    cc_cleanup(&expansionList);
+    // Component pools do not move, the transforms can be kept until the next rebuild
+    cc_for_each(&sceneGraph->m_hierarchy, node)
+    {
+        node->m_transform = NULL;
+        CE_Entity_FindFirstComponent(context, node->m_entityId, CE_TRANSFORM_COMPONENT, NULL, (void**)&node->m_transform, NULL);
+    }
+    sceneGraph->m_renderListValid = false;
+    CE_SpatialHash_clear(&sceneGraph->m_spatialHash); // Refilled by the full refresh, drops the nodes that left the tree
+
+    sceneGraph->m_hierarchyVersion = CE_ECS_GetRelationshipVersion(context, CE_RELATIONSHIP_CHILD);
+    sceneGraph->m_hierarchyValid = true;
     return CE_OK;
 }
 
-CE_Result UpdateRenderListTraverseFunc(IN CE_ECS_Context* context, IN CE_Id entityId, IN CE_Id parentId, INOUT void* userData, CE_ERROR_CODE* errorCode)
+CE_Result CE_Engine_SceneGraph_GetHierarchy(INOUT CE_ECS_Context* context, OUT const CE_SceneGraphHierarchyNode** nodes, OUT size_t* count, CE_ERROR_CODE* errorCode)
 {
     CE_SceneGraphComponent* sceneGraph = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_SCENE_GRAPH_COMPONENT);
-    CE_CameraComponent *cameraComponent = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_CAMERA_COMPONENT);
-    CE_TransformComponent* transformComponent = NULL;
-    CE_Id componentId = CE_INVALID_ID;
+    *nodes = NULL;
+    *count = 0;
 
-    if (CE_Entity_FindFirstComponent(context, entityId, CE_TRANSFORM_COMPONENT, &componentId, (void**)&transformComponent, errorCode) != CE_OK) {
-        CE_Error("Failed to find transform component for entity %u while rebuilding scene graph Z-order cache", entityId);
-        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENGINE_SCENE_GRAPH_MISSING_TRANSFORM);
+    if (sceneGraph->m_rootEntityId == CE_INVALID_ID)
+    {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENGINE_SCENE_GRAPH_NOT_READY);
         return CE_ERROR;
     }
 
-    CE_SceneGraphRenderNode *parentRenderNode = cc_get(&sceneGraph->m_renderList, CE_Id_getUniqueId(parentId));
-
-    if (parentRenderNode == NULL && parentId != CE_INVALID_ID) {
-        CE_Error("Parent entity %u does not have a render node in the scene graph cache while rebuilding Z-order cache for entity %u", parentId, entityId);
-        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INTERNAL_ERROR);
+    if ((!sceneGraph->m_hierarchyValid || sceneGraph->m_hierarchyVersion != CE_ECS_GetRelationshipVersion(context, CE_RELATIONSHIP_CHILD))
+        && CE_Engine_SceneGraph_rebuildHierarchy(context, sceneGraph, errorCode) != CE_OK)
+    {
+        CE_Error("Failed to rebuild the scene graph hierarchy");
         return CE_ERROR;
     }
 
-    int16_t parentX = 0;
-    int16_t parentY = 0;
-    
-    if (!CE_TransformComponent_hasFixedPosition(transformComponent)) {
-        parentX = parentId == CE_INVALID_ID ? -cameraComponent->m_x : parentRenderNode->m_x;
-        parentY = parentId == CE_INVALID_ID ? -cameraComponent->m_y : parentRenderNode->m_y;
-    }
+    *nodes = cc_first(&sceneGraph->m_hierarchy);
+    *count = cc_size(&sceneGraph->m_hierarchy);
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+// Refresh the render node of one hierarchy node that moved or changed
+static CE_Result CE_Engine_SceneGraph_updateRenderNode(INOUT CE_SceneGraphComponent* sceneGraph, INOUT CE_SceneGraphHierarchyNode* node, IN int16_t worldX, IN int16_t worldY, IN bool screenSpace, CE_ERROR_CODE* errorCode)
+{
+    const CE_Id entityId = node->m_entityId;
+    CE_TransformComponent* transformComponent = node->m_transform;
+
+    CE_TransformComponent_clearFlags(transformComponent, CE_TransformComponent_Flags_Dirty);
+    node->m_worldX = worldX;
+    node->m_worldY = worldY;
+    node->m_screenSpace = screenSpace;
     
     CE_SceneGraphRenderNode *renderNode = cc_get(&sceneGraph->m_renderList, CE_Id_getUniqueId(entityId));
 
-    if (renderNode != NULL && (renderNode->m_z != transformComponent->m_z)) {
-        // If the Z-index has changed, we need to delete and re-add the render node to maintain correct sorting in the cache
-        cc_erase(&sceneGraph->m_renderList, CE_Id_getUniqueId(entityId));
-        renderNode = NULL;
-    }
-
     if (renderNode == NULL) {
         CE_SceneGraphRenderNode newNode = {
-            .m_x = parentX + transformComponent->m_x,
-            .m_y = parentY + transformComponent->m_y,
+            .m_x = worldX,
+            .m_y = worldY,
             .m_z = transformComponent->m_z,
             .m_width = transformComponent->m_width,
-            .m_height = transformComponent->m_height
+            .m_height = transformComponent->m_height,
+            .m_rotation = transformComponent->m_rotation,
+            .m_scale = CE_TransformComponent_getScale(transformComponent),
+            .m_screenSpace = screenSpace
         };
         renderNode = cc_insert(&sceneGraph->m_renderList, CE_Id_getUniqueId(entityId), newNode);
         if (renderNode == NULL) {
@@ -233,25 +313,254 @@ CE_Result UpdateRenderListTraverseFunc(IN CE_ECS_Context* context, IN CE_Id enti
         CE_Debug("Registered Node for Entity: %u with unique id: %u",entityId, CE_Id_getUniqueId(entityId));
     }
     else{
-        renderNode->m_x = parentX + transformComponent->m_x;
-        renderNode->m_y = parentY + transformComponent->m_y;
-        // Note that Z is not updated since any changes will delete the render node.
+        renderNode->m_x = worldX;
+        renderNode->m_y = worldY;
+        renderNode->m_z = transformComponent->m_z;
         renderNode->m_width = transformComponent->m_width;
         renderNode->m_height = transformComponent->m_height;
+        renderNode->m_rotation = transformComponent->m_rotation;
+        renderNode->m_scale = CE_TransformComponent_getScale(transformComponent);
+        renderNode->m_screenSpace = screenSpace;
+    }
+
+    // Only world space nodes with a size can be found by region queries
+    if (screenSpace || transformComponent->m_width == 0 || transformComponent->m_height == 0) {
+        CE_SpatialHash_remove(&sceneGraph->m_spatialHash, entityId);
+    } else if (CE_SpatialHash_update(&sceneGraph->m_spatialHash, entityId, worldX, worldY, transformComponent->m_width, transformComponent->m_height, errorCode) != CE_OK) {
+        CE_Error("Failed to index entity %u in the scene graph spatial hash", entityId);
+        return CE_ERROR;
     }
     
     return CE_OK;
 }
 
+// Whether a node draws anything of its own, nodes without a size or overflow are only there to place their children
+static inline bool CE_Engine_SceneGraph_hasDrawArea(IN const CE_TransformComponent* transform)
+{
+    return (transform->m_width > 0 && transform->m_height > 0) || CE_TransformComponent_hasOverflow(transform);
+}
+
+// Area a node with a size draws to when placed at x, y. Rotated and scaled nodes are drawn centered on their size,
+// the rotated size is never more than the width plus the height and a pixel covers the rounding of the bitmap cache
+static CE_DirtyRect CE_Engine_SceneGraph_getSizeRect(IN const CE_TransformComponent* transform, IN int32_t x, IN int32_t y)
+{
+    const uint32_t scale = CE_TransformComponent_getScale(transform);
+    if (transform->m_rotation == 0 && scale == CE_TRANSFORM_SCALE_ONE) {
+        return (CE_DirtyRect){ .m_minX = x, .m_minY = y, .m_maxX = x + transform->m_width, .m_maxY = y + transform->m_height };
+    }
+
+    int32_t width = transform->m_rotation == 0 ? transform->m_width : transform->m_width + transform->m_height;
+    int32_t height = transform->m_rotation == 0 ? transform->m_height : width;
+    width = (int32_t)(((uint32_t)width * scale + CE_TRANSFORM_SCALE_ONE - 1) / CE_TRANSFORM_SCALE_ONE);
+    height = (int32_t)(((uint32_t)height * scale + CE_TRANSFORM_SCALE_ONE - 1) / CE_TRANSFORM_SCALE_ONE);
+    const int32_t minX = x + (transform->m_width - width) / 2 - 1;
+    const int32_t minY = y + (transform->m_height - height) / 2 - 1;
+    return (CE_DirtyRect){ .m_minX = minX, .m_minY = minY, .m_maxX = minX + width + 2, .m_maxY = minY + height + 2 };
+}
+
+// Everything a node draws when placed at x, y, its size and the overflow around it. The node must have a draw area
+static CE_DirtyRect CE_Engine_SceneGraph_getDrawRect(IN const CE_TransformComponent* transform, IN int32_t x, IN int32_t y)
+{
+    const CE_DirtyRect overflow = { .m_minX = x + transform->m_overflowMinX, .m_minY = y + transform->m_overflowMinY,
+        .m_maxX = x + transform->m_overflowMaxX, .m_maxY = y + transform->m_overflowMaxY };
+    if (transform->m_width == 0 || transform->m_height == 0) {
+        return overflow;
+    }
+
+    CE_DirtyRect rect = CE_Engine_SceneGraph_getSizeRect(transform, x, y);
+    if (CE_TransformComponent_hasOverflow(transform)) {
+        rect.m_minX = overflow.m_minX < rect.m_minX ? overflow.m_minX : rect.m_minX;
+        rect.m_minY = overflow.m_minY < rect.m_minY ? overflow.m_minY : rect.m_minY;
+        rect.m_maxX = overflow.m_maxX > rect.m_maxX ? overflow.m_maxX : rect.m_maxX;
+        rect.m_maxY = overflow.m_maxY > rect.m_maxY ? overflow.m_maxY : rect.m_maxY;
+    }
+    return rect;
+}
+
+// Start the subtree bounds of a placed node with its own rectangle on screen
+
+static void CE_Engine_SceneGraph_initNodeBounds(INOUT CE_SceneGraphHierarchyNode* node, IN int32_t drawOffsetX, IN int32_t drawOffsetY)
+{
+    const CE_TransformComponent *transform = node->m_transform;
+    if (!CE_Engine_SceneGraph_hasDrawArea(transform)) {
+        node->m_boundsMinX = INT32_MAX;
+        node->m_boundsMinY = INT32_MAX;
+        node->m_boundsMaxX = INT32_MIN;
+        node->m_boundsMaxY = INT32_MIN;
+        return;
+    }
+
+    const CE_DirtyRect rect = CE_Engine_SceneGraph_getDrawRect(transform,
+        node->m_worldX + (node->m_screenSpace ? 0 : drawOffsetX), node->m_worldY + (node->m_screenSpace ? 0 : drawOffsetY));
+    node->m_boundsMinX = rect.m_minX;
+    node->m_boundsMinY = rect.m_minY;
+    node->m_boundsMaxX = rect.m_maxX;
+    node->m_boundsMaxY = rect.m_maxY;
+}
+
+// Whether bounds overlap the view, empty bounds never do
+static inline bool CE_Engine_SceneGraph_boundsInView(IN int32_t minX, IN int32_t minY, IN int32_t maxX, IN int32_t maxY, IN int32_t viewWidth, IN int32_t viewHeight)
+{
+    return minX < viewWidth && maxX > 0 && minY < viewHeight && maxY > 0;
+}
+
+// Sort key of a placed node, signed values are biased so they order correctly as unsigned
+static uint16_t CE_Engine_SceneGraph_getSortKey(IN const CE_SceneGraphHierarchyNode* node)
+{
+    int32_t key = node->m_transform->m_z;
+    if (CE_TransformComponent_checkFlags(node->m_transform, CE_TransformComponent_Flags_YZIndex)) {
+        // Sort by where the sprite touches the ground, lower on screen is drawn on top
+        key = (int32_t)node->m_worldY + node->m_transform->m_height;
+        key = key > INT16_MAX ? INT16_MAX : key;
+    }
+    return (uint16_t)((uint16_t)(int16_t)key ^ 0x8000u);
+}
+
+// Stable LSD radix sort of the render queue on its 16-bit key, one pass per byte.
+// A pass is skipped when every key has the same byte, so a flat scene costs only the histograms
+static CE_Result CE_Engine_SceneGraph_sortRenderQueue(INOUT CE_SceneGraphComponent* sceneGraph, CE_ERROR_CODE* errorCode)
+{
+    const size_t count = cc_size(&sceneGraph->m_renderQueue);
+    if (count < 2) {
+        return CE_OK;
+    }
+    if (!cc_resize(&sceneGraph->m_renderQueueScratch, count)) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+
+    uint16_t histogram[2][256] = { 0 };
+    const CE_SceneGraphRenderQueueEntry *entries = cc_first(&sceneGraph->m_renderQueue);
+    for (size_t i = 0; i < count; i++) {
+        histogram[0][entries[i].m_sortKey & 0xFF]++;
+        histogram[1][entries[i].m_sortKey >> 8]++;
+    }
+
+    CE_SceneGraphRenderQueueEntry *source = cc_first(&sceneGraph->m_renderQueue);
+    CE_SceneGraphRenderQueueEntry *destination = cc_first(&sceneGraph->m_renderQueueScratch);
+    for (int pass = 0; pass < 2; pass++) {
+        const int shift = pass * 8;
+        if (histogram[pass][(source[0].m_sortKey >> shift) & 0xFF] == count) {
+            continue; // Every key agrees on this byte
+        }
+
+        // Turn the counts into the first output slot of each bucket
+        uint16_t offset = 0;
+        for (int bucket = 0; bucket < 256; bucket++) {
+            const uint16_t bucketCount = histogram[pass][bucket];
+            histogram[pass][bucket] = offset;
+            offset += bucketCount;
+        }
+        for (size_t i = 0; i < count; i++) {
+            destination[histogram[pass][(source[i].m_sortKey >> shift) & 0xFF]++] = source[i];
+        }
+
+        CE_SceneGraphRenderQueueEntry *swap = source;
+        source = destination;
+        destination = swap;
+    }
+
+    // After an odd number of passes the result is in the scratch buffer
+    if (source != cc_first(&sceneGraph->m_renderQueue)) {
+        memcpy(cc_first(&sceneGraph->m_renderQueue), source, count * sizeof(CE_SceneGraphRenderQueueEntry));
+    }
+    return CE_OK;
+}
+
+void CE_Engine_SceneGraph_GetRenderQueue(INOUT CE_ECS_Context* context, OUT const CE_SceneGraphRenderQueueEntry** entries, OUT size_t* count)
+{
+    CE_SceneGraphComponent* sceneGraph = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_SCENE_GRAPH_COMPONENT);
+    *count = cc_size(&sceneGraph->m_renderQueue);
+    *entries = *count > 0 ? cc_first(&sceneGraph->m_renderQueue) : NULL;
+}
+
+CE_Result CE_Engine_SceneGraph_AddStaticLayerCommands(INOUT CE_ECS_Context* context, CE_ERROR_CODE* errorCode)
+{
+    CE_SceneGraphComponent* sceneGraph = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_SCENE_GRAPH_COMPONENT);
+    for (size_t i = 0; i < CE_ENGINE_STATIC_LAYER_MAX; i++)
+    {
+        const CE_SceneGraphStaticLayer *layer = &sceneGraph->m_staticLayers[i];
+        if (layer->m_entityId == CE_INVALID_ID || !layer->m_visible)
+        {
+            continue;
+        }
+        if (CE_RenderCommands_AddBitmap(context, layer->m_layer, layer->m_bitmap, (int)layer->m_drawX, (int)layer->m_drawY, layer->m_width, layer->m_height, CE_DRAW_FLIP_NONE, CE_DRAW_MODE_COPY, errorCode) != CE_OK)
+        {
+            return CE_ERROR;
+        }
+    }
+    return CE_OK;
+}
+
 CE_Result CE_Engine_SceneGraph_DeleteRenderNode(IN CE_ECS_Context* context, IN CE_Id entityId)
 {
     CE_SceneGraphComponent* sceneGraph = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_SCENE_GRAPH_COMPONENT);
+    if (sceneGraph->m_rootEntityId == CE_INVALID_ID) {
+        return CE_OK; // Scene is unloaded or being reset, the render list was already cleared
+    }
+    CE_SpatialHash_remove(&sceneGraph->m_spatialHash, entityId);
     cc_erase(&sceneGraph->m_renderList, CE_Id_getUniqueId(entityId)); // Cannot fail, we don't care if its been deleted already since it will be readded on next rebuild
     CE_Debug("Deleted render node for Entity: %u with unique id: %u",entityId, CE_Id_getUniqueId(entityId));
     sceneGraph->m_needsRedraw = true; // Mark dirty to ensure the render node is removed from the cache on the next redraw
+    sceneGraph->m_hierarchyValid = false; // The hierarchy may still point at this transform
+    cc_clear(&sceneGraph->m_renderQueue); // Rebuilt with the hierarchy, never hand out a dead entity in between
     return CE_OK;
 }
 
+// Give a static layer slot back, its bitmap is freed
+static void CE_Engine_SceneGraph_releaseStaticLayer(INOUT CE_ECS_Context* context, INOUT CE_SceneGraphStaticLayer* layer)
+{
+    CE_Display_FreeBitmap(context, layer->m_bitmap);
+    *layer = (CE_SceneGraphStaticLayer){ .m_entityId = CE_INVALID_ID, .m_bitmap = NULL };
+}
+
+// Static layer a node is baked into. Nodes inside a layer belong to it, flags below it are ignored
+static uint8_t CE_Engine_SceneGraph_getStaticLayer(INOUT CE_SceneGraphComponent* sceneGraph, IN const CE_SceneGraphHierarchyNode* node)
+{
+    if (node->m_parentIndex != CE_SCENE_GRAPH_NO_PARENT) {
+        const uint8_t parentLayer = cc_get(&sceneGraph->m_hierarchy, node->m_parentIndex)->m_staticLayer;
+        if (parentLayer != CE_SCENE_GRAPH_NO_STATIC_LAYER) {
+            return parentLayer;
+        }
+    }
+
+    const CE_TransformComponent *transform = node->m_transform;
+    if (!CE_TransformComponent_checkFlags(transform, CE_TransformComponent_Flags_StaticLayer) || transform->m_width == 0 || transform->m_height == 0) {
+        return CE_SCENE_GRAPH_NO_STATIC_LAYER;
+    }
+
+    uint8_t freeSlot = CE_SCENE_GRAPH_NO_STATIC_LAYER;
+    for (uint8_t i = 0; i < CE_ENGINE_STATIC_LAYER_MAX; i++) {
+        CE_SceneGraphStaticLayer *layer = &sceneGraph->m_staticLayers[i];
+        if (layer->m_entityId == node->m_entityId) {
+            layer->m_seen = true;
+            return i;
+        }
+        if (layer->m_entityId == CE_INVALID_ID && freeSlot == CE_SCENE_GRAPH_NO_STATIC_LAYER) {
+            freeSlot = i;
+        }
+    }
+    if (freeSlot == CE_SCENE_GRAPH_NO_STATIC_LAYER) {
+        return CE_SCENE_GRAPH_NO_STATIC_LAYER; // Out of slots, the subtree is drawn normally
+    }
+
+    sceneGraph->m_staticLayers[freeSlot] = (CE_SceneGraphStaticLayer){ .m_entityId = node->m_entityId, .m_bitmap = NULL, .m_baked = false, .m_seen = true };
+    return freeSlot;
+}
+
+// Make sure a static layer about to be baked has a bitmap of the node size
+static CE_Result CE_Engine_SceneGraph_prepareStaticLayer(INOUT CE_ECS_Context* context, INOUT CE_SceneGraphStaticLayer* layer, IN const CE_TransformComponent* transform, CE_ERROR_CODE* errorCode)
+{
+    if (layer->m_bitmap != NULL && layer->m_width == transform->m_width && layer->m_height == transform->m_height) {
+        return CE_OK;
+    }
+    CE_Display_FreeBitmap(context, layer->m_bitmap);
+    layer->m_bitmap = NULL;
+    layer->m_width = transform->m_width;
+    layer->m_height = transform->m_height;
+    return CE_Display_NewBitmap(context, transform->m_width, transform->m_height, &layer->m_bitmap, errorCode);
+}
+
 CE_Result CE_Engine_SceneGraph_UpdateRenderList(INOUT CE_ECS_Context* context, CE_ERROR_CODE* errorCode)
 {
     CE_SceneGraphComponent* sceneGraph = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_SCENE_GRAPH_COMPONENT);
@@ -262,12 +571,224 @@ CE_Result CE_Engine_SceneGraph_UpdateRenderList(INOUT CE_ECS_Context* context, C
         return CE_OK;
     }
 
-    // Traverse the scene graph and update the cache
-    if (CE_Engine_SceneGraph_Traverse(context, sceneGraph->m_rootEntityId, UpdateRenderListTraverseFunc, NULL, errorCode) != CE_OK)
+    const CE_SceneGraphHierarchyNode *nodes = NULL;
+    size_t nodeCount = 0;
+    if (CE_Engine_SceneGraph_GetHierarchy(context, &nodes, &nodeCount, errorCode) != CE_OK)
     {
         return CE_ERROR;
     }
 
+    cc_clear(&sceneGraph->m_renderQueue);
+    if (!cc_reserve(&sceneGraph->m_renderQueue, nodeCount))
+    {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+
+    // The draw offset the camera will apply this frame, bounds are kept on screen
+    const CE_CameraComponent *cameraComponent = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_CAMERA_COMPONENT);
+    const int32_t drawOffsetX = cameraComponent->m_shakeX - cameraComponent->m_x;
+    const int32_t drawOffsetY = cameraComponent->m_shakeY - cameraComponent->m_y;
+    const int32_t viewWidth = CE_GetDisplayWidth(context);
+    const int32_t viewHeight = CE_GetDisplayHeight(context);
+    CE_DirtyRegion_SetDrawOffset(context, drawOffsetX, drawOffsetY);
+
+    // Keep the kernel arrays the size of the hierarchy, a rebuild always comes with a full refresh
+    if (cc_size(&sceneGraph->m_localPositions) != nodeCount
+        && (!cc_resize(&sceneGraph->m_localPositions, nodeCount)
+            || !cc_resize(&sceneGraph->m_worldPositions, nodeCount)
+            || !cc_resize(&sceneGraph->m_propagationParents, nodeCount)))
+    {
+        sceneGraph->m_renderListValid = false;
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+    CE_PackedPosition *localPositions = cc_first(&sceneGraph->m_localPositions);
+    CE_PackedPosition *worldPositions = cc_first(&sceneGraph->m_worldPositions);
+    uint16_t *propagationParents = cc_first(&sceneGraph->m_propagationParents);
+
+    // Only dirty transforms have new local values, the other entries are still current
+    for (size_t i = 0; i < nodeCount; i++)
+    {
+        const CE_SceneGraphHierarchyNode *node = cc_get(&sceneGraph->m_hierarchy, i);
+        const CE_TransformComponent *transformComponent = node->m_transform;
+        if (transformComponent == NULL)
+        {
+            CE_Error("Failed to find transform component for entity %u while rebuilding scene graph Z-order cache", node->m_entityId);
+            CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENGINE_SCENE_GRAPH_MISSING_TRANSFORM);
+            sceneGraph->m_renderListValid = false;
+            return CE_ERROR;
+        }
+        if (!sceneGraph->m_renderListValid || CE_TransformComponent_isDirty(transformComponent))
+        {
+            localPositions[i] = CE_PackedPosition_pack(transformComponent->m_x, transformComponent->m_y);
+            propagationParents[i] = (node->m_parentIndex == CE_SCENE_GRAPH_NO_PARENT || CE_TransformComponent_hasFixedPosition(transformComponent))
+                ? CE_TRANSFORM_KERNEL_NO_PARENT : node->m_parentIndex;
+        }
+    }
+
+    // Every world position in one pass, parents are always placed before their children
+    CE_TransformKernel_Propagate(localPositions, propagationParents, worldPositions, nodeCount);
+
+    // A full refresh may come from a change in the tree, nothing baked can be trusted
+    for (size_t i = 0; i < CE_ENGINE_STATIC_LAYER_MAX; i++)
+    {
+        sceneGraph->m_staticLayers[i].m_seen = false;
+        sceneGraph->m_staticLayers[i].m_visible = false;
+        sceneGraph->m_staticLayers[i].m_baked = sceneGraph->m_staticLayers[i].m_baked && sceneGraph->m_renderListValid;
+    }
+
+    // Only the nodes that moved or changed touch their render node, the camera does not affect them
+    for (size_t i = 0; i < nodeCount; i++)
+    {
+        CE_SceneGraphHierarchyNode *node = cc_get(&sceneGraph->m_hierarchy, i);
+        const int16_t worldX = CE_PackedPosition_getX(worldPositions[i]);
+        const int16_t worldY = CE_PackedPosition_getY(worldPositions[i]);
+        const bool isRoot = node->m_parentIndex == CE_SCENE_GRAPH_NO_PARENT;
+        const bool screenSpace = !isRoot
+            && (propagationParents[i] == CE_TRANSFORM_KERNEL_NO_PARENT || cc_get(&sceneGraph->m_hierarchy, node->m_parentIndex)->m_screenSpace);
+
+        // Content changes keep the position, the dirty region needs to know about them
+        node->m_changed = CE_TransformComponent_isDirty(node->m_transform);
+        if (!sceneGraph->m_renderListValid || node->m_changed
+            || worldX != node->m_worldX || worldY != node->m_worldY || screenSpace != node->m_screenSpace)
+        {
+            if (CE_Engine_SceneGraph_updateRenderNode(sceneGraph, node, worldX, worldY, screenSpace, errorCode) != CE_OK)
+            {
+                sceneGraph->m_renderListValid = false;
+                return CE_ERROR;
+            }
+        }
+        CE_Engine_SceneGraph_initNodeBounds(node, drawOffsetX, drawOffsetY);
+
+        // Anything changing inside a static layer bakes it again
+        node->m_staticLayer = CE_Engine_SceneGraph_getStaticLayer(sceneGraph, node);
+        if (node->m_staticLayer != CE_SCENE_GRAPH_NO_STATIC_LAYER && node->m_changed)
+        {
+            sceneGraph->m_staticLayers[node->m_staticLayer].m_baked = false;
+        }
+        if (node->m_staticLayer != CE_SCENE_GRAPH_NO_STATIC_LAYER)
+        {
+            CE_TransformComponent_setFlags(node->m_transform, CE_TransformComponent_Flags_InStaticLayer);
+        }
+        else
+        {
+            CE_TransformComponent_clearFlags(node->m_transform, CE_TransformComponent_Flags_InStaticLayer);
+        }
+    }
+
+    // Layers whose node left the tree or lost the flag
+    for (size_t i = 0; i < CE_ENGINE_STATIC_LAYER_MAX; i++)
+    {
+        if (sceneGraph->m_staticLayers[i].m_entityId != CE_INVALID_ID && !sceneGraph->m_staticLayers[i].m_seen)
+        {
+            CE_Engine_SceneGraph_releaseStaticLayer(context, &sceneGraph->m_staticLayers[i]);
+        }
+    }
+
+    // Backwards, children are merged into their parent before the parent is merged into its own
+    for (size_t i = nodeCount; i > 1; i--)
+    {
+        const CE_SceneGraphHierarchyNode *node = cc_get(&sceneGraph->m_hierarchy, i - 1);
+        CE_SceneGraphHierarchyNode *parentNode = cc_get(&sceneGraph->m_hierarchy, node->m_parentIndex);
+        parentNode->m_boundsMinX = node->m_boundsMinX < parentNode->m_boundsMinX ? node->m_boundsMinX : parentNode->m_boundsMinX;
+        parentNode->m_boundsMinY = node->m_boundsMinY < parentNode->m_boundsMinY ? node->m_boundsMinY : parentNode->m_boundsMinY;
+        parentNode->m_boundsMaxX = node->m_boundsMaxX > parentNode->m_boundsMaxX ? node->m_boundsMaxX : parentNode->m_boundsMaxX;
+        parentNode->m_boundsMaxY = node->m_boundsMaxY > parentNode->m_boundsMaxY ? node->m_boundsMaxY : parentNode->m_boundsMaxY;
+    }
+
+    // Queue what is visible. A subtree whose bounds miss the view is skipped as a whole,
+    // nodes without a size have nothing to cull and stay unless their subtree is gone
+    sceneGraph->m_culledCount = 0;
+    for (size_t i = 0; i < nodeCount; i++)
+    {
+        CE_SceneGraphHierarchyNode *node = cc_get(&sceneGraph->m_hierarchy, i);
+        CE_SceneGraphStaticLayer *layer = node->m_staticLayer != CE_SCENE_GRAPH_NO_STATIC_LAYER ? &sceneGraph->m_staticLayers[node->m_staticLayer] : NULL;
+        const bool isLayerNode = layer != NULL && layer->m_entityId == node->m_entityId;
+
+        // Inside a static layer nodes are not culled or drawn on their own, only baked into the layer bitmap
+        if (layer != NULL && !isLayerNode)
+        {
+            node->m_culled = !layer->m_visible;
+            if (layer->m_visible && !layer->m_baked)
+            {
+                CE_SceneGraphRenderQueueEntry entry = { .m_sortKey = CE_Engine_SceneGraph_getSortKey(node), .m_uniqueId = CE_Id_getUniqueId(node->m_entityId), .m_target = (uint8_t)(node->m_staticLayer + 1) };
+                cc_push(&sceneGraph->m_renderQueue, entry); // Space was reserved above
+                CE_SceneGraphRenderNode *renderNode = cc_get(&sceneGraph->m_renderList, entry.m_uniqueId);
+                if (renderNode != NULL)
+                {
+                    renderNode->m_layer = entry.m_sortKey;
+                }
+            }
+            continue;
+        }
+
+        const bool hasBounds = node->m_boundsMinX <= node->m_boundsMaxX;
+        const bool parentCulled = node->m_parentIndex != CE_SCENE_GRAPH_NO_PARENT && cc_get(&sceneGraph->m_hierarchy, node->m_parentIndex)->m_culled;
+
+        node->m_culled = parentCulled
+            || (hasBounds && !CE_Engine_SceneGraph_boundsInView(node->m_boundsMinX, node->m_boundsMinY, node->m_boundsMaxX, node->m_boundsMaxY, viewWidth, viewHeight));
+        if (node->m_culled)
+        {
+            sceneGraph->m_culledCount++;
+            continue;
+        }
+
+        // The subtree is visible, the node itself may still be off screen
+        const CE_TransformComponent *transform = node->m_transform;
+        if (CE_Engine_SceneGraph_hasDrawArea(transform))
+        {
+            const CE_DirtyRect screenRect = CE_Engine_SceneGraph_getDrawRect(transform,
+                node->m_worldX + (node->m_screenSpace ? 0 : drawOffsetX), node->m_worldY + (node->m_screenSpace ? 0 : drawOffsetY));
+            if (!CE_Engine_SceneGraph_boundsInView(screenRect.m_minX, screenRect.m_minY, screenRect.m_maxX, screenRect.m_maxY, viewWidth, viewHeight))
+            {
+                sceneGraph->m_culledCount++;
+                continue;
+            }
+
+            // Nodes without a draw area are assumed to draw nothing of their own
+            CE_DirtyRegion_TrackNode(context, CE_Id_getUniqueId(node->m_entityId), node->m_changed || (isLayerNode && !layer->m_baked), &screenRect);
+        }
+
+        CE_SceneGraphRenderQueueEntry entry = { .m_sortKey = CE_Engine_SceneGraph_getSortKey(node), .m_uniqueId = CE_Id_getUniqueId(node->m_entityId), .m_target = CE_RENDER_TARGET_SCREEN };
+
+        // The layer node is drawn as its bitmap, and into it with the rest of the layer when it has to be baked
+        if (isLayerNode)
+        {
+            layer->m_visible = true;
+            layer->m_layer = entry.m_sortKey;
+            layer->m_drawX = node->m_worldX - (node->m_screenSpace ? drawOffsetX : 0);
+            layer->m_drawY = node->m_worldY - (node->m_screenSpace ? drawOffsetY : 0);
+            if (layer->m_baked)
+            {
+                continue;
+            }
+            if (CE_Engine_SceneGraph_prepareStaticLayer(context, layer, transform, errorCode) != CE_OK)
+            {
+                return CE_ERROR;
+            }
+            layer->m_baked = true;
+            entry.m_target = (uint8_t)(node->m_staticLayer + 1);
+        }
+
+        cc_push(&sceneGraph->m_renderQueue, entry); // Space was reserved above
+
+        CE_SceneGraphRenderNode *renderNode = cc_get(&sceneGraph->m_renderList, entry.m_uniqueId);
+        if (renderNode != NULL)
+        {
+            renderNode->m_layer = entry.m_sortKey;
+        }
+    }
+
+    // Nodes that were culled or left the tree have to be erased
+    CE_DirtyRegion_EndTracking(context);
+
+    if (CE_Engine_SceneGraph_sortRenderQueue(sceneGraph, errorCode) != CE_OK)
+    {
+        return CE_ERROR;
+    }
+
+    sceneGraph->m_renderListValid = true;
     return CE_OK;
 }
 
@@ -277,9 +798,22 @@ CE_SceneGraphRenderNode *CE_Scene_GetRenderNode(IN CE_ECS_Context* context, IN C
     return cc_get(&sceneGraph->m_renderList, CE_Id_getUniqueId(entityId));
 }
 
-CE_Result ResetSceneTreeTraverseFunc(IN CE_ECS_Context* context, IN CE_Id entityId, IN CE_Id parentId, INOUT void* userData, CE_ERROR_CODE* errorCode)
+size_t CE_Scene_QueryRect(INOUT CE_ECS_Context* context, IN int32_t x, IN int32_t y, IN int32_t width, IN int32_t height, OUT CE_Id results[], IN size_t capacity)
+{
+    CE_SceneGraphComponent* sceneGraph = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_SCENE_GRAPH_COMPONENT);
+    return CE_SpatialHash_queryRect(&sceneGraph->m_spatialHash, x, y, width, height, results, capacity);
+}
+
+size_t CE_Scene_QueryPoint(INOUT CE_ECS_Context* context, IN int32_t x, IN int32_t y, OUT CE_Id results[], IN size_t capacity)
 {
-    return CE_ECS_DestroyEntity(context, entityId, errorCode);
+    CE_SceneGraphComponent* sceneGraph = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_SCENE_GRAPH_COMPONENT);
+    return CE_SpatialHash_queryRect(&sceneGraph->m_spatialHash, x, y, 1, 1, results, capacity);
+}
+
+size_t CE_Scene_QueryRadius(INOUT CE_ECS_Context* context, IN int32_t x, IN int32_t y, IN int32_t radius, OUT CE_Id results[], IN size_t capacity)
+{
+    CE_SceneGraphComponent* sceneGraph = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_SCENE_GRAPH_COMPONENT);
+    return CE_SpatialHash_queryRadius(&sceneGraph->m_spatialHash, x, y, radius, results, capacity);
 }
 
 CE_Result CE_Engine_SceneGraph_Reset(INOUT CE_ECS_Context* context, CE_ERROR_CODE* errorCode)
@@ -291,20 +825,25 @@ CE_Result CE_Engine_SceneGraph_Reset(INOUT CE_ECS_Context* context, CE_ERROR_COD
         return CE_OK; // Nothing to reset
     }
 
-    // Traverse the scene graph and delete all entities
-    if (CE_Engine_SceneGraph_Traverse(context, sceneGraph->m_rootEntityId, ResetSceneTreeTraverseFunc, NULL, errorCode) != CE_OK)
-    {
-        return CE_ERROR;
-    }
-
+    // Drop the whole render cache at once, with no root the transform cleanups below skip their own node
+    const CE_Id rootEntityId = sceneGraph->m_rootEntityId;
     sceneGraph->m_rootEntityId = CE_INVALID_ID;
     sceneGraph->m_needsRedraw = true;
+    cc_clear(&sceneGraph->m_renderList);
+    cc_clear(&sceneGraph->m_renderQueue);
+    cc_clear(&sceneGraph->m_hierarchy);
+    sceneGraph->m_hierarchyValid = false;
+    sceneGraph->m_culledCount = 0;
+    CE_SpatialHash_clear(&sceneGraph->m_spatialHash);
+    for (size_t i = 0; i < CE_ENGINE_STATIC_LAYER_MAX; i++)
+    {
+        CE_Engine_SceneGraph_releaseStaticLayer(context, &sceneGraph->m_staticLayers[i]);
+    }
+    CE_BitmapCache_Flush(context); // Variants would keep the sources of the scene loaded
 
-    if (cc_size(&sceneGraph->m_renderList) != 0) {
-        CE_Error("Scene graph render list was not empty after resetting the scene graph");
-        cc_clear(&sceneGraph->m_renderList);
-
-        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INTERNAL_ERROR);
+    // Delete all entities in one pass
+    if (CE_ECS_DestroySubtree(context, rootEntityId, errorCode) != CE_OK)
+    {
         return CE_ERROR;
     }
 
@@ -9,22 +9,86 @@
 
 #include "ecs/types.h"
 #include "ecs/core/ecs_component.h"
+#include "engine/core/spatial_hash.h"
+#include "engine/core/transform_kernel.h"
 
+// Position is in world space, the camera is applied as a draw offset. Nodes in screen space must cancel that offset when drawn
 typedef struct {
     int16_t m_x;
     int16_t m_y;
     int16_t m_z;
     int16_t m_width;
     int16_t m_height;
+    uint16_t m_layer; // Render queue sort key from the last render list update, draw commands are ordered by it
+    uint16_t m_rotation; // Of the transform, the node draws rotated and scaled around the center of its size
+    uint16_t m_scale;
+    bool m_screenSpace; // Fixed position or below a fixed position node, not moved by the camera
 } CE_SceneGraphRenderNode;
 
-#define CC_CMPR CE_SceneGraphRenderNode, { return val_1.m_z < val_2.m_z ? -1 : val_1.m_z > val_2.m_z; }
+// One entry of the render queue, the queue is rebuilt and sorted every time the render list is updated
+typedef struct CE_SceneGraphRenderQueueEntry {
+    uint16_t m_sortKey; // Z-index, or bottom edge on screen for CE_TransformComponent_Flags_YZIndex, biased so it sorts unsigned
+    CE_ShortId m_uniqueId; // Unique ID of the entity
+    uint8_t m_target; // Where the entity draws, CE_RENDER_TARGET_SCREEN or the bitmap of a static layer being baked
+} CE_SceneGraphRenderQueueEntry;
+
 #include <cc.h>
 
+// Parent index of the root node of the hierarchy
+#define CE_SCENE_GRAPH_NO_PARENT UINT16_MAX
+// Static layer of nodes that are not inside one
+#define CE_SCENE_GRAPH_NO_STATIC_LAYER UINT8_MAX
+
+// Subtree under a CE_TransformComponent_Flags_StaticLayer node, drawn once into a bitmap the size of that node and blitted after.
+// Baked again when any node inside is marked dirty
+typedef struct CE_SceneGraphStaticLayer {
+    CE_Id m_entityId; // Node with the flag, CE_INVALID_ID for a free slot
+    void *m_bitmap; // Platform bitmap, NULL when there is nothing to draw into (host builds)
+    uint16_t m_width;
+    uint16_t m_height;
+    int32_t m_drawX; // Where the bitmap is drawn, the draw offset still applies
+    int32_t m_drawY;
+    uint16_t m_layer; // Render queue sort key of the node
+    bool m_baked; // The bitmap is current, or will be once this frame is submitted
+    bool m_visible; // Not culled in the last render list update
+    bool m_seen; // Still in the hierarchy, slots that are not are released
+} CE_SceneGraphStaticLayer;
+
+typedef struct CE_SceneGraphHierarchyNode {
+    CE_Id m_entityId;
+    struct CE_TransformComponent *m_transform; // Resolved on rebuild, NULL if the entity has no transform
+    uint16_t m_parentIndex; // Index of the parent node in the hierarchy, CE_SCENE_GRAPH_NO_PARENT for the root
+    int16_t m_worldX; // World position, or screen position for screen space nodes. Filled by the render list update
+    int16_t m_worldY;
+    bool m_screenSpace; // Fixed position or below a fixed position node
+    bool m_culled; // The node, or its whole subtree, was outside the view in the last render list update
+    bool m_changed; // The transform was dirty in the last render list update
+    uint8_t m_staticLayer; // Static layer the node is baked into, CE_SCENE_GRAPH_NO_STATIC_LAYER if it is drawn on its own
+    // Screen rectangle covering the node and everything below it in the last render list update, max is exclusive.
+    // Empty (min above max) when nothing in the subtree has a size
+    int32_t m_boundsMinX;
+    int32_t m_boundsMinY;
+    int32_t m_boundsMaxX;
+    int32_t m_boundsMaxY;
+} CE_SceneGraphHierarchyNode;
+
 typedef struct CE_SceneGraphComponent {
     CE_Id m_rootEntityId;
     bool m_needsRedraw; // Indicates that the scene needs to be redrawn, used to avoid unnecessary redraws
-    cc_omap(uint16_t, CE_SceneGraphRenderNode) m_renderList; // Cache entity coordinates for rendering, sorted by Z-order
+    cc_map(uint16_t, CE_SceneGraphRenderNode) m_renderList; // Cache entity coordinates for rendering, indexed by entity unique ID
+    cc_vec(CE_SceneGraphRenderQueueEntry) m_renderQueue; // Draw order, back to front. Equal keys keep the scene tree order
+    cc_vec(CE_SceneGraphRenderQueueEntry) m_renderQueueScratch; // Radix sort buffer, kept to avoid allocating every frame
+    cc_vec(CE_SceneGraphHierarchyNode) m_hierarchy; // Flattened scene tree in breadth-first order, parents always come before their children
+    uint32_t m_hierarchyVersion; // CHILD relationship version the hierarchy was built from
+    bool m_hierarchyValid;
+    bool m_renderListValid; // False when every render node must be recomputed, otherwise only dirty transforms and their subtrees are
+    // Structure of arrays for the transform kernel, indexed like the hierarchy
+    cc_vec(CE_PackedPosition) m_localPositions; // Refreshed from the transforms that are dirty
+    cc_vec(CE_PackedPosition) m_worldPositions;
+    cc_vec(uint16_t) m_propagationParents; // Hierarchy parent index, CE_TRANSFORM_KERNEL_NO_PARENT for the root and fixed positions
+    uint16_t m_culledCount; // Nodes left out of the render queue by the last render list update
+    CE_SpatialHash m_spatialHash; // World space render nodes with a size, kept in sync by the render list update
+    CE_SceneGraphStaticLayer m_staticLayers[CE_ENGINE_STATIC_LAYER_MAX];
 } CE_SceneGraphComponent;
 
 typedef CE_Result (*CE_SceneGraphTraverseCallback)(IN CE_ECS_Context* context, IN CE_Id entityId, IN CE_Id parentId, INOUT void* userData, CE_ERROR_CODE* errorCode);
@@ -35,6 +99,12 @@ CE_Result CE_Engine_SceneGraph_DeleteRenderNode(IN CE_ECS_Context* context, IN C
 CE_Result CE_Engine_SceneGraph_Traverse(INOUT CE_ECS_Context* context, IN CE_Id entityId, IN CE_SceneGraphTraverseCallback callback, INOUT void* userData, CE_ERROR_CODE* errorCode);
 CE_Result CE_Engine_SceneGraph_UpdateRenderList(INOUT CE_ECS_Context* context, CE_ERROR_CODE* errorCode);
 CE_Result CE_Engine_SceneGraph_Reset(INOUT CE_ECS_Context* context, CE_ERROR_CODE* errorCode);
+// Flattened scene tree, rebuilt on access when parent/child relationships changed. Valid until the next relationship change
+CE_Result CE_Engine_SceneGraph_GetHierarchy(INOUT CE_ECS_Context* context, OUT const CE_SceneGraphHierarchyNode** nodes, OUT size_t* count, CE_ERROR_CODE* errorCode);
+// Sorted render queue built by the last render list update, valid until the next one. Nodes outside the view are not in it
+void CE_Engine_SceneGraph_GetRenderQueue(INOUT CE_ECS_Context* context, OUT const CE_SceneGraphRenderQueueEntry** entries, OUT size_t* count);
+// Draw the bitmaps of the visible static layers, called after the render systems recorded their commands
+CE_Result CE_Engine_SceneGraph_AddStaticLayerCommands(INOUT CE_ECS_Context* context, CE_ERROR_CODE* errorCode);
 
 #define CE_Engine_SceneGraph_MarkDirty(contextPtr) do {CE_ECS_AccessGlobalComponent(contextPtr, CE_ENGINE_SCENE_GRAPH_COMPONENT)->m_needsRedraw = true;} while(0)
 #define CE_Engine_SceneGraph_IsDirty(contextPtr) (CE_ECS_AccessGlobalComponent(contextPtr, CE_ENGINE_SCENE_GRAPH_COMPONENT)->m_needsRedraw)
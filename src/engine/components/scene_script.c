@@ -12,15 +12,40 @@ CE_DEFINE_GLOBAL_COMPONENT_INIT(CE_ENGINE_SCENE_SCRIPT_COMPONENT)
     component->m_scriptData = NULL;
     component->m_loadSceneDataFunction = NULL;
     CE_Engine_Scene_Clear(&component->m_activeScene);
+
+    component->m_backgroundState = CE_SCENE_BACKGROUND_LOAD_NONE;
+    component->m_shadowContext = NULL;
+    component->m_pendingScriptData = NULL;
+    component->m_buildStep = 0;
+    CE_Engine_Scene_Clear(&component->m_pendingScene);
     return CE_OK;
 }
 
 CE_DEFINE_GLOBAL_COMPONENT_CLEANUP(CE_ENGINE_SCENE_SCRIPT_COMPONENT)
 {
     // Although the scene may be loaded, since this is a global component we'll let the ECS system destroy the entities and components
+    // A background context is ours though, it borrows the asset cache so it must go before the cache is cleaned up
+    CE_Engine_SceneScript_DestroyShadowContext(component);
     return CE_OK;
 }
 
+void CE_Engine_SceneScript_DestroyShadowContext(INOUT CE_SceneScriptComponent* sceneScriptComp)
+{
+    if (sceneScriptComp->m_shadowContext != NULL) {
+        CE_ERROR_CODE errorCode = CE_ERROR_CODE_NONE;
+        if (CE_ECS_Cleanup(sceneScriptComp->m_shadowContext, &errorCode) != CE_OK) {
+            CE_Error("Failed to clean up background scene context: %s", CE_GetErrorMessage(errorCode));
+        }
+        CE_free(sceneScriptComp->m_shadowContext);
+        sceneScriptComp->m_shadowContext = NULL;
+    }
+
+    sceneScriptComp->m_backgroundState = CE_SCENE_BACKGROUND_LOAD_NONE;
+    sceneScriptComp->m_pendingScriptData = NULL;
+    sceneScriptComp->m_buildStep = 0;
+    CE_Engine_Scene_Clear(&sceneScriptComp->m_pendingScene);
+}
+
 CE_Result CE_Scene_RequestLoad(INOUT struct CE_ECS_Context* context, IN CE_LoadSceneDataFunction loadFunction, OUT_OPT CE_ERROR_CODE* errorCode)
 {
     CE_Debug("Scene Load Request");
@@ -38,6 +63,28 @@ CE_Result CE_Scene_RequestLoad(INOUT struct CE_ECS_Context* context, IN CE_LoadS
     return CE_OK;
 }
 
+CE_Result CE_Scene_RequestBackgroundLoad(INOUT struct CE_ECS_Context* context, IN CE_LoadSceneDataFunction loadFunction, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_Debug("Scene Background Load Request");
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_SCENE_SCRIPT_COMPONENT, sceneScriptComp);
+
+    if (sceneScriptComp->m_state != CE_SCENE_STATE_RUNNING || sceneScriptComp->m_backgroundState != CE_SCENE_BACKGROUND_LOAD_NONE) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENGINE_SCENE_LOAD_IN_PROGRESS);
+        return CE_ERROR;
+    }
+
+    sceneScriptComp->m_loadSceneDataFunction = loadFunction;
+    sceneScriptComp->m_backgroundState = CE_SCENE_BACKGROUND_LOAD_START;
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+bool CE_Scene_IsBackgroundLoading(INOUT struct CE_ECS_Context* context)
+{
+    return CE_ECS_AccessGlobalComponent(context, CE_ENGINE_SCENE_SCRIPT_COMPONENT)->m_backgroundState != CE_SCENE_BACKGROUND_LOAD_NONE;
+}
+
 CE_Result CE_Scene_RequestUnload(INOUT struct CE_ECS_Context* context, OUT_OPT CE_ERROR_CODE* errorCode)
 {
     CE_Debug("Scene Unload Request");
@@ -16,6 +16,16 @@ typedef struct CE_SceneScriptComponent
     CE_LoadSceneDataFunction m_loadSceneDataFunction;
     void *m_scriptData;
     CE_Scene m_activeScene;
+
+    // Background loading
+    CE_SceneBackgroundLoadState m_backgroundState;
+    struct CE_ECS_Context *m_shadowContext; // Holds the next scene while it is built, then the previous one until it is destroyed
+    CE_Scene m_pendingScene;
+    void *m_pendingScriptData;
+    uint16_t m_buildStep;
 } CE_SceneScriptComponent;
 
+/// Private API
+void CE_Engine_SceneScript_DestroyShadowContext(INOUT CE_SceneScriptComponent* sceneScriptComp);
+
 #endif // CORGO_ENGINE_COMPONENTS_SCENE_SCRIPT_H
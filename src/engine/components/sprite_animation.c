@@ -0,0 +1,193 @@
+//
+//  engine/components/sprite_animation.c
+//  Sprite animation component definition.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#include "engine/corgo.h"
+
+CE_DEFINE_COMPONENT_INIT(CE_SPRITE_ANIMATION_COMPONENT)
+{
+    component->m_tablePtr = NULL;
+    component->m_clipCount = 0;
+    component->m_clip = 0;
+    component->m_playing = false;
+    component->m_reverse = false;
+    component->m_flip = CE_DRAW_FLIP_NONE;
+    component->m_frame = 0;
+    component->m_tableIndex = 0;
+    component->m_frameTime = 0.0f;
+    component->m_frameBitmap = NULL;
+    return CE_OK;
+}
+
+CE_DEFINE_COMPONENT_CLEANUP(CE_SPRITE_ANIMATION_COMPONENT)
+{
+    if (component->m_tablePtr)
+    {
+        CE_RELEASE_ASSET(context, CE_ASSET_TYPE_BITMAP_TABLE, component->m_tablePtr);
+        component->m_tablePtr = NULL;
+    }
+    component->m_frameBitmap = NULL;
+    return CE_OK;
+}
+
+CE_DEFINE_COMPONENT_COPY(CE_SPRITE_ANIMATION_COMPONENT)
+{
+    // The copy shares the table, and the frame bitmap that belongs to it
+    if (component->m_tablePtr)
+    {
+        return CE_RETAIN_ASSET(context, CE_ASSET_TYPE_BITMAP_TABLE, component->m_tablePtr);
+    }
+    return CE_OK;
+}
+
+// Show a frame of the current clip, the table is only looked up when the frame drawn changes
+static void CE_SpriteAnimationComponent_setFrame(INOUT CE_ECS_Context* context, INOUT CE_SpriteAnimationComponent* component, IN CE_TransformComponent *transform, IN uint16_t frame, IN bool force)
+{
+    const uint16_t firstFrame = component->m_clip < component->m_clipCount ? component->m_clips[component->m_clip].m_firstFrame : 0;
+    const uint16_t tableIndex = (uint16_t)(firstFrame + frame);
+    component->m_frame = frame;
+    if (!force && tableIndex == component->m_tableIndex)
+    {
+        return;
+    }
+
+    component->m_tableIndex = tableIndex;
+    component->m_frameBitmap = NULL;
+#ifdef CE_BACKEND_PLAYDATE
+    if (component->m_tablePtr)
+    {
+        component->m_frameBitmap = CE_GetPlaydateAPI()->graphics->getTableBitmap(component->m_tablePtr, tableIndex);
+    }
+#endif
+    CE_TransformComponent_markDirty(context, transform);
+}
+
+CE_Result CE_SpriteAnimationComponent_setTable(INOUT CE_ECS_Context* context, INOUT CE_SpriteAnimationComponent* component, IN CE_TransformComponent *transform, IN const char* tableName)
+{
+    if (component->m_tablePtr)
+    {
+        CE_RELEASE_ASSET(context, CE_ASSET_TYPE_BITMAP_TABLE, component->m_tablePtr);
+        component->m_tablePtr = NULL;
+        component->m_frameBitmap = NULL;
+    }
+
+    component->m_tablePtr = CE_CACHE_ASSET(context, CE_ASSET_TYPE_BITMAP_TABLE, tableName, NULL);
+    if (component->m_tablePtr == NULL)
+    {
+        return CE_ERROR;
+    }
+    CE_SpriteAnimationComponent_setFrame(context, component, transform, component->m_frame, true);
+
+    transform->m_width = 0;
+    transform->m_height = 0;
+#ifdef CE_BACKEND_PLAYDATE
+    LCDBitmap *bitmap = CE_GetPlaydateAPI()->graphics->getTableBitmap(component->m_tablePtr, 0);
+    if (bitmap != NULL)
+    {
+        int iwidth, iheight;
+        CE_GetPlaydateAPI()->graphics->getBitmapData(bitmap, &iwidth, &iheight, NULL, NULL, NULL);
+        transform->m_width = (uint16_t)iwidth;
+        transform->m_height = (uint16_t)iheight;
+    }
+#endif
+    return CE_OK;
+}
+
+CE_Result CE_SpriteAnimationComponent_addClip(INOUT CE_SpriteAnimationComponent* component, IN uint16_t firstFrame, IN uint16_t frameCount, IN uint8_t fps, IN CE_SpriteAnimationPlayMode playMode, OUT_OPT uint8_t* clipIndex, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    if (frameCount == 0 || firstFrame + frameCount > UINT16_MAX)
+    {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENGINE_ANIMATION_INVALID_CLIP);
+        return CE_ERROR;
+    }
+    if (component->m_clipCount == CE_ENGINE_SPRITE_ANIMATION_MAX_CLIPS)
+    {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENGINE_ANIMATION_TOO_MANY_CLIPS);
+        return CE_ERROR;
+    }
+
+    component->m_clips[component->m_clipCount] = (CE_SpriteAnimationClip){ .m_firstFrame = firstFrame, .m_frameCount = frameCount, .m_fps = fps, .m_playMode = (uint8_t)playMode };
+    if (clipIndex != NULL)
+    {
+        *clipIndex = component->m_clipCount;
+    }
+    component->m_clipCount++;
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+CE_Result CE_SpriteAnimationComponent_play(INOUT CE_ECS_Context* context, INOUT CE_SpriteAnimationComponent* component, IN CE_TransformComponent *transform, IN uint8_t clipIndex, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    if (clipIndex >= component->m_clipCount)
+    {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENGINE_ANIMATION_INVALID_CLIP);
+        return CE_ERROR;
+    }
+
+    if (!component->m_playing || component->m_clip != clipIndex)
+    {
+        component->m_clip = clipIndex;
+        component->m_playing = true;
+        component->m_reverse = false;
+        component->m_frameTime = 0.0f;
+        CE_SpriteAnimationComponent_setFrame(context, component, transform, 0, component->m_frameBitmap == NULL);
+    }
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+void CE_SpriteAnimationComponent_advance(INOUT CE_ECS_Context* context, INOUT CE_SpriteAnimationComponent* component, IN CE_TransformComponent *transform, IN float deltaTime)
+{
+    if (!component->m_playing || component->m_clip >= component->m_clipCount)
+    {
+        return;
+    }
+    const CE_SpriteAnimationClip *clip = &component->m_clips[component->m_clip];
+    if (clip->m_fps == 0 || clip->m_frameCount < 2)
+    {
+        return;
+    }
+
+    const float frameDuration = 1.0f / (float)clip->m_fps;
+    component->m_frameTime += deltaTime;
+    if (component->m_frameTime < frameDuration)
+    {
+        return;
+    }
+
+    // A long frame skips ahead, the remainder carries over to the next one
+    const uint32_t steps = (uint32_t)(component->m_frameTime / frameDuration);
+    component->m_frameTime -= (float)steps * frameDuration;
+
+    const uint32_t lastFrame = clip->m_frameCount - 1u;
+    uint32_t frame = component->m_frame;
+    switch (clip->m_playMode)
+    {
+    case CE_SPRITE_ANIMATION_ONCE:
+        frame += steps;
+        if (frame >= lastFrame)
+        {
+            frame = lastFrame;
+            component->m_playing = false;
+        }
+        break;
+    case CE_SPRITE_ANIMATION_LOOP:
+        frame = (frame + steps) % clip->m_frameCount;
+        break;
+    case CE_SPRITE_ANIMATION_PING_PONG:
+    {
+        // Position along one forward and back cycle, the end frames are shown once per pass
+        const uint32_t period = 2u * lastFrame;
+        const uint32_t position = ((component->m_reverse ? period - frame : frame) + steps) % period;
+        component->m_reverse = position >= lastFrame;
+        frame = component->m_reverse ? period - position : position;
+        break;
+    }
+    default:
+        break;
+    }
+
+    CE_SpriteAnimationComponent_setFrame(context, component, transform, (uint16_t)frame, false);
+}
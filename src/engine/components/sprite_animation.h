@@ -0,0 +1,97 @@
+//
+//  engine/components/sprite_animation.h
+//  Sprite animation component definition.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#ifndef CORGO_ENGINE_COMPONENTS_SPRITE_ANIMATION_H
+#define CORGO_ENGINE_COMPONENTS_SPRITE_ANIMATION_H
+
+#include "ecs/types.h"
+#include "engine/assets.h"
+
+typedef enum CE_SpriteAnimationPlayMode {
+	CE_SPRITE_ANIMATION_ONCE, // Stops on the last frame
+	CE_SPRITE_ANIMATION_LOOP, // Starts over after the last frame
+	CE_SPRITE_ANIMATION_PING_PONG // Plays forwards then backwards, endlessly
+} CE_SpriteAnimationPlayMode;
+
+// Run of consecutive frames of the bitmap table
+typedef struct CE_SpriteAnimationClip {
+	uint16_t m_firstFrame; // Index in the bitmap table
+	uint16_t m_frameCount;
+	uint8_t m_fps;
+	uint8_t m_playMode; // CE_SpriteAnimationPlayMode
+} CE_SpriteAnimationClip;
+
+//// Sprite Animation Component
+typedef struct CESpriteAnimationComponent {
+	CE_ASSET_PTR(CE_ASSET_TYPE_BITMAP_TABLE) m_tablePtr;
+	CE_SpriteAnimationClip m_clips[CE_ENGINE_SPRITE_ANIMATION_MAX_CLIPS];
+	uint8_t m_clipCount;
+	uint8_t m_clip; // Clip being played
+	bool m_playing;
+	bool m_reverse; // Ping-pong clip on its way back
+	uint8_t m_flip; // CE_DrawFlip
+	uint16_t m_frame; // Frame within the clip
+	uint16_t m_tableIndex; // Frame within the table, first frame of the clip plus m_frame
+	float m_frameTime; // Seconds spent on the current frame
+	const void *m_frameBitmap; // Bitmap at m_tableIndex, looked up only when the frame changes
+} CE_SpriteAnimationComponent;
+
+typedef struct CE_TransformComponent CE_TransformComponent;
+
+// Helpers
+/**
+ * @brief Set the bitmap table the clips index into and update the bounds from its first frame.
+ * All frames of a table are expected to have the same size.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in,out] component The sprite animation component to update.
+ * @param[in] transform The transform component to update bounds on.
+ * @param[in] tableName The name of the bitmap table to set.
+ *
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+CE_Result CE_SpriteAnimationComponent_setTable(INOUT CE_ECS_Context* context, INOUT CE_SpriteAnimationComponent* component, IN CE_TransformComponent *transform, IN const char* tableName);
+
+/**
+ * @brief Define a clip. Clips are numbered in the order they are added.
+ *
+ * @param[in,out] component The sprite animation component to update.
+ * @param[in] firstFrame Index of the first frame in the bitmap table.
+ * @param[in] frameCount Number of frames of the clip, at least 1.
+ * @param[in] fps Frames per second, 0 holds the first frame.
+ * @param[in] playMode What happens after the last frame.
+ * @param[out] clipIndex Optional, receives the index of the clip to play it.
+ * @param[out] errorCode Optional error code.
+ *
+ * @return CE_OK on success, CE_ERROR if the clip is empty or there is no room for it.
+ */
+CE_Result CE_SpriteAnimationComponent_addClip(INOUT CE_SpriteAnimationComponent* component, IN uint16_t firstFrame, IN uint16_t frameCount, IN uint8_t fps, IN CE_SpriteAnimationPlayMode playMode, OUT_OPT uint8_t* clipIndex, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Play a clip from its first frame. Playing the clip that is already playing does nothing.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in,out] component The sprite animation component to update.
+ * @param[in] transform The transform component of the entity, marked dirty when the frame changes.
+ * @param[in] clipIndex The clip to play.
+ * @param[out] errorCode Optional error code.
+ *
+ * @return CE_OK on success, CE_ERROR if the clip does not exist.
+ */
+CE_Result CE_SpriteAnimationComponent_play(INOUT CE_ECS_Context* context, INOUT CE_SpriteAnimationComponent* component, IN CE_TransformComponent *transform, IN uint8_t clipIndex, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Function like macro to pause the animation on the current frame, CE_SpriteAnimationComponent_play starts it again.
+ *
+ * @param[in,out] component The sprite animation component to update.
+ */
+#define CE_SpriteAnimationComponent_stop(component) ((component)->m_playing = false)
+
+/// Private API
+// Move the playing clip forward by the elapsed time, only a frame change touches the bitmap table and the transform
+void CE_SpriteAnimationComponent_advance(INOUT CE_ECS_Context* context, INOUT CE_SpriteAnimationComponent* component, IN CE_TransformComponent *transform, IN float deltaTime);
+
+#endif // CORGO_ENGINE_COMPONENTS_SPRITE_ANIMATION_H
@@ -6,12 +6,25 @@
 
 #include "engine/corgo.h"
 
+#include <stdarg.h>
+#include <string.h>
+
 CE_DEFINE_COMPONENT_INIT(CE_TEXT_LABEL_COMPONENT)
 {
     component->m_staticTextPtr = NULL;
     component->m_fontPtr = NULL;
     component->m_inverted = false;
+    component->m_cached = false;
+    component->m_textLength = 0;
+    component->m_textHash = 0;
+    component->m_cacheBitmap = NULL;
+    component->m_cacheFontPtr = NULL;
+    component->m_cacheTextHash = 0;
+    component->m_cacheWidth = 0;
+    component->m_cacheHeight = 0;
+    component->m_inlineText[0] = '\0';
     cc_init(&component->m_text);
+    cc_init(&component->m_cacheText);
     return CE_OK;
 }
 
@@ -22,7 +35,32 @@ CE_DEFINE_COMPONENT_CLEANUP(CE_TEXT_LABEL_COMPONENT)
         CE_RELEASE_ASSET(context, CE_ASSET_TYPE_FONT, component->m_fontPtr);
         component->m_fontPtr = NULL;
     }
+    CE_Display_FreeBitmap(context, component->m_cacheBitmap);
+    component->m_cacheBitmap = NULL;
     cc_cleanup(&component->m_text);
+    cc_cleanup(&component->m_cacheText);
+    return CE_OK;
+}
+
+CE_DEFINE_COMPONENT_COPY(CE_TEXT_LABEL_COMPONENT)
+{
+    // The memcpy'd text container still points to the source buffer, give the copy its own
+    const size_t textSize = cc_size(&component->m_text);
+    const char *sourceText = textSize > 0 ? cc_first(&component->m_text) : NULL;
+    cc_init(&component->m_text);
+    cc_init(&component->m_cacheText);
+    component->m_cacheBitmap = NULL; // Rasterized again on first draw
+    component->m_cacheFontPtr = NULL;
+    if (sourceText && !cc_push_n(&component->m_text, sourceText, textSize))
+    {
+        return CE_ERROR;
+    }
+
+    if (component->m_fontPtr && CE_RETAIN_ASSET(context, CE_ASSET_TYPE_FONT, component->m_fontPtr) != CE_OK)
+    {
+        cc_cleanup(&component->m_text);
+        return CE_ERROR;
+    }
     return CE_OK;
 }
 
@@ -34,12 +72,66 @@ CE_Result CE_TextLabelComponent_setStaticText(INOUT CE_ECS_Context* context, INO
     return CE_TextLabelComponent_update(context, component, transform);
 }
 
+// FNV-1a, setting the same text again keeps the cached bitmap
+static uint32_t CE_TextLabelComponent_hashText(IN const char* text, IN size_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ (uint8_t)text[i]) * 16777619u;
+    }
+    return hash;
+}
+
 CE_Result CE_TextLabelComponent_update(INOUT CE_ECS_Context* context, INOUT CE_TextLabelComponent* component, IN CE_TransformComponent *transform)
 {
-    CE_Engine_SceneGraph_MarkDirty(context);
+    const char *text = CE_TextLabelComponent_getText(component);
+    const size_t textLength = component->m_staticTextPtr != NULL || cc_size(&component->m_text) == 0 ? strlen(text) : cc_size(&component->m_text);
+    component->m_textLength = (uint16_t)(textLength > UINT16_MAX ? UINT16_MAX : textLength);
+    component->m_textHash = CE_TextLabelComponent_hashText(text, component->m_textLength);
+
+    CE_TransformComponent_markDirty(context, transform);
     return CE_TextLabelComponent_getTextBounds(context, component, &transform->m_width, &transform->m_height);
 }
 
+CE_Result CE_TextLabelComponent_formatText(INOUT CE_ECS_Context* context, INOUT CE_TextLabelComponent* component, IN CE_TransformComponent *transform, IN const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    const int length = vsnprintf(component->m_inlineText, sizeof(component->m_inlineText), format, args);
+    va_end(args);
+    if (length < 0)
+    {
+        CE_Error("Failed to format the text of a text label");
+        return CE_ERROR;
+    }
+
+    cc_clear(&component->m_text);
+    if ((size_t)length >= sizeof(component->m_inlineText))
+    {
+        // Does not fit inline, format it again in scratch memory and copy it over
+        const size_t mark = CE_FrameArena_GetMark(context);
+        char *text = CE_FrameArena_Alloc(context, (size_t)length + 1);
+        if (text == NULL)
+        {
+            return CE_ERROR;
+        }
+        va_start(args, format);
+        vsnprintf(text, (size_t)length + 1, format, args);
+        va_end(args);
+        const bool copied = cc_push_n(&component->m_text, text, (size_t)length) != NULL;
+        CE_FrameArena_Rewind(context, mark);
+        if (!copied)
+        {
+            CE_Error("Failed to store the text of a text label");
+            return CE_ERROR;
+        }
+    }
+
+    component->m_staticTextPtr = NULL;
+    return CE_TextLabelComponent_update(context, component, transform);
+}
+
 CE_Result CE_TextLabelComponent_setFont(INOUT CE_ECS_Context* context, INOUT CE_TextLabelComponent* component, IN CE_TransformComponent *transform, IN const char* fontName)
 {
     // Release old font
@@ -61,7 +153,7 @@ CE_Result CE_TextLabelComponent_setFont(INOUT CE_ECS_Context* context, INOUT CE_
 
 CE_Result CE_TextLabelComponent_getTextBounds(INOUT CE_ECS_Context* context, INOUT CE_TextLabelComponent* component, OUT uint16_t* width, OUT uint16_t* height)
 {
-    if (component->m_fontPtr == NULL || (component->m_staticTextPtr == NULL && cc_size(&component->m_text) == 0))
+    if (component->m_fontPtr == NULL || component->m_textLength == 0)
     {
         *width = 0;
         *height = 0;
@@ -69,10 +161,9 @@ CE_Result CE_TextLabelComponent_getTextBounds(INOUT CE_ECS_Context* context, INO
     }
 
 #ifdef CE_BACKEND_PLAYDATE
-    const char *text = component->m_staticTextPtr != NULL ? component->m_staticTextPtr : cc_first(&component->m_text);
-    const int textLength = (int)(component->m_staticTextPtr != NULL ? strlen(component->m_staticTextPtr) : cc_size(&component->m_text));
+    const char *text = CE_TextLabelComponent_getText(component);
     // The playdate API uses ints for text size
-    *width = (uint16_t)CE_GetPlaydateAPI()->graphics->getTextWidth(component->m_fontPtr, text, textLength, kASCIIEncoding, 0);
+    *width = (uint16_t)CE_GetPlaydateAPI()->graphics->getTextWidth(component->m_fontPtr, text, (int)component->m_textLength, kASCIIEncoding, 0);
     *height = (uint16_t)CE_GetPlaydateAPI()->graphics->getFontHeight(component->m_fontPtr);
 #else
     // Stub implementation for non-Playdate backends
@@ -83,3 +174,59 @@ CE_Result CE_TextLabelComponent_getTextBounds(INOUT CE_ECS_Context* context, INO
     return CE_OK;
 }
 
+void CE_TextLabelComponent_setCached(INOUT CE_ECS_Context* context, INOUT CE_TextLabelComponent* component, IN bool cached)
+{
+    component->m_cached = cached;
+    if (!cached)
+    {
+        CE_Display_FreeBitmap(context, component->m_cacheBitmap);
+        component->m_cacheBitmap = NULL;
+        component->m_cacheFontPtr = NULL;
+        cc_cleanup(&component->m_cacheText);
+    }
+}
+
+// The cached bitmap shows the current text in the current font and size. The hash only rules out most changes quickly
+static bool CE_TextLabelComponent_cacheMatches(IN CE_TextLabelComponent* component, IN uint16_t width, IN uint16_t height)
+{
+    return component->m_cacheBitmap != NULL && component->m_cacheFontPtr == component->m_fontPtr
+        && component->m_cacheWidth == width && component->m_cacheHeight == height
+        && component->m_cacheTextHash == component->m_textHash
+        && cc_size(&component->m_cacheText) == component->m_textLength
+        && (component->m_textLength == 0 || memcmp(cc_first(&component->m_cacheText), CE_TextLabelComponent_getText(component), component->m_textLength) == 0);
+}
+
+CE_Result CE_TextLabelComponent_getCacheBitmap(INOUT CE_ECS_Context* context, INOUT CE_TextLabelComponent* component, IN uint16_t width, IN uint16_t height, OUT const void** bitmap, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    *bitmap = NULL;
+    if (!component->m_cached || width == 0 || height == 0)
+    {
+        return CE_OK;
+    }
+
+    if (CE_TextLabelComponent_cacheMatches(component, width, height))
+    {
+        *bitmap = component->m_cacheBitmap;
+        return CE_OK;
+    }
+
+    CE_Display_FreeBitmap(context, component->m_cacheBitmap);
+    component->m_cacheBitmap = NULL;
+    const char *text = CE_TextLabelComponent_getText(component);
+    cc_clear(&component->m_cacheText);
+    if (component->m_textLength > 0 && !cc_push_n(&component->m_cacheText, text, component->m_textLength))
+    {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+    if (CE_Display_NewTextBitmap(context, component->m_fontPtr, text, component->m_textLength, width, height, &component->m_cacheBitmap, errorCode) != CE_OK)
+    {
+        return CE_ERROR;
+    }
+    component->m_cacheFontPtr = component->m_fontPtr;
+    component->m_cacheTextHash = component->m_textHash;
+    component->m_cacheWidth = width;
+    component->m_cacheHeight = height;
+    *bitmap = component->m_cacheBitmap;
+    return CE_OK;
+}
@@ -13,11 +13,32 @@
 //// Text Label Component
 typedef struct CETextLabelComponent {
 	bool m_inverted;
+	bool m_cached; // Rasterize the text once and blit it, for text that rarely changes
 	char *m_staticTextPtr;
-	cc_str(char) m_text;
+	cc_str(char) m_text; // Dynamic text too long to fit inline, keeps its capacity for the next one
+	char m_inlineText[CE_ENGINE_TEXT_LABEL_INLINE_SIZE]; // Dynamic text, used while m_text is empty
 	CE_ASSET_PTR(CE_ASSET_TYPE_FONT) m_fontPtr;
+	uint16_t m_textLength; // Of the current text, updated by CE_TextLabelComponent_update
+	uint32_t m_textHash;
+	// Rasterized text and what it was made from, drawn again when the text, font or size change
+	void *m_cacheBitmap;
+	const void *m_cacheFontPtr;
+	uint32_t m_cacheTextHash;
+	cc_str(char) m_cacheText; // Copy of the rasterized text, a matching hash alone could be a collision
+	uint16_t m_cacheWidth;
+	uint16_t m_cacheHeight;
 } CE_TextLabelComponent;
 
+/**
+ * @brief Function like macro to get the current text of a text label, its length is m_textLength.
+ *
+ * @param[in] component The text label component.
+ *
+ * @return The static text if set, the dynamic text otherwise.
+ */
+#define CE_TextLabelComponent_getText(component) ((component)->m_staticTextPtr != NULL ? (const char*)(component)->m_staticTextPtr \
+    : cc_size(&(component)->m_text) > 0 ? (const char*)cc_first(&(component)->m_text) : (const char*)(component)->m_inlineText)
+
 typedef struct CE_TransformComponent CE_TransformComponent;
 
 // Helpers
@@ -34,6 +55,31 @@ typedef struct CE_TransformComponent CE_TransformComponent;
  **/
 CE_Result CE_TextLabelComponent_setStaticText(INOUT CE_ECS_Context* context, INOUT CE_TextLabelComponent* component, IN CE_TransformComponent *transform, IN const char* text);
 
+/**
+ * @brief Set the dynamic text of a text label from a printf format and update its bounds. The text is copied,
+ * short text is kept inside the component and setting it does not allocate.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in,out] component The text label component to update.
+ * @param[in] transform The transform component to update bounds on.
+ * @param[in] format The printf format of the text, followed by its arguments.
+ *
+ * @return CE_OK on success, CE_ERROR on failure.
+ **/
+CE_Result CE_TextLabelComponent_formatText(INOUT CE_ECS_Context* context, INOUT CE_TextLabelComponent* component, IN CE_TransformComponent *transform, IN const char* format, ...);
+
+/**
+ * @brief Set the dynamic text of a text label, see CE_TextLabelComponent_formatText.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in,out] component The text label component to update.
+ * @param[in] transform The transform component to update bounds on.
+ * @param[in] text The new text, copied.
+ *
+ * @return CE_OK on success, CE_ERROR on failure.
+ **/
+#define CE_TextLabelComponent_setText(context, component, transform, text) CE_TextLabelComponent_formatText(context, component, transform, "%s", text)
+
 /**
  * @brief Set the font of a text label and update its bounds.
  * 
@@ -59,7 +105,7 @@ CE_Result CE_TextLabelComponent_setFont(INOUT CE_ECS_Context* context, INOUT CE_
 CE_Result CE_TextLabelComponent_getTextBounds(INOUT CE_ECS_Context* context, INOUT CE_TextLabelComponent* component, OUT uint16_t* width, OUT uint16_t* height);
 
 /**
- * @brief Update the text label component. Must be called after manipulating the dynamic text.
+ * @brief Update the text label component. Must be called after manipulating m_text directly.
  * 
  * @param[in,out] context The ECS context.
  * @param[in,out] component The text label component to update.
@@ -69,4 +115,19 @@ CE_Result CE_TextLabelComponent_getTextBounds(INOUT CE_ECS_Context* context, INO
  */
 CE_Result CE_TextLabelComponent_update(INOUT CE_ECS_Context* context, INOUT CE_TextLabelComponent* component, IN CE_TransformComponent *transform);
 
+/**
+ * @brief Keep the text rasterized in a bitmap of the label size, so it costs one blit per frame until it changes.
+ * Worth it for scores and HUD counters, not for text that changes every frame.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in,out] component The text label component to update.
+ * @param[in] cached Whether the text is cached, disabling it frees the bitmap.
+ */
+void CE_TextLabelComponent_setCached(INOUT CE_ECS_Context* context, INOUT CE_TextLabelComponent* component, IN bool cached);
+
+/// Private API
+// Bitmap with the current text for a cached label, rasterized again if the text, font or size changed.
+// NULL when the label is not cached or there are no bitmaps, the text is drawn directly then
+CE_Result CE_TextLabelComponent_getCacheBitmap(INOUT CE_ECS_Context* context, INOUT CE_TextLabelComponent* component, IN uint16_t width, IN uint16_t height, OUT const void** bitmap, OUT_OPT CE_ERROR_CODE* errorCode);
+
 #endif // CORGO_ENGINE_COMPONENTS_TEXT_LABEL_H
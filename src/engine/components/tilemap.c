@@ -0,0 +1,277 @@
+//
+//  engine/components/tilemap.c
+//  Tilemap component definition.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#include "engine/corgo.h"
+
+#include <string.h>
+
+// Chunk bitmaps are dropped, the chunks are drawn again the next time they are visible
+static void CE_TilemapComponent_freeChunks(INOUT CE_ECS_Context* context, INOUT CE_TilemapComponent* component)
+{
+    const size_t chunkCount = (size_t)component->m_chunksX * component->m_chunksY;
+    for (size_t i = 0; i < chunkCount; i++)
+    {
+        if (component->m_chunks[i].m_bitmap != NULL)
+        {
+            CE_Display_FreeBitmap(context, component->m_chunks[i].m_bitmap);
+        }
+    }
+    CE_free(component->m_chunks);
+    component->m_chunks = NULL;
+}
+
+// New chunks for the current size, none of them drawn yet
+static CE_Result CE_TilemapComponent_allocateChunks(INOUT CE_TilemapComponent* component)
+{
+    component->m_chunksX = (uint16_t)((component->m_width + CE_ENGINE_TILEMAP_CHUNK_SIZE - 1) / CE_ENGINE_TILEMAP_CHUNK_SIZE);
+    component->m_chunksY = (uint16_t)((component->m_height + CE_ENGINE_TILEMAP_CHUNK_SIZE - 1) / CE_ENGINE_TILEMAP_CHUNK_SIZE);
+    const size_t chunkCount = (size_t)component->m_chunksX * component->m_chunksY;
+    if (chunkCount == 0)
+    {
+        return CE_OK;
+    }
+
+    component->m_chunks = CE_realloc(NULL, chunkCount * sizeof(CE_TilemapChunk));
+    if (component->m_chunks == NULL)
+    {
+        component->m_chunksX = 0;
+        component->m_chunksY = 0;
+        return CE_ERROR;
+    }
+    for (size_t i = 0; i < chunkCount; i++)
+    {
+        component->m_chunks[i] = (CE_TilemapChunk){ .m_bitmap = NULL, .m_baked = false, .m_dirty = true };
+    }
+    return CE_OK;
+}
+
+CE_DEFINE_COMPONENT_INIT(CE_TILEMAP_COMPONENT)
+{
+    component->m_tilesetPtr = NULL;
+    component->m_tiles = NULL;
+    component->m_chunks = NULL;
+    component->m_width = 0;
+    component->m_height = 0;
+    component->m_chunksX = 0;
+    component->m_chunksY = 0;
+    component->m_tileWidth = 0;
+    component->m_tileHeight = 0;
+    return CE_OK;
+}
+
+CE_DEFINE_COMPONENT_CLEANUP(CE_TILEMAP_COMPONENT)
+{
+    CE_TilemapComponent_freeChunks(context, component);
+    CE_free(component->m_tiles);
+    component->m_tiles = NULL;
+    if (component->m_tilesetPtr)
+    {
+        CE_RELEASE_ASSET(context, CE_ASSET_TYPE_BITMAP_TABLE, component->m_tilesetPtr);
+        component->m_tilesetPtr = NULL;
+    }
+    return CE_OK;
+}
+
+CE_DEFINE_COMPONENT_COPY(CE_TILEMAP_COMPONENT)
+{
+    // The copy shares the tileset but owns its cells and draws its own chunks
+    const size_t tileCount = (size_t)component->m_width * component->m_height;
+    const uint8_t *tiles = component->m_tiles;
+    component->m_tiles = NULL;
+    component->m_chunks = NULL;
+    if (tileCount > 0)
+    {
+        component->m_tiles = CE_realloc(NULL, tileCount);
+        if (component->m_tiles == NULL || CE_TilemapComponent_allocateChunks(component) != CE_OK)
+        {
+            CE_free(component->m_tiles);
+            component->m_tiles = NULL;
+            component->m_width = 0;
+            component->m_height = 0;
+            component->m_tilesetPtr = NULL;
+            return CE_ERROR;
+        }
+        memcpy(component->m_tiles, tiles, tileCount);
+    }
+
+    if (component->m_tilesetPtr)
+    {
+        return CE_RETAIN_ASSET(context, CE_ASSET_TYPE_BITMAP_TABLE, component->m_tilesetPtr);
+    }
+    return CE_OK;
+}
+
+// Chunks are redrawn by the renderer, which does not run for a baked static layer. Its transform has to bake the layer again
+static void CE_TilemapComponent_markStaticLayerDirty(INOUT CE_ECS_Context* context, INOUT CE_TransformComponent* transform)
+{
+    if (CE_TransformComponent_checkFlags(transform, CE_TransformComponent_Flags_InStaticLayer))
+    {
+        CE_TransformComponent_markDirty(context, transform);
+    }
+}
+
+// Every chunk is drawn again, its old bitmap is reused
+static void CE_TilemapComponent_markAllDirty(INOUT CE_ECS_Context* context, INOUT CE_TilemapComponent* component, INOUT CE_TransformComponent* transform)
+{
+    const size_t chunkCount = (size_t)component->m_chunksX * component->m_chunksY;
+    for (size_t i = 0; i < chunkCount; i++)
+    {
+        component->m_chunks[i].m_dirty = true;
+    }
+    CE_Engine_SceneGraph_MarkDirty(context);
+    CE_TilemapComponent_markStaticLayerDirty(context, transform);
+}
+
+CE_Result CE_TilemapComponent_setSize(INOUT CE_ECS_Context* context, INOUT CE_TilemapComponent* component, IN CE_TransformComponent *transform, IN uint16_t width, IN uint16_t height, IN uint8_t tileWidth, IN uint8_t tileHeight, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_TilemapComponent_freeChunks(context, component);
+    CE_free(component->m_tiles);
+    component->m_tiles = NULL;
+    component->m_width = 0;
+    component->m_height = 0;
+    component->m_chunksX = 0;
+    component->m_chunksY = 0;
+    component->m_tileWidth = tileWidth;
+    component->m_tileHeight = tileHeight;
+    transform->m_width = 0;
+    transform->m_height = 0;
+    CE_TransformComponent_markDirty(context, transform);
+
+    const size_t tileCount = (size_t)width * height;
+    if (tileCount > 0)
+    {
+        component->m_tiles = CE_realloc(NULL, tileCount);
+        if (component->m_tiles == NULL)
+        {
+            CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+            return CE_ERROR;
+        }
+        memset(component->m_tiles, CE_TILEMAP_EMPTY_TILE, tileCount);
+    }
+    component->m_width = width;
+    component->m_height = height;
+    if (CE_TilemapComponent_allocateChunks(component) != CE_OK)
+    {
+        CE_free(component->m_tiles);
+        component->m_tiles = NULL;
+        component->m_width = 0;
+        component->m_height = 0;
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+
+    // One render node for the whole map, culling and the dirty region see it as one large bitmap
+    const uint32_t pixelWidth = (uint32_t)width * tileWidth;
+    const uint32_t pixelHeight = (uint32_t)height * tileHeight;
+    transform->m_width = (uint16_t)(pixelWidth > UINT16_MAX ? UINT16_MAX : pixelWidth);
+    transform->m_height = (uint16_t)(pixelHeight > UINT16_MAX ? UINT16_MAX : pixelHeight);
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+CE_Result CE_TilemapComponent_setTileset(INOUT CE_ECS_Context* context, INOUT CE_TilemapComponent* component, INOUT CE_TransformComponent* transform, IN const char* tilesetName)
+{
+    if (component->m_tilesetPtr)
+    {
+        CE_RELEASE_ASSET(context, CE_ASSET_TYPE_BITMAP_TABLE, component->m_tilesetPtr);
+        component->m_tilesetPtr = NULL;
+    }
+    CE_TilemapComponent_markAllDirty(context, component, transform);
+
+    component->m_tilesetPtr = CE_CACHE_ASSET(context, CE_ASSET_TYPE_BITMAP_TABLE, tilesetName, NULL);
+    if (component->m_tilesetPtr == NULL)
+    {
+        return CE_ERROR;
+    }
+    return CE_OK;
+}
+
+CE_Result CE_TilemapComponent_setTile(INOUT CE_ECS_Context* context, INOUT CE_TilemapComponent* component, INOUT CE_TransformComponent* transform, IN uint16_t x, IN uint16_t y, IN uint8_t tile, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    if (x >= component->m_width || y >= component->m_height)
+    {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENGINE_TILEMAP_OUT_OF_BOUNDS);
+        return CE_ERROR;
+    }
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    uint8_t *cell = &CE_TilemapComponent_getTile(component, x, y);
+    if (*cell == tile)
+    {
+        return CE_OK;
+    }
+    *cell = tile;
+
+    // The transform is left alone on screen, the renderer marks only the redrawn chunk in the dirty region
+    const size_t chunkIndex = (size_t)(y / CE_ENGINE_TILEMAP_CHUNK_SIZE) * component->m_chunksX + (size_t)(x / CE_ENGINE_TILEMAP_CHUNK_SIZE);
+    component->m_chunks[chunkIndex].m_dirty = true;
+    CE_Engine_SceneGraph_MarkDirty(context);
+    CE_TilemapComponent_markStaticLayerDirty(context, transform);
+    return CE_OK;
+}
+
+void CE_TilemapComponent_setTiles(INOUT CE_ECS_Context* context, INOUT CE_TilemapComponent* component, INOUT CE_TransformComponent* transform, IN const uint8_t* tiles)
+{
+    const size_t tileCount = (size_t)component->m_width * component->m_height;
+    if (tileCount == 0)
+    {
+        return;
+    }
+    memcpy(component->m_tiles, tiles, tileCount);
+    CE_TilemapComponent_markAllDirty(context, component, transform);
+}
+
+void CE_TilemapComponent_getChunkSize(IN const CE_TilemapComponent* component, IN uint16_t chunkX, IN uint16_t chunkY, OUT int* width, OUT int* height)
+{
+    const int columns = component->m_width - chunkX * CE_ENGINE_TILEMAP_CHUNK_SIZE;
+    const int rows = component->m_height - chunkY * CE_ENGINE_TILEMAP_CHUNK_SIZE;
+    *width = (columns < CE_ENGINE_TILEMAP_CHUNK_SIZE ? columns : CE_ENGINE_TILEMAP_CHUNK_SIZE) * component->m_tileWidth;
+    *height = (rows < CE_ENGINE_TILEMAP_CHUNK_SIZE ? rows : CE_ENGINE_TILEMAP_CHUNK_SIZE) * component->m_tileHeight;
+}
+
+CE_Result CE_TilemapComponent_bakeChunk(INOUT CE_ECS_Context* context, INOUT CE_TilemapComponent* component, IN uint16_t chunkX, IN uint16_t chunkY, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_TilemapChunk *chunk = &component->m_chunks[(size_t)chunkY * component->m_chunksX + chunkX];
+    int width, height;
+    CE_TilemapComponent_getChunkSize(component, chunkX, chunkY, &width, &height);
+    if (!chunk->m_baked && CE_Display_NewBitmap(context, width, height, &chunk->m_bitmap, errorCode) != CE_OK)
+    {
+        return CE_ERROR;
+    }
+
+#ifdef CE_BACKEND_PLAYDATE
+    if (chunk->m_bitmap != NULL)
+    {
+        PlaydateAPI* pd = CE_GetPlaydateAPI();
+        const int firstColumn = chunkX * CE_ENGINE_TILEMAP_CHUNK_SIZE;
+        const int firstRow = chunkY * CE_ENGINE_TILEMAP_CHUNK_SIZE;
+        const int columns = width / component->m_tileWidth;
+        const int rows = height / component->m_tileHeight;
+        CE_Display_BeginBitmapDraw(context, chunk->m_bitmap, 0, 0);
+        for (int row = 0; row < rows && component->m_tilesetPtr != NULL; row++)
+        {
+            const uint8_t *tiles = &CE_TilemapComponent_getTile(component, firstColumn, firstRow + row);
+            for (int column = 0; column < columns; column++)
+            {
+                if (tiles[column] == CE_TILEMAP_EMPTY_TILE)
+                {
+                    continue;
+                }
+                LCDBitmap *tile = pd->graphics->getTableBitmap(component->m_tilesetPtr, tiles[column] - 1);
+                if (tile != NULL)
+                {
+                    pd->graphics->drawBitmap(tile, column * component->m_tileWidth, row * component->m_tileHeight, kBitmapUnflipped);
+                }
+            }
+        }
+        CE_Display_EndBitmapDraw(context);
+    }
+#endif
+    chunk->m_baked = true;
+    chunk->m_dirty = false;
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
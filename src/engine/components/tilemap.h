@@ -0,0 +1,108 @@
+//
+//  engine/components/tilemap.h
+//  Tilemap component definition.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#ifndef CORGO_ENGINE_COMPONENTS_TILEMAP_H
+#define CORGO_ENGINE_COMPONENTS_TILEMAP_H
+
+#include "ecs/types.h"
+#include "engine/assets.h"
+
+// Cell without a tile, any other value is the tileset index plus one
+#define CE_TILEMAP_EMPTY_TILE 0
+
+// Square of CE_ENGINE_TILEMAP_CHUNK_SIZE tiles drawn with one bitmap, smaller on the right and bottom edges
+typedef struct CE_TilemapChunk {
+	void *m_bitmap; // Clear where there are no tiles, NULL on platforms without bitmaps
+	bool m_baked; // Drawn at least once
+	bool m_dirty; // Tiles changed since it was drawn
+} CE_TilemapChunk;
+
+//// Tilemap Component
+typedef struct CETilemapComponent {
+	CE_ASSET_PTR(CE_ASSET_TYPE_BITMAP_TABLE) m_tilesetPtr;
+	uint8_t *m_tiles; // One byte per cell, row major
+	CE_TilemapChunk *m_chunks; // Row major
+	uint16_t m_width; // In tiles
+	uint16_t m_height;
+	uint16_t m_chunksX;
+	uint16_t m_chunksY;
+	uint8_t m_tileWidth; // In pixels, every tile of the tileset has this size
+	uint8_t m_tileHeight;
+} CE_TilemapComponent;
+
+typedef struct CE_TransformComponent CE_TransformComponent;
+
+// Helpers
+/**
+ * @brief Set the size of the map, every cell is emptied. The bounds cover the whole map.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in,out] component The tilemap component to update.
+ * @param[in] transform The transform component to update bounds on.
+ * @param[in] width Number of tile columns.
+ * @param[in] height Number of tile rows.
+ * @param[in] tileWidth Width of a tile in pixels.
+ * @param[in] tileHeight Height of a tile in pixels.
+ * @param[out] errorCode Optional error code.
+ *
+ * @return CE_OK on success, CE_ERROR if the map could not be allocated.
+ */
+CE_Result CE_TilemapComponent_setSize(INOUT CE_ECS_Context* context, INOUT CE_TilemapComponent* component, IN CE_TransformComponent *transform, IN uint16_t width, IN uint16_t height, IN uint8_t tileWidth, IN uint8_t tileHeight, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Set the bitmap table the tiles index into, the whole map is drawn again.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in,out] component The tilemap component to update.
+ * @param[in,out] transform The transform component of the map, marked dirty when the map is baked into a static layer.
+ * @param[in] tilesetName The name of the bitmap table to set.
+ *
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+CE_Result CE_TilemapComponent_setTileset(INOUT CE_ECS_Context* context, INOUT CE_TilemapComponent* component, INOUT CE_TransformComponent* transform, IN const char* tilesetName);
+
+/**
+ * @brief Change one cell. Only the chunk holding it is drawn again, and only if the tile is different.
+ * Inside a static layer the whole layer is baked again.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in,out] component The tilemap component to update.
+ * @param[in,out] transform The transform component of the map, marked dirty when the map is baked into a static layer.
+ * @param[in] x Column of the cell.
+ * @param[in] y Row of the cell.
+ * @param[in] tile CE_TILEMAP_EMPTY_TILE or the tileset index plus one.
+ * @param[out] errorCode Optional error code.
+ *
+ * @return CE_OK on success, CE_ERROR if the cell is outside of the map.
+ */
+CE_Result CE_TilemapComponent_setTile(INOUT CE_ECS_Context* context, INOUT CE_TilemapComponent* component, INOUT CE_TransformComponent* transform, IN uint16_t x, IN uint16_t y, IN uint8_t tile, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Replace every cell at once, for maps loaded from data.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in,out] component The tilemap component to update.
+ * @param[in,out] transform The transform component of the map, marked dirty when the map is baked into a static layer.
+ * @param[in] tiles Width times height cells, row major.
+ */
+void CE_TilemapComponent_setTiles(INOUT CE_ECS_Context* context, INOUT CE_TilemapComponent* component, INOUT CE_TransformComponent* transform, IN const uint8_t* tiles);
+
+/**
+ * @brief Function like macro to read one cell, the position must be inside of the map.
+ *
+ * @param[in] component The tilemap component.
+ * @param[in] x Column of the cell.
+ * @param[in] y Row of the cell.
+ */
+#define CE_TilemapComponent_getTile(component, x, y) ((component)->m_tiles[(size_t)(y) * (component)->m_width + (size_t)(x)])
+
+/// Private API
+// Size in pixels of a chunk, edge chunks are cut to the map
+void CE_TilemapComponent_getChunkSize(IN const CE_TilemapComponent* component, IN uint16_t chunkX, IN uint16_t chunkY, OUT int* width, OUT int* height);
+// Draw the tiles of a chunk into its bitmap, created the first time
+CE_Result CE_TilemapComponent_bakeChunk(INOUT CE_ECS_Context* context, INOUT CE_TilemapComponent* component, IN uint16_t chunkX, IN uint16_t chunkY, OUT_OPT CE_ERROR_CODE* errorCode);
+
+#endif // CORGO_ENGINE_COMPONENTS_TILEMAP_H
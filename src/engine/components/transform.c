@@ -6,16 +6,7 @@
 
 #include "engine/corgo.h"
 
-CE_DEFINE_COMPONENT_INIT(CE_TRANSFORM_COMPONENT)
-{
-    component->m_x = 0;
-    component->m_y = 0;
-    component->m_z = 0;
-    component->m_width = 0;
-    component->m_height = 0;
-    component->m_flags = CE_TransformComponent_Flags_None;
-    return CE_OK;
-}
+// Transform is a trivial component, new instances are zero filled by storage (origin, no size, no flags)
 
 CE_DEFINE_COMPONENT_CLEANUP(CE_TRANSFORM_COMPONENT)
 {   
@@ -29,10 +20,17 @@ CE_DEFINE_COMPONENT_CLEANUP(CE_TRANSFORM_COMPONENT)
     return CE_OK;
 }
 
+CE_DEFINE_COMPONENT_COPY(CE_TRANSFORM_COMPONENT)
+{
+    // A copy starts detached, it joins the scene graph when it is parented
+    CE_TransformComponent_clearFlags(component, CE_TransformComponent_Flags_InSceneGraph);
+    return CE_OK;
+}
+
 CE_Result CE_TransformComponent_setPosition(INOUT CE_ECS_Context* context, INOUT CE_TransformComponent* component, IN int16_t x, IN int16_t y)
 {
     if (component->m_x != x || component->m_y != y) {
-        CE_Engine_SceneGraph_MarkDirty(context);
+        CE_TransformComponent_markDirty(context, component);
         component->m_x = x;
         component->m_y = y;
     }
@@ -42,9 +40,40 @@ CE_Result CE_TransformComponent_setPosition(INOUT CE_ECS_Context* context, INOUT
 CE_Result CE_TransformComponent_setZIndex(INOUT CE_ECS_Context* context, INOUT CE_TransformComponent* component, IN int16_t z)
 {
     if (component->m_z != z) {
-        CE_Engine_SceneGraph_MarkDirty(context);
+        CE_TransformComponent_markDirty(context, component);
         component->m_z = z;
     }
     return CE_OK;
 }
 
+CE_Result CE_TransformComponent_setRotation(INOUT CE_ECS_Context* context, INOUT CE_TransformComponent* component, IN int32_t degrees)
+{
+    const uint16_t rotation = (uint16_t)(((degrees % 360) + 360) % 360);
+    if (component->m_rotation != rotation) {
+        CE_TransformComponent_markDirty(context, component);
+        component->m_rotation = rotation;
+    }
+    return CE_OK;
+}
+
+CE_Result CE_TransformComponent_setScale(INOUT CE_ECS_Context* context, INOUT CE_TransformComponent* component, IN uint16_t scale)
+{
+    if (CE_TransformComponent_getScale(component) != scale) {
+        CE_TransformComponent_markDirty(context, component);
+        component->m_scale = scale;
+    }
+    return CE_OK;
+}
+
+CE_Result CE_TransformComponent_setOverflow(INOUT CE_ECS_Context* context, INOUT CE_TransformComponent* component, IN int16_t minX, IN int16_t minY, IN int16_t maxX, IN int16_t maxY)
+{
+    if (component->m_overflowMinX != minX || component->m_overflowMinY != minY
+        || component->m_overflowMaxX != maxX || component->m_overflowMaxY != maxY) {
+        CE_TransformComponent_markDirty(context, component);
+        component->m_overflowMinX = minX;
+        component->m_overflowMinY = minY;
+        component->m_overflowMaxX = maxX;
+        component->m_overflowMaxY = maxY;
+    }
+    return CE_OK;
+}
@@ -11,13 +11,18 @@
 
 typedef enum  {
     CE_TransformComponent_Flags_None = 0, // No special behavior
-    CE_TransformComponent_Flags_Dirty = 1 << 0, // Whether the component is dirty and needs to be updated in the scene graph (not currently used)
+    CE_TransformComponent_Flags_Dirty = 1 << 0, // Whether the component is dirty and needs to be updated in the scene graph, cleared by the render list update
     CE_TransformComponent_Flags_InSceneGraph = 1 << 1, // Whether the component is currently in the scene graph
     CE_TransformComponent_Flags_FixedPosition = 1 << 2, // Whether the component has a fixed position and does not inherit from its parent or camera
     CE_TransformComponent_Flags_InheritsZIndex = 1 << 3, // Whether the component inherits Z-index from its parent or camera (not currently used)
-    CE_TransformComponent_Flags_YZIndex = 1 << 4, // Whether the Y coordinate should be used as Z-index for layering (isometric sorting) (not currently used)
+    CE_TransformComponent_Flags_YZIndex = 1 << 4, // Whether the Y coordinate should be used as Z-index for layering (top-down and isometric sorting), the bottom edge on screen replaces the Z-index
+    CE_TransformComponent_Flags_StaticLayer = 1 << 5, // Whether the node and its subtree are baked into one cached bitmap of the node size, for backgrounds and static UI
+    CE_TransformComponent_Flags_InStaticLayer = 1 << 6, // Whether the node was baked into a static layer in the last render list update, content changes must mark the transform dirty to bake it again
 } CE_TransformComponent_Flags;
 
+// Scale of 1 in the 8.8 fixed point scale of the TransformComponent
+#define CE_TRANSFORM_SCALE_ONE 256
+
 //// Transform Component
 typedef struct CE_TransformComponent {
     // Local position
@@ -28,6 +33,16 @@ typedef struct CE_TransformComponent {
     // Size
     uint16_t m_width;
     uint16_t m_height;
+    // Rotation in degrees clockwise and 8.8 fixed point scale of the node's own drawing, around its center.
+    // Children are not affected. A scale of 0 is the same as CE_TRANSFORM_SCALE_ONE so new transforms are not scaled
+    uint16_t m_rotation;
+    uint16_t m_scale;
+    // Area drawn outside of the size, relative to the position. Set by effects that spill out of the node so culling
+    // and the dirty region cover them, empty while min is not below max
+    int16_t m_overflowMinX;
+    int16_t m_overflowMinY;
+    int16_t m_overflowMaxX;
+    int16_t m_overflowMaxY;
     // Flags
     CE_TransformComponent_Flags m_flags;
 } CE_TransformComponent;
@@ -57,6 +72,58 @@ CE_Result CE_TransformComponent_setPosition(INOUT CE_ECS_Context* context, INOUT
  */
 CE_Result CE_TransformComponent_setZIndex(INOUT CE_ECS_Context* context, INOUT CE_TransformComponent* component, IN int16_t z);
 
+/**
+ * @brief Set the rotation of the TransformComponent. Drawn rotations are rounded to CE_ENGINE_BITMAP_CACHE_ANGLE_STEPS.
+ * This must be called to update the value to guarantee the scene graph is updated accordingly.
+ * 
+ * @param context[in,out] The ECS context.
+ * @param component[in,out] The TransformComponent to update.
+ * @param degrees[in] The new rotation in degrees clockwise, wrapped to 0-359.
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+CE_Result CE_TransformComponent_setRotation(INOUT CE_ECS_Context* context, INOUT CE_TransformComponent* component, IN int32_t degrees);
+
+/**
+ * @brief Set the scale of the TransformComponent. Drawn scales are rounded to CE_ENGINE_BITMAP_CACHE_SCALE_STEP.
+ * This must be called to update the value to guarantee the scene graph is updated accordingly.
+ * 
+ * @param context[in,out] The ECS context.
+ * @param component[in,out] The TransformComponent to update.
+ * @param scale[in] The new scale in 8.8 fixed point, CE_TRANSFORM_SCALE_ONE is the original size.
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+CE_Result CE_TransformComponent_setScale(INOUT CE_ECS_Context* context, INOUT CE_TransformComponent* component, IN uint16_t scale);
+
+/**
+ * @brief Set the area the node draws outside of its size, see m_overflowMinX. Marks the transform dirty if it changed.
+ * 
+ * @param context[in,out] The ECS context.
+ * @param component[in,out] The TransformComponent to update.
+ * @param minX[in] Left edge relative to the position.
+ * @param minY[in] Top edge relative to the position.
+ * @param maxX[in] Right edge relative to the position, exclusive. Equal to minX for no overflow.
+ * @param maxY[in] Bottom edge relative to the position, exclusive. Equal to minY for no overflow.
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+CE_Result CE_TransformComponent_setOverflow(INOUT CE_ECS_Context* context, INOUT CE_TransformComponent* component, IN int16_t minX, IN int16_t minY, IN int16_t maxX, IN int16_t maxY);
+
+/**
+ * @brief Function-like macro: Whether the TransformComponent draws outside of its size.
+ * 
+ * @param component[in] Pointer to the TransformComponent.
+ * @return true if the overflow area is not empty.
+ */
+#define CE_TransformComponent_hasOverflow(component) \
+    ((component)->m_overflowMinX < (component)->m_overflowMaxX && (component)->m_overflowMinY < (component)->m_overflowMaxY)
+
+/**
+ * @brief Function-like macro: Scale of the TransformComponent in 8.8 fixed point, 0 reads as CE_TRANSFORM_SCALE_ONE.
+ * 
+ * @param component[in] Pointer to the TransformComponent.
+ * @return The scale.
+ */
+#define CE_TransformComponent_getScale(component) ((component)->m_scale == 0 ? CE_TRANSFORM_SCALE_ONE : (component)->m_scale)
+
 /**
  * @brief Function-like macro: Check if the TransformComponent has the specified flags set.
  * 
@@ -82,6 +149,16 @@ CE_Result CE_TransformComponent_setZIndex(INOUT CE_ECS_Context* context, INOUT C
  */
 #define CE_TransformComponent_clearFlags(component, flags) ((component)->m_flags &= ~(flags))
 
+/**
+ * @brief Function-like macro: Flag the TransformComponent as changed and request a redraw.
+ * Use it after writing the position, Z-index or size directly, the setters already call it.
+ * 
+ * @param context[in,out] The ECS context.
+ * @param component[in,out] Pointer to the TransformComponent that changed.
+ */
+#define CE_TransformComponent_markDirty(context, component) \
+    do { CE_TransformComponent_setFlags(component, CE_TransformComponent_Flags_Dirty); CE_Engine_SceneGraph_MarkDirty(context); } while (0)
+
 /**
  * @brief Function-like macro: Check if the TransformComponent is currently in the scene graph.
  * 
@@ -92,7 +169,7 @@ CE_Result CE_TransformComponent_setZIndex(INOUT CE_ECS_Context* context, INOUT C
 
 /**
  * @brief Function-like macro: Check if the TransformComponent is dirty and needs to be updated in the scene graph.
- * This is currently not used, but it can be used in the future to optimize scene graph updates by only updating components that have changed.
+ * Only dirty transforms and the subtrees below them get their render nodes recomputed.
  * 
  * @param component[in] Pointer to the TransformComponent to check.
  * @return true if the component is dirty, false otherwise.
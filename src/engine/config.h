@@ -26,6 +26,43 @@
 // The default scene to load on startup, only if CE_ENGINE_SET_START_SCENE is not defined
 #define CE_ENGINE_DEFAULT_SCENE SpriteDemo
 
+// Spatial hash cell size in pixels, entities are indexed in every cell they overlap
+#define CE_ENGINE_SPATIAL_HASH_CELL_SIZE 64
+
+// Scratch memory per frame in bytes, reset at the start of every tick
+#define CE_ENGINE_FRAME_ARENA_SIZE (8 * 1024)
+
+// Distinct bitmap, font and draw mode combinations grouped per frame by the render command buffer, at most 255
+#define CE_ENGINE_RENDER_COMMAND_MAX_STATES 32
+
+// Separate rectangles redrawn in one frame, more changes than that redraw the whole screen
+#define CE_ENGINE_DIRTY_RECT_MAX 8
+
+// Shift the previous frame when the camera pans and redraw only the exposed strips, 0 redraws the whole screen instead
+#define CE_ENGINE_ENABLE_SCROLL_BLIT 1
+
+// Characters of dynamic text stored inside a text label component, terminator included. Longer text goes to a separate buffer
+#define CE_ENGINE_TEXT_LABEL_INLINE_SIZE 32
+
+// Clips a sprite animation component can hold
+#define CE_ENGINE_SPRITE_ANIMATION_MAX_CLIPS 8
+
+// Rotated and scaled bitmap variants kept at the same time, and the memory they may use in bytes
+#define CE_ENGINE_BITMAP_CACHE_MAX_ENTRIES 64
+#define CE_ENGINE_BITMAP_CACHE_BUDGET (96 * 1024)
+// Rotations are rounded to this many steps per turn, scales to multiples of this in 1/256
+#define CE_ENGINE_BITMAP_CACHE_ANGLE_STEPS 32
+#define CE_ENGINE_BITMAP_CACHE_SCALE_STEP 32
+
+// Tiles per side of the tilemap chunks, each chunk is baked into one bitmap and drawn with one blit
+#define CE_ENGINE_TILEMAP_CHUNK_SIZE 16
+
+// Most particles one emitter can hold, each takes 25 bytes of pool
+#define CE_ENGINE_PARTICLE_MAX_POOL_SIZE 512
+
+// Static layers baked at the same time, more flagged nodes are drawn normally
+#define CE_ENGINE_STATIC_LAYER_MAX 8
+
 // Default input map size
 #define CE_ENGINE_INPUT_MAP_STACK_SIZE 4
 
@@ -7,9 +7,18 @@
 #include "asset_cache.h"
 #include "engine/corgo.h"
 
+// Resolve the cache that actually holds the assets for a context
+static CE_Engine_AssetCacheComponent *CE_Engine_AssetCache_get(INOUT CE_ECS_Context* context)
+{
+    CE_Engine_AssetCacheComponent *component = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_ASSET_CACHE);
+    return component->m_sharedCache != NULL ? component->m_sharedCache : component;
+}
+
 // Component functions
 CE_DEFINE_GLOBAL_COMPONENT_INIT(CE_ENGINE_ASSET_CACHE)
 {
+    component->m_sharedCache = NULL;
+
     cc_init(&component->m_assetCount);
     if (!cc_reserve(&component->m_assetCount, CE_ENGINE_ASSET_CACHE_INITIAL_SIZE))
     {
@@ -44,7 +53,7 @@ CE_DEFINE_GLOBAL_COMPONENT_CLEANUP(CE_ENGINE_ASSET_CACHE)
 
 void *CE_Engine_CacheAsset(INOUT CE_ECS_Context* context, IN CE_TypeId assetType, IN const char *assetPath, IN_OPT const void *loadParams)
 {
-    CE_Engine_AssetCacheComponent *component = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_ASSET_CACHE);
+    CE_Engine_AssetCacheComponent *component = CE_Engine_AssetCache_get(context);
     if (component == NULL)
     {
         CE_Error("Asset cache is not enabled");
@@ -99,7 +108,7 @@ void *CE_Engine_CacheAsset(INOUT CE_ECS_Context* context, IN CE_TypeId assetType
 
 CE_Result CE_Engine_ReleaseAsset(INOUT CE_ECS_Context* context, IN void *asset)
 {
-    CE_Engine_AssetCacheComponent *component = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_ASSET_CACHE);
+    CE_Engine_AssetCacheComponent *component = CE_Engine_AssetCache_get(context);
     if (component == NULL)
     {
         CE_Error("Asset cache is not enabled");
@@ -144,3 +153,27 @@ CE_Result CE_Engine_ReleaseAsset(INOUT CE_ECS_Context* context, IN void *asset)
     }
 }
 
+CE_Result CE_Engine_RetainAsset(INOUT CE_ECS_Context* context, IN void *asset)
+{
+    CE_Engine_AssetCacheComponent *component = CE_Engine_AssetCache_get(context);
+    if (component == NULL)
+    {
+        CE_Error("Asset cache is not enabled");
+        return CE_ERROR;
+    }
+
+    uint32_t *count = cc_get(&component->m_assetCount, (uintptr_t)asset);
+    if (count == NULL)
+    {
+        CE_Error("Attempted to retain an asset not in cache");
+        return CE_ERROR;
+    }
+
+    (*count)++;
+    return CE_OK;
+}
+
+void CE_Engine_ShareAssetCache(INOUT CE_ECS_Context* context, INOUT CE_ECS_Context* owner)
+{
+    CE_ECS_AccessGlobalComponent(context, CE_ENGINE_ASSET_CACHE)->m_sharedCache = CE_Engine_AssetCache_get(owner);
+}
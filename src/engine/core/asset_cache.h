@@ -18,6 +18,7 @@ typedef struct CE_Engine_AssetCacheAsset {
 typedef struct CE_Engine_AssetCacheComponent {
     cc_map(uintptr_t, uint32_t) m_assetCount; // Cache the number of times an asset is referenced
     cc_map(const char *, CE_Engine_AssetCacheAsset) m_assetData; // Cache the asset's info
+    struct CE_Engine_AssetCacheComponent *m_sharedCache; // When set, all requests go to this cache instead (background scene contexts)
 } CE_Engine_AssetCacheComponent;
 
 /** * @brief Cache an asset in the asset cache.
@@ -42,6 +43,26 @@ void *CE_Engine_CacheAsset(INOUT CE_ECS_Context* context, IN CE_TypeId assetType
  */
 CE_Result CE_Engine_ReleaseAsset(INOUT CE_ECS_Context* context, IN void *asset); 
 
+/**
+ * @brief Take an extra reference to an asset that is already cached.
+ * Used when component data holding an asset pointer is copied, each copy must be released on its own.
+ * 
+ * @param[in,out] context The ECS context.
+ * @param[in] asset Pointer to the cached asset.
+ * @return CE_OK on success, CE_ERROR if the asset is not in the cache.
+ */
+CE_Result CE_Engine_RetainAsset(INOUT CE_ECS_Context* context, IN void *asset);
+
+/**
+ * @brief Make a context use the asset cache of another context.
+ * Assets already loaded by the owner are reused, and new ones stay cached in the owner after the context is gone.
+ * The owner must outlive the context.
+ * 
+ * @param[in,out] context The ECS context that will borrow the cache.
+ * @param[in,out] owner The ECS context that owns the cache.
+ */
+void CE_Engine_ShareAssetCache(INOUT CE_ECS_Context* context, INOUT CE_ECS_Context* owner);
+
 // Shortcuts to cache and release via macros per asset type
 
 #define CE_DEFINE_ASSET_CACHE_LOAD_FUNCTION(type, pointer_type, load_params) \
@@ -56,9 +77,16 @@ CE_Result CE_Engine_ReleaseAsset(INOUT CE_ECS_Context* context, IN void *asset);
         return CE_Engine_ReleaseAsset(context, (void *)asset); \
     }
 
+#define CE_DEFINE_ASSET_CACHE_RETAIN_FUNCTION(type, pointer_type, load_params) \
+    inline CE_Result CE_Engine_RetainAsset_##type(INOUT CE_ECS_Context* context, IN pointer_type *asset) \
+    { \
+        return CE_Engine_RetainAsset(context, (void *)asset); \
+    }
+
 #define CE_DECLARE_ASSET_CACHE_FUNCS(type, pointer_type, load_params) \
     CE_DEFINE_ASSET_CACHE_LOAD_FUNCTION(type, pointer_type, load_params) \
-    CE_DEFINE_ASSET_CACHE_RELEASE_FUNCTION(type, pointer_type, load_params)
+    CE_DEFINE_ASSET_CACHE_RELEASE_FUNCTION(type, pointer_type, load_params) \
+    CE_DEFINE_ASSET_CACHE_RETAIN_FUNCTION(type, pointer_type, load_params)
 
 #define CE_CACHE_ASSET(context, type, path, loadParams) \
     CE_Engine_CacheAsset_##type(context, path, loadParams);
@@ -69,6 +97,9 @@ CE_Result CE_Engine_ReleaseAsset(INOUT CE_ECS_Context* context, IN void *asset);
 #define CE_RELEASE_ASSET(context, type, asset) \
     CE_Engine_ReleaseAsset_##type(context, asset);
 
+#define CE_RETAIN_ASSET(context, type, asset) \
+    CE_Engine_RetainAsset_##type(context, asset)
+
 #define CE_ASSET_LOADER(type, pointer_type, load_params) CE_DECLARE_ASSET_CACHE_FUNCS(type, pointer_type, load_params)
     CE_ASSET_LOADERS(CE_ASSET_LOADER)
 #undef CE_ASSET_LOADER
@@ -0,0 +1,150 @@
+//
+//  engine/core/bitmap_cache.c
+//  Rotated and scaled variants of bitmap assets, rendered once and reused.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#include "engine/corgo.h"
+
+CE_DEFINE_GLOBAL_COMPONENT_INIT(CE_ENGINE_BITMAP_CACHE)
+{
+    for (size_t i = 0; i < CE_ENGINE_BITMAP_CACHE_MAX_ENTRIES; i++) {
+        component->m_entries[i] = (CE_BitmapCacheEntry){ .m_source = NULL, .m_bitmap = NULL };
+    }
+    component->m_bytes = 0;
+    component->m_frame = 0;
+    component->m_hits = 0;
+    component->m_misses = 0;
+    return CE_OK;
+}
+
+// Another entry keeping the same source loaded, NULL if there is none
+static CE_BitmapCacheEntry *CE_BitmapCache_findSource(INOUT CE_BitmapCacheComponent* cache, IN const void* source, IN const CE_BitmapCacheEntry* skip)
+{
+    for (size_t i = 0; i < CE_ENGINE_BITMAP_CACHE_MAX_ENTRIES; i++) {
+        if (cache->m_entries[i].m_source == source && &cache->m_entries[i] != skip) {
+            return &cache->m_entries[i];
+        }
+    }
+    return NULL;
+}
+
+static void CE_BitmapCache_evict(INOUT CE_ECS_Context* context, INOUT CE_BitmapCacheComponent* cache, INOUT CE_BitmapCacheEntry* entry)
+{
+    // The source stays loaded while another variant of it is cached, that one carries its memory now
+    CE_BitmapCacheEntry *sibling = entry->m_sourceBytes != 0 ? CE_BitmapCache_findSource(cache, entry->m_source, entry) : NULL;
+    if (sibling != NULL) {
+        sibling->m_sourceBytes = entry->m_sourceBytes;
+    } else {
+        cache->m_bytes -= entry->m_sourceBytes;
+    }
+
+    CE_Display_FreeBitmap(context, entry->m_bitmap);
+    CE_RELEASE_ASSET(context, CE_ASSET_TYPE_BITMAP, entry->m_source);
+    cache->m_bytes -= entry->m_bytes;
+    *entry = (CE_BitmapCacheEntry){ .m_source = NULL, .m_bitmap = NULL };
+}
+
+static void CE_BitmapCache_evictAll(INOUT CE_ECS_Context* context, INOUT CE_BitmapCacheComponent* cache)
+{
+    for (size_t i = 0; i < CE_ENGINE_BITMAP_CACHE_MAX_ENTRIES; i++) {
+        if (cache->m_entries[i].m_source != NULL) {
+            CE_BitmapCache_evict(context, cache, &cache->m_entries[i]);
+        }
+    }
+}
+
+CE_DEFINE_GLOBAL_COMPONENT_CLEANUP(CE_ENGINE_BITMAP_CACHE)
+{
+    CE_BitmapCache_evictAll(context, component);
+    return CE_OK;
+}
+
+void CE_BitmapCache_Flush(INOUT CE_ECS_Context* context)
+{
+    CE_BitmapCache_evictAll(context, CE_ECS_AccessGlobalComponent(context, CE_ENGINE_BITMAP_CACHE));
+}
+
+// Least recently drawn entry, the ones drawn this frame are still referenced by render commands and never picked
+static CE_BitmapCacheEntry *CE_BitmapCache_findLeastRecent(INOUT CE_BitmapCacheComponent* cache)
+{
+    CE_BitmapCacheEntry *victim = NULL;
+    for (size_t i = 0; i < CE_ENGINE_BITMAP_CACHE_MAX_ENTRIES; i++) {
+        CE_BitmapCacheEntry *entry = &cache->m_entries[i];
+        if (entry->m_source != NULL && entry->m_lastUse != cache->m_frame && (victim == NULL || entry->m_lastUse < victim->m_lastUse)) {
+            victim = entry;
+        }
+    }
+    return victim;
+}
+
+void CE_BitmapCache_Get(INOUT CE_ECS_Context* context, IN CE_ASSET_PTR(CE_ASSET_TYPE_BITMAP) source, IN uint16_t rotation, IN uint16_t scale, OUT const void** bitmap, OUT uint16_t* width, OUT uint16_t* height)
+{
+    *bitmap = source;
+    *width = 0;
+    *height = 0;
+    const uint16_t angleStep = CE_BitmapCache_QuantizeRotation(rotation);
+    const uint16_t quantizedScale = CE_BitmapCache_QuantizeScale(scale);
+    if (source == NULL || (angleStep == 0 && quantizedScale == CE_TRANSFORM_SCALE_ONE)) {
+        return;
+    }
+
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_BITMAP_CACHE, cache);
+    for (size_t i = 0; i < CE_ENGINE_BITMAP_CACHE_MAX_ENTRIES; i++) {
+        CE_BitmapCacheEntry *entry = &cache->m_entries[i];
+        if (entry->m_source == source && entry->m_angleStep == angleStep && entry->m_scale == quantizedScale) {
+            entry->m_lastUse = cache->m_frame;
+            cache->m_hits++;
+            *bitmap = entry->m_bitmap;
+            *width = entry->m_width;
+            *height = entry->m_height;
+            return;
+        }
+    }
+    cache->m_misses++;
+
+    void *variant = NULL;
+    int variantWidth = 0, variantHeight = 0;
+    size_t variantBytes = 0;
+    const float degrees = (float)angleStep * 360.0f / (float)CE_ENGINE_BITMAP_CACHE_ANGLE_STEPS;
+    const float factor = (float)quantizedScale / (float)CE_TRANSFORM_SCALE_ONE;
+    if (CE_Display_NewTransformedBitmap(context, source, degrees, factor, &variant, &variantWidth, &variantHeight, &variantBytes, NULL) != CE_OK || variant == NULL) {
+        return; // Drawn untransformed rather than not at all
+    }
+
+    // Make room, the variants drawn this frame stay even over budget. A source not cached yet is kept loaded from now on
+    const size_t sourceBytes = CE_Display_GetBitmapBytes(context, source);
+    CE_BitmapCacheEntry *victim = NULL;
+    while (cache->m_bytes + variantBytes + (CE_BitmapCache_findSource(cache, source, NULL) == NULL ? sourceBytes : 0) > CE_ENGINE_BITMAP_CACHE_BUDGET
+        && (victim = CE_BitmapCache_findLeastRecent(cache)) != NULL) {
+        CE_BitmapCache_evict(context, cache, victim);
+    }
+    CE_BitmapCacheEntry *slot = NULL;
+    for (size_t i = 0; i < CE_ENGINE_BITMAP_CACHE_MAX_ENTRIES && slot == NULL; i++) {
+        slot = cache->m_entries[i].m_source == NULL ? &cache->m_entries[i] : NULL;
+    }
+    if (slot == NULL && (slot = CE_BitmapCache_findLeastRecent(cache)) != NULL) {
+        CE_BitmapCache_evict(context, cache, slot);
+    }
+    if (slot == NULL || CE_RETAIN_ASSET(context, CE_ASSET_TYPE_BITMAP, source) != CE_OK) {
+        CE_Display_FreeBitmap(context, variant);
+        return;
+    }
+    const bool sourceCached = CE_BitmapCache_findSource(cache, source, NULL) != NULL;
+
+    *slot = (CE_BitmapCacheEntry){
+        .m_source = source,
+        .m_bitmap = variant,
+        .m_bytes = (uint32_t)variantBytes,
+        .m_sourceBytes = sourceCached ? 0 : (uint32_t)sourceBytes,
+        .m_lastUse = cache->m_frame,
+        .m_angleStep = angleStep,
+        .m_scale = quantizedScale,
+        .m_width = (uint16_t)variantWidth,
+        .m_height = (uint16_t)variantHeight
+    };
+    cache->m_bytes += slot->m_bytes + slot->m_sourceBytes;
+    *bitmap = variant;
+    *width = slot->m_width;
+    *height = slot->m_height;
+}
@@ -0,0 +1,66 @@
+//
+//  engine/core/bitmap_cache.h
+//  Rotated and scaled variants of bitmap assets, rendered once and reused.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#ifndef CORGO_ENGINE_CORE_BITMAP_CACHE_H
+#define CORGO_ENGINE_CORE_BITMAP_CACHE_H
+
+#include "ecs/types.h"
+#include "engine/assets.h"
+
+typedef struct CE_BitmapCacheEntry {
+    CE_ASSET_PTR(CE_ASSET_TYPE_BITMAP) m_source; // Retained while the entry lives, NULL for a free entry
+    void *m_bitmap; // The variant
+    uint32_t m_bytes; // Memory of the variant, counted against CE_ENGINE_BITMAP_CACHE_BUDGET
+    uint32_t m_sourceBytes; // Memory of the source kept loaded, charged to one entry per source and 0 on the others
+    uint32_t m_lastUse; // Frame the variant was last drawn
+    uint16_t m_angleStep; // Rotation rounded to CE_ENGINE_BITMAP_CACHE_ANGLE_STEPS
+    uint16_t m_scale; // Rounded to CE_ENGINE_BITMAP_CACHE_SCALE_STEP
+    uint16_t m_width;
+    uint16_t m_height;
+} CE_BitmapCacheEntry;
+
+typedef struct CE_BitmapCacheComponent {
+    CE_BitmapCacheEntry m_entries[CE_ENGINE_BITMAP_CACHE_MAX_ENTRIES];
+    uint32_t m_bytes; // Memory used by all the variants and the sources they keep loaded
+    uint32_t m_frame;
+    uint32_t m_hits; // Since init, to tune the steps and the budget
+    uint32_t m_misses;
+} CE_BitmapCacheComponent;
+
+/**
+ * @brief Bitmap to draw for a bitmap asset rotated and scaled around its center. The variant is rendered on first use,
+ * later requests with the same rounded rotation and scale get the same one. Least recently drawn variants are
+ * freed to stay under CE_ENGINE_BITMAP_CACHE_BUDGET, never the ones drawn this frame. The budget also counts the
+ * sources, each variant keeps its source loaded.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] source The bitmap asset, from the asset cache.
+ * @param[in] rotation Degrees clockwise, 0-359.
+ * @param[in] scale 8.8 fixed point, CE_TRANSFORM_SCALE_ONE is the original size.
+ * @param[out] bitmap Receives the variant, or the source itself when there is nothing to rotate or scale or no variant could be made.
+ * @param[out] width Receives the size of the returned bitmap, 0 if unknown.
+ * @param[out] height Receives the size of the returned bitmap, 0 if unknown.
+ */
+void CE_BitmapCache_Get(INOUT CE_ECS_Context* context, IN CE_ASSET_PTR(CE_ASSET_TYPE_BITMAP) source, IN uint16_t rotation, IN uint16_t scale, OUT const void** bitmap, OUT uint16_t* width, OUT uint16_t* height);
+
+/**
+ * @brief Function-like macros: Rotation and scale the cache actually renders for a requested one.
+ *
+ * @param rotation[in] Degrees clockwise, 0-359.
+ * @param scale[in] 8.8 fixed point scale.
+ * @return The rotation step, 0 to CE_ENGINE_BITMAP_CACHE_ANGLE_STEPS - 1, or the rounded scale, never 0.
+ */
+#define CE_BitmapCache_QuantizeRotation(rotation) ((uint16_t)((((uint32_t)(rotation) * CE_ENGINE_BITMAP_CACHE_ANGLE_STEPS + 180) / 360) % CE_ENGINE_BITMAP_CACHE_ANGLE_STEPS))
+#define CE_BitmapCache_QuantizeScale(scale) ((uint16_t)((scale) < CE_ENGINE_BITMAP_CACHE_SCALE_STEP ? CE_ENGINE_BITMAP_CACHE_SCALE_STEP \
+    : ((uint32_t)(scale) + CE_ENGINE_BITMAP_CACHE_SCALE_STEP / 2) / CE_ENGINE_BITMAP_CACHE_SCALE_STEP * CE_ENGINE_BITMAP_CACHE_SCALE_STEP))
+
+/// Private API
+// Variants drawn from now on belong to a new frame, called at the start of every engine tick
+#define CE_BitmapCache_NextFrame(context) (CE_ECS_AccessGlobalComponent(context, CE_ENGINE_BITMAP_CACHE)->m_frame++)
+// Free every variant and release the sources, for when the scene that drew them is gone. Not while draw commands use them
+void CE_BitmapCache_Flush(INOUT CE_ECS_Context* context);
+
+#endif // CORGO_ENGINE_CORE_BITMAP_CACHE_H
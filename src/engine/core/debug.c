@@ -22,4 +22,13 @@ void CE_Engine_ShowFPSCounter(IN CE_ECS_Context* context, IN bool show)
     }
 }
 
+void CE_Engine_ShowRenderStats(IN CE_ECS_Context* context, IN bool show)
+{
+    CE_Core_GlobalDebugComponent* globalDebug = CE_ECS_AccessGlobalComponent(context, CE_CORE_GLOBAL_DEBUG_COMPONENT);
+    globalDebug->m_showRenderStats = show;
+    if (show) {
+        globalDebug->m_enabled = true;
+    }
+}
+
 #endif // CE_DEBUG_BUILD
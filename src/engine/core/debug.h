@@ -30,6 +30,16 @@ void CE_Engine_SetGlobalDebug(IN CE_ECS_Context* context, IN bool enabled);
  */
 void CE_Engine_ShowFPSCounter(IN CE_ECS_Context* context, IN bool show);
 
+/**
+ * @brief Enable or disable showing how many scene nodes were drawn and culled in the last frame
+ * It will enable the global debug component if it's not already enabled.
+ * 
+ * @param context[in] The ECS context
+ * @param show[in] Whether to show or hide the render stats
+ * @return None
+ */
+void CE_Engine_ShowRenderStats(IN CE_ECS_Context* context, IN bool show);
+
 #endif // CE_DEBUG_BUILD
 
 #endif // CORGO_ENGINE_CORE_DEBUG_H
\ No newline at end of file
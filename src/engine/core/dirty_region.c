@@ -0,0 +1,175 @@
+//
+//  engine/core/dirty_region.c
+//  Screen rectangles that changed since the last frame and must be redrawn.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#include "engine/corgo.h"
+
+CE_DEFINE_GLOBAL_COMPONENT_INIT(CE_ENGINE_DIRTY_REGION)
+{
+    component->m_rectCount = 0;
+    component->m_fullRedraw = true; // Nothing is on screen yet
+    component->m_drawOffsetX = 0;
+    component->m_drawOffsetY = 0;
+    component->m_scrollX = 0;
+    component->m_scrollY = 0;
+    for (size_t i = 0; i < CE_MAX_ENTITIES; i++) {
+        component->m_drawn[i] = false;
+        component->m_tracked[i] = false;
+    }
+    return CE_OK;
+}
+
+CE_DEFINE_GLOBAL_COMPONENT_CLEANUP(CE_ENGINE_DIRTY_REGION)
+{
+    return CE_OK;
+}
+
+static void CE_DirtyRegion_addRect(INOUT CE_ECS_Context* context, INOUT CE_DirtyRegionComponent* region, IN const CE_DirtyRect* rect)
+{
+    if (region->m_fullRedraw) {
+        return;
+    }
+
+    const int32_t width = CE_GetDisplayWidth(context);
+    const int32_t height = CE_GetDisplayHeight(context);
+    const CE_DirtyRect clipped = {
+        .m_minX = rect->m_minX < 0 ? 0 : rect->m_minX,
+        .m_minY = rect->m_minY < 0 ? 0 : rect->m_minY,
+        .m_maxX = rect->m_maxX > width ? width : rect->m_maxX,
+        .m_maxY = rect->m_maxY > height ? height : rect->m_maxY
+    };
+    if (clipped.m_minX >= clipped.m_maxX || clipped.m_minY >= clipped.m_maxY) {
+        return; // Off screen
+    }
+
+    // Grow a rectangle it touches. The result may overlap another one, which only draws that area twice
+    for (uint8_t i = 0; i < region->m_rectCount; i++) {
+        CE_DirtyRect *existing = &region->m_rects[i];
+        if (clipped.m_minX <= existing->m_maxX && clipped.m_maxX >= existing->m_minX
+            && clipped.m_minY <= existing->m_maxY && clipped.m_maxY >= existing->m_minY) {
+            existing->m_minX = clipped.m_minX < existing->m_minX ? clipped.m_minX : existing->m_minX;
+            existing->m_minY = clipped.m_minY < existing->m_minY ? clipped.m_minY : existing->m_minY;
+            existing->m_maxX = clipped.m_maxX > existing->m_maxX ? clipped.m_maxX : existing->m_maxX;
+            existing->m_maxY = clipped.m_maxY > existing->m_maxY ? clipped.m_maxY : existing->m_maxY;
+            return;
+        }
+    }
+
+    if (region->m_rectCount == CE_ENGINE_DIRTY_RECT_MAX) {
+        region->m_fullRedraw = true; // Too scattered, one clear is cheaper
+        return;
+    }
+    region->m_rects[region->m_rectCount++] = clipped;
+}
+
+void CE_DirtyRegion_AddRect(INOUT CE_ECS_Context* context, IN int32_t x, IN int32_t y, IN int32_t width, IN int32_t height)
+{
+    const CE_DirtyRect rect = { .m_minX = x, .m_minY = y, .m_maxX = x + width, .m_maxY = y + height };
+    CE_DirtyRegion_addRect(context, CE_ECS_AccessGlobalComponent(context, CE_ENGINE_DIRTY_REGION), &rect);
+    CE_Engine_SceneGraph_MarkDirty(context);
+}
+
+void CE_DirtyRegion_Invalidate(INOUT CE_ECS_Context* context)
+{
+    CE_ECS_AccessGlobalComponent(context, CE_ENGINE_DIRTY_REGION)->m_fullRedraw = true;
+    CE_Engine_SceneGraph_MarkDirty(context);
+}
+
+// Same rectangle moved with the screen contents
+static CE_DirtyRect CE_DirtyRegion_shiftRect(IN const CE_DirtyRect* rect, IN int32_t deltaX, IN int32_t deltaY)
+{
+    return (CE_DirtyRect){ .m_minX = rect->m_minX + deltaX, .m_minY = rect->m_minY + deltaY, .m_maxX = rect->m_maxX + deltaX, .m_maxY = rect->m_maxY + deltaY };
+}
+
+void CE_DirtyRegion_SetDrawOffset(INOUT CE_ECS_Context* context, IN int32_t x, IN int32_t y)
+{
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_DIRTY_REGION, region);
+    const int32_t deltaX = x - region->m_drawOffsetX;
+    const int32_t deltaY = y - region->m_drawOffsetY;
+    if (deltaX == 0 && deltaY == 0) {
+        return;
+    }
+    region->m_drawOffsetX = x;
+    region->m_drawOffsetY = y;
+
+    const int32_t width = CE_GetDisplayWidth(context);
+    const int32_t height = CE_GetDisplayHeight(context);
+    const int32_t scrollX = region->m_scrollX + deltaX;
+    const int32_t scrollY = region->m_scrollY + deltaY;
+    if (!CE_ENGINE_ENABLE_SCROLL_BLIT || region->m_fullRedraw
+        || scrollX <= -width || scrollX >= width || scrollY <= -height || scrollY >= height) {
+        region->m_fullRedraw = true; // Nothing of the previous frame can be reused
+        return;
+    }
+    region->m_scrollX = scrollX;
+    region->m_scrollY = scrollY;
+
+    // Rectangles added so far may cover drawing done on the previous frame, which moves with it
+    const uint8_t rectCount = region->m_rectCount;
+    for (uint8_t i = 0; i < rectCount; i++) {
+        const CE_DirtyRect shifted = CE_DirtyRegion_shiftRect(&region->m_rects[i], deltaX, deltaY);
+        CE_DirtyRegion_addRect(context, region, &shifted);
+    }
+
+    // What scrolls in was never drawn
+    if (deltaX != 0) {
+        const CE_DirtyRect strip = { .m_minX = deltaX > 0 ? 0 : width + deltaX, .m_minY = 0, .m_maxX = deltaX > 0 ? deltaX : width, .m_maxY = height };
+        CE_DirtyRegion_addRect(context, region, &strip);
+    }
+    if (deltaY != 0) {
+        const CE_DirtyRect strip = { .m_minX = 0, .m_minY = deltaY > 0 ? 0 : height + deltaY, .m_maxX = width, .m_maxY = deltaY > 0 ? deltaY : height };
+        CE_DirtyRegion_addRect(context, region, &strip);
+    }
+
+    // Nodes were drawn where their pixels are now, world nodes that did not move match it and are left alone.
+    // Screen space nodes stay in place and are redrawn over their scrolled copy
+    for (size_t i = 0; i < CE_MAX_ENTITIES; i++) {
+        if (region->m_drawn[i]) {
+            region->m_drawnRects[i] = CE_DirtyRegion_shiftRect(&region->m_drawnRects[i], deltaX, deltaY);
+        }
+    }
+}
+
+void CE_DirtyRegion_TrackNode(INOUT CE_ECS_Context* context, IN CE_ShortId uniqueId, IN bool changed, IN const CE_DirtyRect* rect)
+{
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_DIRTY_REGION, region);
+    CE_DirtyRect *drawnRect = &region->m_drawnRects[uniqueId];
+    region->m_tracked[uniqueId] = true;
+
+    const bool moved = !region->m_drawn[uniqueId]
+        || drawnRect->m_minX != rect->m_minX || drawnRect->m_minY != rect->m_minY
+        || drawnRect->m_maxX != rect->m_maxX || drawnRect->m_maxY != rect->m_maxY;
+    if (!changed && !moved) {
+        return;
+    }
+
+    if (region->m_drawn[uniqueId]) {
+        CE_DirtyRegion_addRect(context, region, drawnRect);
+    }
+    CE_DirtyRegion_addRect(context, region, rect);
+    *drawnRect = *rect;
+    region->m_drawn[uniqueId] = true;
+}
+
+void CE_DirtyRegion_EndTracking(INOUT CE_ECS_Context* context)
+{
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_DIRTY_REGION, region);
+    for (size_t i = 0; i < CE_MAX_ENTITIES; i++) {
+        if (region->m_drawn[i] && !region->m_tracked[i]) {
+            CE_DirtyRegion_addRect(context, region, &region->m_drawnRects[i]);
+            region->m_drawn[i] = false;
+        }
+        region->m_tracked[i] = false;
+    }
+}
+
+void CE_DirtyRegion_Clear(INOUT CE_ECS_Context* context)
+{
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_DIRTY_REGION, region);
+    region->m_rectCount = 0;
+    region->m_fullRedraw = false;
+    region->m_scrollX = 0;
+    region->m_scrollY = 0;
+}
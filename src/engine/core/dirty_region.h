@@ -0,0 +1,63 @@
+//
+//  engine/core/dirty_region.h
+//  Screen rectangles that changed since the last frame and must be redrawn.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#ifndef CORGO_ENGINE_CORE_DIRTY_REGION_H
+#define CORGO_ENGINE_CORE_DIRTY_REGION_H
+
+#include "ecs/types.h"
+
+// Screen rectangle, max is exclusive
+typedef struct CE_DirtyRect {
+    int32_t m_minX;
+    int32_t m_minY;
+    int32_t m_maxX;
+    int32_t m_maxY;
+} CE_DirtyRect;
+
+typedef struct CE_DirtyRegionComponent {
+    CE_DirtyRect m_rects[CE_ENGINE_DIRTY_RECT_MAX]; // To redraw this frame, merged when they overlap
+    uint8_t m_rectCount;
+    bool m_fullRedraw; // The whole screen is redrawn, the rectangles are ignored
+    int32_t m_drawOffsetX; // Draw offset of the last frame, moving the camera moves everything
+    int32_t m_drawOffsetY;
+    int32_t m_scrollX; // Camera delta the previous frame is shifted by before the rectangles are redrawn
+    int32_t m_scrollY;
+    // Per entity unique ID, where each render node was on screen last frame
+    CE_DirtyRect m_drawnRects[CE_MAX_ENTITIES];
+    bool m_drawn[CE_MAX_ENTITIES];
+    bool m_tracked[CE_MAX_ENTITIES]; // Seen by the current render list update
+} CE_DirtyRegionComponent;
+
+/**
+ * @brief Marks a screen rectangle to be redrawn on the next frame, for drawing done outside the render systems.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] x Screen position, the draw offset does not apply.
+ * @param[in] y Screen position, the draw offset does not apply.
+ * @param[in] width Width of the rectangle.
+ * @param[in] height Height of the rectangle.
+ */
+void CE_DirtyRegion_AddRect(INOUT CE_ECS_Context* context, IN int32_t x, IN int32_t y, IN int32_t width, IN int32_t height);
+
+/**
+ * @brief Redraws the whole screen on the next frame.
+ *
+ * @param[in,out] context The ECS context.
+ */
+void CE_DirtyRegion_Invalidate(INOUT CE_ECS_Context* context);
+
+/// Private API, kept up to date by the render list update
+// The previous frame is scrolled by the change of draw offset and the exposed strips are dirty,
+// the whole screen when the change is too large or scroll blit is disabled
+void CE_DirtyRegion_SetDrawOffset(INOUT CE_ECS_Context* context, IN int32_t x, IN int32_t y);
+// A render node that is drawn this frame. Its old and new rectangles are dirty if it moved, resized or changed
+void CE_DirtyRegion_TrackNode(INOUT CE_ECS_Context* context, IN CE_ShortId uniqueId, IN bool changed, IN const CE_DirtyRect* rect);
+// Nodes drawn last frame and not tracked since the previous call are gone, their old rectangles are dirty
+void CE_DirtyRegion_EndTracking(INOUT CE_ECS_Context* context);
+// Forget the rectangles once they are redrawn
+void CE_DirtyRegion_Clear(INOUT CE_ECS_Context* context);
+
+#endif // CORGO_ENGINE_CORE_DIRTY_REGION_H
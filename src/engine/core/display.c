@@ -6,6 +6,8 @@
 
 #include "engine/corgo.h"
 
+#include <string.h>
+
 CE_DEFINE_GLOBAL_COMPONENT_INIT(CE_ENGINE_DISPLAY_COMPONENT)
 {
     component->m_inverted = false;
@@ -13,6 +15,8 @@ CE_DEFINE_GLOBAL_COMPONENT_INIT(CE_ENGINE_DISPLAY_COMPONENT)
     component->m_flipY = false;
     component->m_scale = CE_ENGINE_SCALE_DEFAULT;
     component->m_refreshRate = CE_ENGINE_REFRESH_RATE_DEFAULT;
+    component->m_drawOffsetX = 0;
+    component->m_drawOffsetY = 0;
 
 #ifdef CE_BACKEND_PLAYDATE
     PlaydateAPI* pd = CE_GetPlaydateAPI();
@@ -49,6 +53,7 @@ void CE_Display_SetScale(INOUT CE_ECS_Context* context, IN uint8_t scale)
     displayComp->m_width = pd->display->getWidth();
     displayComp->m_height = pd->display->getHeight();
 #endif
+    CE_DirtyRegion_Invalidate(context);
 }
 
 void CE_Display_SetRefreshRate(INOUT CE_ECS_Context* context, IN uint8_t refreshRate)
@@ -109,3 +114,194 @@ void CE_Display_Clear(INOUT CE_ECS_Context* context)
     pd->graphics->clear(kColorWhite);
 #endif
 }
+
+void CE_Display_ClearRect(INOUT CE_ECS_Context* context, IN int x, IN int y, IN int width, IN int height)
+{
+#ifdef CE_BACKEND_PLAYDATE
+    // Fills are moved by the draw offset, the rectangle is on screen
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_DISPLAY_COMPONENT, displayComp);
+    PlaydateAPI* pd = CE_GetPlaydateAPI();
+    pd->graphics->fillRect(x - displayComp->m_drawOffsetX, y - displayComp->m_drawOffsetY, width, height, kColorWhite);
+#endif
+}
+
+void CE_Display_SetClipRect(INOUT CE_ECS_Context* context, IN int x, IN int y, IN int width, IN int height)
+{
+#ifdef CE_BACKEND_PLAYDATE
+    PlaydateAPI* pd = CE_GetPlaydateAPI();
+    pd->graphics->setScreenClipRect(x, y, width, height);
+#endif
+}
+
+void CE_Display_ClearClipRect(INOUT CE_ECS_Context* context)
+{
+#ifdef CE_BACKEND_PLAYDATE
+    PlaydateAPI* pd = CE_GetPlaydateAPI();
+    pd->graphics->clearClipRect();
+#endif
+}
+
+void CE_Display_MarkUpdatedRows(INOUT CE_ECS_Context* context, IN int start, IN int end)
+{
+#ifdef CE_BACKEND_PLAYDATE
+    PlaydateAPI* pd = CE_GetPlaydateAPI();
+    pd->graphics->markUpdatedRows(start, end);
+#endif
+}
+
+#ifdef CE_BACKEND_PLAYDATE
+// Shift one row of packed pixels, the leftmost pixel is the high bit of the first byte
+static void CE_Display_shiftRow(INOUT uint8_t* row, IN int bytes, IN int x)
+{
+    const int byteShift = (x < 0 ? -x : x) / 8;
+    const int bitShift = (x < 0 ? -x : x) % 8;
+    if (x > 0) {
+        for (int i = bytes - 1; i >= 0; i--) {
+            const int source = i - byteShift;
+            const uint8_t high = source >= 0 ? row[source] : 0;
+            const uint8_t low = source >= 1 ? row[source - 1] : 0;
+            row[i] = (uint8_t)((high >> bitShift) | (bitShift != 0 ? low << (8 - bitShift) : 0));
+        }
+    } else {
+        for (int i = 0; i < bytes; i++) {
+            const int source = i + byteShift;
+            const uint8_t high = source < bytes ? row[source] : 0;
+            const uint8_t low = source + 1 < bytes ? row[source + 1] : 0;
+            row[i] = (uint8_t)((high << bitShift) | (bitShift != 0 ? low >> (8 - bitShift) : 0));
+        }
+    }
+}
+#endif
+
+void CE_Display_ScrollFrame(INOUT CE_ECS_Context* context, IN int x, IN int y)
+{
+#ifdef CE_BACKEND_PLAYDATE
+    // The frame buffer is at native resolution
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_DISPLAY_COMPONENT, displayComp);
+    const int shiftX = x * displayComp->m_scale;
+    const int shiftY = y * displayComp->m_scale;
+    if (shiftX <= -LCD_COLUMNS || shiftX >= LCD_COLUMNS || shiftY <= -LCD_ROWS || shiftY >= LCD_ROWS) {
+        return;
+    }
+
+    PlaydateAPI* pd = CE_GetPlaydateAPI();
+    uint8_t *frame = pd->graphics->getFrame();
+    if (shiftY > 0) {
+        memmove(frame + shiftY * LCD_ROWSIZE, frame, (size_t)(LCD_ROWS - shiftY) * LCD_ROWSIZE);
+    } else if (shiftY < 0) {
+        memmove(frame, frame - shiftY * LCD_ROWSIZE, (size_t)(LCD_ROWS + shiftY) * LCD_ROWSIZE);
+    }
+    if (shiftX != 0) {
+        for (int row = 0; row < LCD_ROWS; row++) {
+            CE_Display_shiftRow(frame + row * LCD_ROWSIZE, LCD_COLUMNS / 8, shiftX);
+        }
+    }
+    pd->graphics->markUpdatedRows(0, LCD_ROWS - 1);
+#endif
+}
+
+CE_Result CE_Display_NewBitmap(INOUT CE_ECS_Context* context, IN int width, IN int height, OUT void** bitmap, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    *bitmap = NULL;
+#ifdef CE_BACKEND_PLAYDATE
+    PlaydateAPI* pd = CE_GetPlaydateAPI();
+    *bitmap = pd->graphics->newBitmap(width, height, kColorClear);
+    if (*bitmap == NULL) {
+        CE_Error("Failed to create a %dx%d bitmap", width, height);
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+#endif
+    return CE_OK;
+}
+
+CE_Result CE_Display_NewTextBitmap(INOUT CE_ECS_Context* context, IN const void* font, IN const char* text, IN size_t length, IN int width, IN int height, OUT void** bitmap, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    if (CE_Display_NewBitmap(context, width, height, bitmap, errorCode) != CE_OK) {
+        return CE_ERROR;
+    }
+#ifdef CE_BACKEND_PLAYDATE
+    PlaydateAPI* pd = CE_GetPlaydateAPI();
+    pd->graphics->pushContext((LCDBitmap*)*bitmap);
+    pd->graphics->setFont((LCDFont*)font);
+    pd->graphics->drawText(text, length, kASCIIEncoding, 0, 0);
+    pd->graphics->popContext();
+#endif
+    return CE_OK;
+}
+
+CE_Result CE_Display_NewTransformedBitmap(INOUT CE_ECS_Context* context, IN const void* source, IN float degrees, IN float scale, OUT void** bitmap, OUT int* width, OUT int* height, OUT size_t* bytes, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    *bitmap = NULL;
+    *width = 0;
+    *height = 0;
+    *bytes = 0;
+#ifdef CE_BACKEND_PLAYDATE
+    PlaydateAPI* pd = CE_GetPlaydateAPI();
+    int allocatedSize = 0;
+    *bitmap = degrees == 0.0f
+        ? pd->graphics->scaledBitmap((LCDBitmap*)source, scale, scale, &allocatedSize)
+        : pd->graphics->rotatedBitmap((LCDBitmap*)source, degrees, scale, scale, &allocatedSize);
+    if (*bitmap == NULL) {
+        CE_Error("Failed to create a rotated or scaled bitmap");
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+    pd->graphics->getBitmapData((LCDBitmap*)*bitmap, width, height, NULL, NULL, NULL);
+    *bytes = (size_t)allocatedSize;
+#endif
+    return CE_OK;
+}
+
+void CE_Display_FreeBitmap(INOUT CE_ECS_Context* context, INOUT void* bitmap)
+{
+#ifdef CE_BACKEND_PLAYDATE
+    if (bitmap != NULL) {
+        CE_GetPlaydateAPI()->graphics->freeBitmap((LCDBitmap*)bitmap);
+    }
+#endif
+}
+
+size_t CE_Display_GetBitmapBytes(INOUT CE_ECS_Context* context, IN const void* bitmap)
+{
+#ifdef CE_BACKEND_PLAYDATE
+    if (bitmap != NULL) {
+        int width = 0, height = 0, rowBytes = 0;
+        uint8_t *mask = NULL;
+        CE_GetPlaydateAPI()->graphics->getBitmapData((LCDBitmap*)bitmap, &width, &height, &rowBytes, &mask, NULL);
+        return (size_t)rowBytes * (size_t)height * (mask != NULL ? 2 : 1);
+    }
+#endif
+    return 0;
+}
+
+void CE_Display_BeginBitmapDraw(INOUT CE_ECS_Context* context, INOUT void* bitmap, IN int drawOffsetX, IN int drawOffsetY)
+{
+#ifdef CE_BACKEND_PLAYDATE
+    PlaydateAPI* pd = CE_GetPlaydateAPI();
+    pd->graphics->pushContext((LCDBitmap*)bitmap);
+    pd->graphics->clear(kColorClear);
+    pd->graphics->setDrawOffset(drawOffsetX, drawOffsetY);
+#endif
+}
+
+void CE_Display_EndBitmapDraw(INOUT CE_ECS_Context* context)
+{
+#ifdef CE_BACKEND_PLAYDATE
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_DISPLAY_COMPONENT, displayComp);
+    PlaydateAPI* pd = CE_GetPlaydateAPI();
+    pd->graphics->popContext();
+    pd->graphics->setDrawOffset(displayComp->m_drawOffsetX, displayComp->m_drawOffsetY);
+#endif
+}
+
+void CE_Display_SetDrawOffset(INOUT CE_ECS_Context* context, IN int x, IN int y)
+{
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_DISPLAY_COMPONENT, displayComp);
+    displayComp->m_drawOffsetX = x;
+    displayComp->m_drawOffsetY = y;
+#ifdef CE_BACKEND_PLAYDATE
+    PlaydateAPI* pd = CE_GetPlaydateAPI();
+    pd->graphics->setDrawOffset(x, y);
+#endif
+}
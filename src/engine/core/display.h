@@ -17,6 +17,9 @@ typedef struct CE_DisplayComponent {
     bool m_inverted;
     bool m_flipX;
     bool m_flipY;
+    // Offset added to every draw call, set from the camera each frame
+    int m_drawOffsetX;
+    int m_drawOffsetY;
 } CE_DisplayComponent;
 
 // Get display size used for rendering.
@@ -28,6 +31,8 @@ typedef struct CE_DisplayComponent {
 #define CE_IsDisplayInverted(context) (CE_ECS_AccessGlobalComponent(context, CE_ENGINE_DISPLAY_COMPONENT)->m_inverted)
 #define CE_IsDisplayFlippedX(context) (CE_ECS_AccessGlobalComponent(context, CE_ENGINE_DISPLAY_COMPONENT)->m_flipX)
 #define CE_IsDisplayFlippedY(context) (CE_ECS_AccessGlobalComponent(context, CE_ENGINE_DISPLAY_COMPONENT)->m_flipY)
+#define CE_GetDisplayDrawOffsetX(context) (CE_ECS_AccessGlobalComponent(context, CE_ENGINE_DISPLAY_COMPONENT)->m_drawOffsetX)
+#define CE_GetDisplayDrawOffsetY(context) (CE_ECS_AccessGlobalComponent(context, CE_ENGINE_DISPLAY_COMPONENT)->m_drawOffsetY)
 
 // Helper functions
 void CE_Display_SetScale(INOUT CE_ECS_Context* context, IN uint8_t scale);
@@ -39,5 +44,26 @@ void CE_Display_Reset(INOUT CE_ECS_Context* context);
 
 // Runtime functions
 void CE_Display_Clear(INOUT CE_ECS_Context* context);
+// Partial redraw, rectangles are in screen coordinates whatever the draw offset
+void CE_Display_ClearRect(INOUT CE_ECS_Context* context, IN int x, IN int y, IN int width, IN int height);
+void CE_Display_SetClipRect(INOUT CE_ECS_Context* context, IN int x, IN int y, IN int width, IN int height);
+void CE_Display_ClearClipRect(INOUT CE_ECS_Context* context);
+// Only the rows from start to end, inclusive, are sent to the LCD
+void CE_Display_MarkUpdatedRows(INOUT CE_ECS_Context* context, IN int start, IN int end);
+// Moves what is on screen by x, y pixels in place, the strips scrolled in are left with stale pixels
+void CE_Display_ScrollFrame(INOUT CE_ECS_Context* context, IN int x, IN int y);
+// Offscreen bitmaps. Creation succeeds with a NULL bitmap on platforms without one, there is nothing to draw into
+CE_Result CE_Display_NewBitmap(INOUT CE_ECS_Context* context, IN int width, IN int height, OUT void** bitmap, OUT_OPT CE_ERROR_CODE* errorCode);
+// Text drawn once into a new bitmap of the given size, clear where there are no glyphs. NULL without bitmaps
+CE_Result CE_Display_NewTextBitmap(INOUT CE_ECS_Context* context, IN const void* font, IN const char* text, IN size_t length, IN int width, IN int height, OUT void** bitmap, OUT_OPT CE_ERROR_CODE* errorCode);
+// Copy of a bitmap rotated clockwise and scaled around its center, bytes is the memory it takes. NULL without bitmaps
+CE_Result CE_Display_NewTransformedBitmap(INOUT CE_ECS_Context* context, IN const void* source, IN float degrees, IN float scale, OUT void** bitmap, OUT int* width, OUT int* height, OUT size_t* bytes, OUT_OPT CE_ERROR_CODE* errorCode);
+void CE_Display_FreeBitmap(INOUT CE_ECS_Context* context, INOUT void* bitmap);
+// Memory taken by the pixels and mask of a bitmap, 0 without bitmaps
+size_t CE_Display_GetBitmapBytes(INOUT CE_ECS_Context* context, IN const void* bitmap);
+// Draw into a bitmap instead of the screen until the matching end. The bitmap is cleared and drawn with its own offset
+void CE_Display_BeginBitmapDraw(INOUT CE_ECS_Context* context, INOUT void* bitmap, IN int drawOffsetX, IN int drawOffsetY);
+void CE_Display_EndBitmapDraw(INOUT CE_ECS_Context* context);
+void CE_Display_SetDrawOffset(INOUT CE_ECS_Context* context, IN int x, IN int y);
 
 #endif // CORGO_ENGINE_CORE_DISPLAY_H
\ No newline at end of file
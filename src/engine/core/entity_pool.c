@@ -0,0 +1,242 @@
+//
+//  engine/core/entity_pool.c
+//  Named pools of recyclable entities for objects that are spawned and despawned often.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#include "entity_pool.h"
+#include "engine/corgo.h"
+
+typedef cc_vec(CE_Id) CE_EntityPool_IdList;
+
+// Gather an entity and everything below it, parents always come before their children
+static CE_Result CE_EntityPool_collectSubtree(INOUT CE_ECS_Context* context, IN CE_Id root, INOUT CE_EntityPool_IdList* subtree, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    cc_clear(subtree);
+    if (!cc_push(subtree, root)) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+
+    // The list doubles as the work queue
+    for (size_t i = 0; i < cc_size(subtree); i++) {
+        const CE_Id *children = NULL;
+        size_t childCount = 0;
+        if (CE_Entity_GetRelationshipTargets(context, *cc_get(subtree, i), CE_RELATIONSHIP_CHILD, &children, &childCount, errorCode) != CE_OK) {
+            return CE_ERROR;
+        }
+        if (childCount > 0 && !cc_push_n(subtree, children, childCount)) {
+            CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+            return CE_ERROR;
+        }
+    }
+    return CE_OK;
+}
+
+// Destroy the entities parked in a pool and free its containers
+static void CE_EntityPool_cleanup(INOUT CE_ECS_Context* context, INOUT CE_EntityPool* pool, IN bool destroyEntities)
+{
+    if (destroyEntities) {
+        CE_EntityPool_IdList subtree;
+        cc_init(&subtree);
+        cc_for_each(&pool->m_parked, root)
+        {
+            if (CE_EntityPool_collectSubtree(context, *root, &subtree, NULL) != CE_OK) {
+                CE_Error("Failed to collect parked entity %u while cleaning up entity pool", *root);
+                continue;
+            }
+            // Children first
+            for (size_t i = cc_size(&subtree); i > 0; i--) {
+                CE_ECS_DestroyEntity(context, *cc_get(&subtree, i - 1), NULL);
+            }
+        }
+        cc_cleanup(&subtree);
+    }
+    cc_cleanup(&pool->m_parked);
+}
+
+// Component functions
+CE_DEFINE_GLOBAL_COMPONENT_INIT(CE_ENGINE_ENTITY_POOL_REGISTRY)
+{
+    cc_init(&component->m_pools);
+    return CE_OK;
+}
+
+CE_DEFINE_GLOBAL_COMPONENT_CLEANUP(CE_ENGINE_ENTITY_POOL_REGISTRY)
+{
+    // Entity storage is already gone at this point, only free the containers
+    cc_for_each(&component->m_pools, key, pool)
+    {
+        CE_EntityPool_cleanup(context, pool, false);
+    }
+    cc_cleanup(&component->m_pools);
+    return CE_OK;
+}
+
+CE_Result CE_EntityPool_Register(INOUT CE_ECS_Context* context, IN const char* name, IN CE_EntityPoolCreateFunction createFunction, IN_OPT CE_EntityPoolResetFunction resetFunction, INOUT void* userData, IN size_t prewarmCount, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_ENTITY_POOL_REGISTRY, registry);
+
+    if (cc_get(&registry->m_pools, name) != NULL) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENGINE_ENTITY_POOL_ALREADY_REGISTERED);
+        return CE_ERROR;
+    }
+
+    CE_EntityPool newPool = { .m_createFunction = createFunction, .m_resetFunction = resetFunction, .m_userData = userData };
+    cc_init(&newPool.m_parked);
+    if (!cc_reserve(&newPool.m_parked, prewarmCount)) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+
+    CE_EntityPool *pool = cc_insert(&registry->m_pools, name, newPool);
+    if (pool == NULL) {
+        cc_cleanup(&newPool.m_parked);
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+
+    // Build the initial entities up front so the first spawns are already recycled ones
+    for (size_t i = 0; i < prewarmCount; i++) {
+        CE_Id entity = CE_INVALID_ID;
+        if (pool->m_createFunction(context, pool->m_userData, &entity, errorCode) != CE_OK
+            || CE_EntityPool_Release(context, name, entity, errorCode) != CE_OK) {
+            CE_EntityPool_Unregister(context, name, NULL);
+            return CE_ERROR;
+        }
+    }
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+CE_Result CE_EntityPool_Unregister(INOUT CE_ECS_Context* context, IN const char* name, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_ENTITY_POOL_REGISTRY, registry);
+
+    CE_EntityPool *pool = cc_get(&registry->m_pools, name);
+    if (pool == NULL) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENGINE_ENTITY_POOL_NOT_FOUND);
+        return CE_ERROR;
+    }
+
+    CE_EntityPool_cleanup(context, pool, true);
+    cc_erase(&registry->m_pools, name);
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+CE_Result CE_EntityPool_Acquire(INOUT CE_ECS_Context* context, IN const char* name, OUT CE_Id* entity, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_Result result = CE_OK;
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_ENTITY_POOL_REGISTRY, registry);
+
+    CE_EntityPool *pool = cc_get(&registry->m_pools, name);
+    if (pool == NULL) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENGINE_ENTITY_POOL_NOT_FOUND);
+        return CE_ERROR;
+    }
+
+    if (cc_size(&pool->m_parked) == 0) {
+        // Nothing to recycle, build a new one
+        if (pool->m_createFunction(context, pool->m_userData, entity, errorCode) != CE_OK) {
+            return CE_ERROR;
+        }
+    } else {
+        *entity = *cc_last(&pool->m_parked);
+
+        CE_EntityPool_IdList subtree;
+        cc_init(&subtree);
+        result = CE_EntityPool_collectSubtree(context, *entity, &subtree, errorCode);
+        for (size_t i = 0; result == CE_OK && i < cc_size(&subtree); i++) {
+            result = CE_ECS_ActivateEntity(context, *cc_get(&subtree, i), errorCode);
+        }
+        cc_cleanup(&subtree);
+
+        if (result != CE_OK) {
+            return CE_ERROR;
+        }
+        cc_erase(&pool->m_parked, cc_size(&pool->m_parked) - 1);
+    }
+
+    if (pool->m_resetFunction != NULL && pool->m_resetFunction(context, *entity, pool->m_userData, errorCode) != CE_OK) {
+        return CE_ERROR;
+    }
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+CE_Result CE_EntityPool_Release(INOUT CE_ECS_Context* context, IN const char* name, IN CE_Id entity, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_Result result = CE_OK;
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_ENTITY_POOL_REGISTRY, registry);
+
+    CE_EntityPool *pool = cc_get(&registry->m_pools, name);
+    if (pool == NULL) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENGINE_ENTITY_POOL_NOT_FOUND);
+        return CE_ERROR;
+    }
+
+    if (!CE_Entity_IsActive(context, entity)) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INVALID_ENTITY_ID);
+        return CE_ERROR;
+    }
+
+    // Make room first so the release cannot fail halfway
+    if (!cc_reserve(&pool->m_parked, cc_size(&pool->m_parked) + 1)) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+
+    // Detach from the scene, the entity keeps its own children
+    CE_Id parent = CE_INVALID_ID;
+    if (CE_Entity_HasRelationship(context, entity, CE_RELATIONSHIP_PARENT)) {
+        if (CE_Entity_FindFirstRelationship(context, entity, CE_RELATIONSHIP_PARENT, &parent, errorCode) != CE_OK) {
+            return CE_ERROR;
+        }
+        if (CE_Entity_HasComponent(context, entity, CE_TRANSFORM_COMPONENT)) {
+            result = CE_Scene_RemoveChild(context, parent, entity, errorCode);
+        } else {
+            result = CE_Entity_RemoveRelationship(context, parent, CE_RELATIONSHIP_CHILD, entity, errorCode);
+        }
+        if (result != CE_OK) {
+            return CE_ERROR;
+        }
+    }
+
+    CE_EntityPool_IdList subtree;
+    cc_init(&subtree);
+    result = CE_EntityPool_collectSubtree(context, entity, &subtree, errorCode);
+
+    // Drop the render nodes and park every entity, no component cleanup runs
+    CE_Id parkedRoot = CE_INVALID_ID;
+    for (size_t i = 0; result == CE_OK && i < cc_size(&subtree); i++) {
+        const CE_Id current = *cc_get(&subtree, i);
+        CE_Id parkedId = CE_INVALID_ID;
+        CE_Engine_SceneGraph_DeleteRenderNode(context, current);
+        result = CE_ECS_DeactivateEntity(context, current, &parkedId, errorCode);
+        if (i == 0) {
+            parkedRoot = parkedId;
+        }
+    }
+    cc_cleanup(&subtree);
+
+    if (result != CE_OK) {
+        return CE_ERROR;
+    }
+
+    cc_push(&pool->m_parked, parkedRoot); // Space was reserved above
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+size_t CE_EntityPool_GetParkedCount(INOUT CE_ECS_Context* context, IN const char* name)
+{
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_ENTITY_POOL_REGISTRY, registry);
+
+    CE_EntityPool *pool = cc_get(&registry->m_pools, name);
+    return pool != NULL ? cc_size(&pool->m_parked) : 0;
+}
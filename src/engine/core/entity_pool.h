@@ -0,0 +1,106 @@
+//
+//  engine/core/entity_pool.h
+//  Named pools of recyclable entities for objects that are spawned and despawned often.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#ifndef CORGO_ENGINE_CORE_ENTITY_POOL_H
+#define CORGO_ENGINE_CORE_ENTITY_POOL_H
+
+#include "ecs/types.h"
+
+/**
+ * @brief Builds a new entity for a pool when it has no parked entity to hand out.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in,out] userData The user data passed to CE_EntityPool_Register.
+ * @param[out] entity Receives the root entity of the new object.
+ * @param[out] errorCode Optional error code.
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+typedef CE_Result (*CE_EntityPoolCreateFunction)(INOUT CE_ECS_Context* context, INOUT void* userData, OUT CE_Id* entity, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Called every time an entity is handed out by a pool, recycled or new, to bring it back to its initial state.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] entity The root entity being handed out.
+ * @param[in,out] userData The user data passed to CE_EntityPool_Register.
+ * @param[out] errorCode Optional error code.
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+typedef CE_Result (*CE_EntityPoolResetFunction)(INOUT CE_ECS_Context* context, IN CE_Id entity, INOUT void* userData, OUT_OPT CE_ERROR_CODE* errorCode);
+
+typedef struct CE_EntityPool {
+    cc_vec(CE_Id) m_parked; // Released root entities, deactivated and ready to be handed out again
+    CE_EntityPoolCreateFunction m_createFunction;
+    CE_EntityPoolResetFunction m_resetFunction;
+    void *m_userData;
+} CE_EntityPool;
+
+typedef struct CE_EntityPoolRegistryComponent {
+    cc_map(const char *, CE_EntityPool) m_pools; // Names are not copied, they must outlive the registry (use literals)
+} CE_EntityPoolRegistryComponent;
+
+/**
+ * @brief Register a named entity pool.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] name Name of the pool, must outlive the registry.
+ * @param[in] createFunction Builds new entities when the pool is empty, a prefab instantiation is a good fit.
+ * @param[in] resetFunction Optional hook run on every entity handed out.
+ * @param[in,out] userData User data for both functions.
+ * @param[in] prewarmCount Number of entities to build and park right away.
+ * @param[out] errorCode Optional error code if registration fails.
+ * @return CE_OK on success, CE_ERROR on failure (e.g., the name is already registered).
+ */
+CE_Result CE_EntityPool_Register(INOUT CE_ECS_Context* context, IN const char* name, IN CE_EntityPoolCreateFunction createFunction, IN_OPT CE_EntityPoolResetFunction resetFunction, INOUT void* userData, IN size_t prewarmCount, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Remove a pool and destroy the entities parked in it.
+ * Entities currently handed out are not affected, they must be destroyed as regular entities.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] name Name of the pool.
+ * @param[out] errorCode Optional error code if the pool is not found.
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+CE_Result CE_EntityPool_Unregister(INOUT CE_ECS_Context* context, IN const char* name, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Get an entity from a pool.
+ * A parked entity is reactivated with its components and children as they were when released,
+ * otherwise a new one is built. The reset hook runs in both cases.
+ * The entity is not part of the scene graph, add it with CE_Scene_AddChild.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] name Name of the pool.
+ * @param[out] entity Receives the root entity.
+ * @param[out] errorCode Optional error code if the pool is not found or the entity cannot be built.
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+CE_Result CE_EntityPool_Acquire(INOUT CE_ECS_Context* context, IN const char* name, OUT CE_Id* entity, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Give an entity back to a pool instead of destroying it.
+ * The entity is detached from its parent and deactivated together with its children. Their component slots and
+ * relationships are kept, no cleanup runs. Their generation is bumped, so the IDs held by the caller become stale.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] name Name of the pool.
+ * @param[in] entity The root entity returned by CE_EntityPool_Acquire.
+ * @param[out] errorCode Optional error code if release fails.
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+CE_Result CE_EntityPool_Release(INOUT CE_ECS_Context* context, IN const char* name, IN CE_Id entity, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Get the number of entities parked in a pool.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] name Name of the pool.
+ * @return Number of parked entities, 0 if the pool is not found.
+ */
+size_t CE_EntityPool_GetParkedCount(INOUT CE_ECS_Context* context, IN const char* name);
+
+#endif // CORGO_ENGINE_CORE_ENTITY_POOL_H
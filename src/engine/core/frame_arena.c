@@ -0,0 +1,69 @@
+//
+//  engine/core/frame_arena.c
+//  Bump allocator for scratch memory that only lives for one frame.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#include "engine/corgo.h"
+
+#include <stdarg.h>
+
+// Enough for any fundamental type on both the device and the host
+#define CE_FRAME_ARENA_ALIGNMENT 8
+
+CE_DEFINE_GLOBAL_COMPONENT_INIT(CE_ENGINE_FRAME_ARENA)
+{
+    component->m_used = 0;
+    component->m_peak = 0;
+    component->m_memory = CE_realloc(NULL, CE_ENGINE_FRAME_ARENA_SIZE);
+    if (component->m_memory == NULL) {
+        CE_Error("Failed to allocate the frame arena");
+        return CE_ERROR;
+    }
+    return CE_OK;
+}
+
+CE_DEFINE_GLOBAL_COMPONENT_CLEANUP(CE_ENGINE_FRAME_ARENA)
+{
+    CE_free(component->m_memory);
+    component->m_memory = NULL;
+    return CE_OK;
+}
+
+void *CE_FrameArena_Alloc(INOUT CE_ECS_Context* context, IN size_t size)
+{
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_FRAME_ARENA, arena);
+
+    const size_t start = (arena->m_used + (CE_FRAME_ARENA_ALIGNMENT - 1)) & ~(size_t)(CE_FRAME_ARENA_ALIGNMENT - 1);
+    if (arena->m_memory == NULL || start > CE_ENGINE_FRAME_ARENA_SIZE || size > CE_ENGINE_FRAME_ARENA_SIZE - start) {
+        CE_Error("Frame arena is full, %u bytes requested with %u in use", (unsigned)size, (unsigned)arena->m_used);
+        return NULL;
+    }
+
+    arena->m_used = start + size;
+    if (arena->m_used > arena->m_peak) {
+        arena->m_peak = arena->m_used;
+    }
+    return arena->m_memory + start;
+}
+
+char *CE_FrameArena_Sprintf(INOUT CE_ECS_Context* context, IN const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    const int length = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+    if (length < 0) {
+        return NULL;
+    }
+
+    char *text = CE_FrameArena_Alloc(context, (size_t)length + 1);
+    if (text == NULL) {
+        return NULL;
+    }
+
+    va_start(args, format);
+    vsnprintf(text, (size_t)length + 1, format, args);
+    va_end(args);
+    return text;
+}
@@ -0,0 +1,61 @@
+//
+//  engine/core/frame_arena.h
+//  Bump allocator for scratch memory that only lives for one frame.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#ifndef CORGO_ENGINE_CORE_FRAME_ARENA_H
+#define CORGO_ENGINE_CORE_FRAME_ARENA_H
+
+#include "ecs/types.h"
+
+typedef struct CE_FrameArenaComponent {
+    uint8_t *m_memory; // One block allocated at init, CE_ENGINE_FRAME_ARENA_SIZE bytes
+    size_t m_used;
+    size_t m_peak; // Highest use since init, to size CE_ENGINE_FRAME_ARENA_SIZE
+} CE_FrameArenaComponent;
+
+/**
+ * @brief Allocates scratch memory that stays valid until the end of the frame (or until rewound).
+ * Never free it, the whole arena is reset at the start of every engine tick.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] size Number of bytes, the memory is aligned for any fundamental type.
+ * @return The memory, or NULL if the arena is full.
+ */
+void *CE_FrameArena_Alloc(INOUT CE_ECS_Context* context, IN size_t size);
+
+/**
+ * @brief Function-like macro: Allocates a scratch array, see CE_FrameArena_Alloc.
+ *
+ * @param context[in,out] The ECS context.
+ * @param type[in] Type of the elements.
+ * @param count[in] Number of elements.
+ * @return Pointer to the first element, or NULL if the arena is full.
+ */
+#define CE_FrameArena_AllocArray(context, type, count) ((type*)CE_FrameArena_Alloc(context, sizeof(type) * (count)))
+
+/**
+ * @brief Formats a string into scratch memory, see CE_FrameArena_Alloc.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] format printf style format.
+ * @return The null terminated string, or NULL if the arena is full.
+ */
+char *CE_FrameArena_Sprintf(INOUT CE_ECS_Context* context, IN const char* format, ...);
+
+/**
+ * @brief Function-like macros: Save the arena position and go back to it, releasing everything allocated in between.
+ * Lets code that runs outside of the tick, or many times per frame, give its scratch memory back right away.
+ *
+ * @param context[in,out] The ECS context.
+ * @param mark[in] A value returned by CE_FrameArena_GetMark.
+ */
+#define CE_FrameArena_GetMark(context) (CE_ECS_AccessGlobalComponent(context, CE_ENGINE_FRAME_ARENA)->m_used)
+#define CE_FrameArena_Rewind(context, mark) do { CE_ECS_AccessGlobalComponent(context, CE_ENGINE_FRAME_ARENA)->m_used = (mark); } while (0)
+
+/// Private API
+// Release everything, called at the start of every engine tick
+#define CE_FrameArena_Reset(context) CE_FrameArena_Rewind(context, 0)
+
+#endif // CORGO_ENGINE_CORE_FRAME_ARENA_H
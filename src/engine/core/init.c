@@ -77,6 +77,10 @@ CE_Result CE_Engine_Tick(INOUT CE_ECS_Context *context, OUT bool *needsRedraw, O
 	const float deltaTime = currentTime - context->m_systemRuntimeData.m_lastTickTime;
 	context->m_systemRuntimeData.m_lastTickTime = currentTime;
 
+	// Scratch memory and bitmap variants from the previous frame are no longer referenced by draw commands
+	CE_FrameArena_Reset(context);
+	CE_BitmapCache_NextFrame(context);
+
 	if (CE_ECS_Tick(context, deltaTime, errorCode) != CE_OK) {
 		CE_Error("ECS Tick failed with result code: %d", CE_GetErrorMessage(*errorCode));
 		return CE_ERROR;
@@ -87,9 +91,6 @@ CE_Result CE_Engine_Tick(INOUT CE_ECS_Context *context, OUT bool *needsRedraw, O
 #endif
 	{
         *needsRedraw = true;
-        
-        // Clear screen before rendering
-		CE_Display_Clear(context);
 
 		// Regenerate caches if needed
 		if (CE_Engine_SceneGraph_UpdateRenderList(context, errorCode) != CE_OK) {
@@ -97,11 +98,25 @@ CE_Result CE_Engine_Tick(INOUT CE_ECS_Context *context, OUT bool *needsRedraw, O
 			return CE_ERROR;
 		}
 
-		// Render
+		// Scroll and shake in one draw offset, the render list is in world space
+		CE_Engine_Camera_ApplyDrawOffset(context);
+
+		// Render systems record draw commands, they are drawn together once all are known
+		CE_RenderCommands_Clear(context);
 		if (CE_ECS_TickRenderSystems(context, deltaTime, errorCode) != CE_OK) {
 			CE_Error("ECS Tick Render Systems failed with result code: %d", CE_GetErrorMessage(*errorCode));
 			return CE_ERROR;
 		}
+		if (CE_Engine_SceneGraph_AddStaticLayerCommands(context, errorCode) != CE_OK) {
+			CE_Error("Failed to draw static layers with error code: %s", CE_GetErrorMessage(*errorCode));
+			return CE_ERROR;
+		}
+		// Only the dirty region is cleared and drawn, unless the whole screen changed
+		if (CE_RenderCommands_Submit(context, errorCode) != CE_OK) {
+			CE_Error("Failed to submit render commands with error code: %s", CE_GetErrorMessage(*errorCode));
+			return CE_ERROR;
+		}
+		CE_DirtyRegion_Clear(context);
 #if CE_ENGINE_ENABLE_ADAPTIVE_RENDERING
 		CE_Engine_SceneGraph_ClearDirty(context);
 #endif
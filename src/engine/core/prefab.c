@@ -0,0 +1,331 @@
+//
+//  engine/core/prefab.c
+//  Prefab templates, capture an entity hierarchy once and stamp out copies of it.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#include "prefab.h"
+#include "engine/corgo.h"
+
+// Captured component data is aligned so it can be used in place
+#define CE_PREFAB_DATA_ALIGNMENT 8
+
+// Release the component data held by a prefab and its containers
+static void CE_Prefab_cleanup(INOUT CE_ECS_Context* context, INOUT CE_Prefab* prefab)
+{
+    for (size_t i = 0; i < cc_size(&prefab->m_types); i++) {
+        const CE_TypeId type = *cc_get(&prefab->m_types, i);
+        if (CE_ECS_GetComponentSize(context, type) != 0) {
+            CE_ECS_CleanupComponentData(context, type, cc_get(&prefab->m_data, *cc_get(&prefab->m_dataOffsets, i)), NULL);
+        }
+    }
+    cc_cleanup(&prefab->m_nodes);
+    cc_cleanup(&prefab->m_types);
+    cc_cleanup(&prefab->m_dataOffsets);
+    cc_cleanup(&prefab->m_data);
+}
+
+// Copy one component into the prefab data
+static CE_Result CE_Prefab_captureComponent(INOUT CE_ECS_Context* context, INOUT CE_Prefab* prefab, IN CE_TypeId type, IN_OPT const void* data, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    const size_t size = CE_ECS_GetComponentSize(context, type);
+    size_t offset = 0;
+
+    if (size != 0) {
+        offset = (cc_size(&prefab->m_data) + CE_PREFAB_DATA_ALIGNMENT - 1) & ~(size_t)(CE_PREFAB_DATA_ALIGNMENT - 1);
+        if (offset + size > UINT16_MAX) {
+            CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+            return CE_ERROR;
+        }
+        if (!cc_resize(&prefab->m_data, offset + size)) {
+            CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+            return CE_ERROR;
+        }
+        if (CE_ECS_CopyComponentData(context, type, cc_get(&prefab->m_data, offset), data, errorCode) != CE_OK) {
+            return CE_ERROR;
+        }
+    }
+
+    // Only track the component once its data is owned, so cleanup never touches a failed copy
+    if (!cc_push(&prefab->m_types, type) || !cc_push(&prefab->m_dataOffsets, (uint16_t)offset)) {
+        if (size != 0) {
+            CE_ECS_CleanupComponentData(context, type, cc_get(&prefab->m_data, offset), NULL);
+        }
+        if (cc_size(&prefab->m_types) > cc_size(&prefab->m_dataOffsets)) {
+            cc_erase(&prefab->m_types, cc_size(&prefab->m_types) - 1);
+        }
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+
+    return CE_OK;
+}
+
+// Capture the components of a single entity as a new node
+static CE_Result CE_Prefab_captureNode(INOUT CE_ECS_Context* context, INOUT CE_Prefab* prefab, IN CE_Id entity, IN uint16_t parentIndex, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_PrefabNode node = { .m_parentIndex = parentIndex, .m_firstComponent = (uint16_t)cc_size(&prefab->m_types), .m_componentCount = 0 };
+
+    // Components with storage
+    CE_Id_Set *components = NULL;
+    if (CE_Entity_GetAllComponentsIter(context, entity, &components, errorCode) != CE_OK) {
+        return CE_ERROR;
+    }
+    cc_for_each(components, componentId)
+    {
+        void *data = NULL;
+        if (CE_Entity_GetComponent(context, entity, *componentId, &data, errorCode) != CE_OK
+            || CE_Prefab_captureComponent(context, prefab, CE_Id_getComponentTypeId(*componentId), data, errorCode) != CE_OK) {
+            return CE_ERROR;
+        }
+    }
+
+    // No-storage components only live in the entity signature
+    for (CE_TypeId type = 0; type < CE_COMPONENT_TYPES_COUNT; type++) {
+        if (CE_ECS_GetComponentSize(context, type) == 0 && CE_Entity_HasComponent(context, entity, type)) {
+            if (CE_Prefab_captureComponent(context, prefab, type, NULL, errorCode) != CE_OK) {
+                return CE_ERROR;
+            }
+        }
+    }
+
+    node.m_componentCount = (uint16_t)(cc_size(&prefab->m_types) - node.m_firstComponent);
+    if (!cc_push(&prefab->m_nodes, node)) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+    return CE_OK;
+}
+
+// Simple struct used for walking the captured hierarchy
+typedef struct CE_PrefabCaptureInfo {
+    CE_Id m_entityId;
+    uint16_t m_parentIndex;
+} CE_PrefabCaptureInfo;
+
+// Capture an entity and everything below it, nodes are stored in pre-order
+static CE_Result CE_Prefab_captureHierarchy(INOUT CE_ECS_Context* context, INOUT CE_Prefab* prefab, IN CE_Id root, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_Result result = CE_OK;
+    cc_vec(CE_PrefabCaptureInfo) expansionList;
+    cc_init(&expansionList);
+
+    CE_PrefabCaptureInfo rootInfo = { .m_entityId = root, .m_parentIndex = CE_PREFAB_NO_PARENT };
+    if (!cc_push(&expansionList, rootInfo)) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+
+    while (result == CE_OK && cc_size(&expansionList) > 0) {
+        CE_PrefabCaptureInfo current = *cc_last(&expansionList);
+        cc_erase(&expansionList, cc_size(&expansionList) - 1);
+
+        const size_t nodeIndex = cc_size(&prefab->m_nodes);
+        if (nodeIndex >= CE_PREFAB_NO_PARENT) {
+            CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+            result = CE_ERROR;
+            break;
+        }
+
+        result = CE_Prefab_captureNode(context, prefab, current.m_entityId, current.m_parentIndex, errorCode);
+        if (result != CE_OK) {
+            break;
+        }
+
+        const CE_Id *children = NULL;
+        size_t childCount = 0;
+        result = CE_Entity_GetRelationshipTargets(context, current.m_entityId, CE_RELATIONSHIP_CHILD, &children, &childCount, errorCode);
+        // Pushed backwards so instances get their children in the same order as the source
+        for (size_t i = childCount; result == CE_OK && i > 0; i--) {
+            CE_PrefabCaptureInfo child = { .m_entityId = children[i - 1], .m_parentIndex = (uint16_t)nodeIndex };
+            if (!cc_push(&expansionList, child)) {
+                CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+                result = CE_ERROR;
+            }
+        }
+    }
+
+    cc_cleanup(&expansionList);
+    return result;
+}
+
+// Component functions
+CE_DEFINE_GLOBAL_COMPONENT_INIT(CE_ENGINE_PREFAB_REGISTRY)
+{
+    cc_init(&component->m_prefabs);
+    return CE_OK;
+}
+
+CE_DEFINE_GLOBAL_COMPONENT_CLEANUP(CE_ENGINE_PREFAB_REGISTRY)
+{
+    cc_for_each(&component->m_prefabs, key, prefab)
+    {
+        CE_Prefab_cleanup(context, prefab);
+    }
+    cc_cleanup(&component->m_prefabs);
+    return CE_OK;
+}
+
+CE_Result CE_Prefab_Register(INOUT CE_ECS_Context* context, IN const char* name, IN CE_Id entity, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_PREFAB_REGISTRY, registry);
+
+    if (cc_get(&registry->m_prefabs, name) != NULL) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENGINE_PREFAB_ALREADY_REGISTERED);
+        return CE_ERROR;
+    }
+
+    if (!CE_Entity_IsValid(context, entity)) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INVALID_ENTITY_ID);
+        return CE_ERROR;
+    }
+
+    CE_Prefab prefab;
+    cc_init(&prefab.m_nodes);
+    cc_init(&prefab.m_types);
+    cc_init(&prefab.m_dataOffsets);
+    cc_init(&prefab.m_data);
+
+    if (CE_Prefab_captureHierarchy(context, &prefab, entity, errorCode) != CE_OK) {
+        CE_Prefab_cleanup(context, &prefab);
+        return CE_ERROR;
+    }
+
+    if (cc_insert(&registry->m_prefabs, name, prefab) == NULL) {
+        CE_Prefab_cleanup(context, &prefab);
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+
+    CE_Debug("Registered prefab %s with %u entities and %u components", name, (unsigned)cc_size(&prefab.m_nodes), (unsigned)cc_size(&prefab.m_types));
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+CE_Result CE_Prefab_Unregister(INOUT CE_ECS_Context* context, IN const char* name, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_PREFAB_REGISTRY, registry);
+
+    CE_Prefab *prefab = cc_get(&registry->m_prefabs, name);
+    if (prefab == NULL) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENGINE_PREFAB_NOT_FOUND);
+        return CE_ERROR;
+    }
+
+    CE_Prefab_cleanup(context, prefab);
+    cc_erase(&registry->m_prefabs, name);
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+// Build every instance into preallocated scratch buffers, undoing the whole call on failure
+static CE_Result CE_Prefab_instantiate(INOUT CE_ECS_Context* context, INOUT CE_Prefab* prefab, IN size_t count, INOUT CE_Id entities[], INOUT CE_Id componentIds[], IN const void* const sources[], IN_OPT CE_PrefabInstanceFunction instanceFunction, INOUT void* userData, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_Result result = CE_OK;
+    const size_t nodeCount = cc_size(&prefab->m_nodes);
+
+    // Allocate every entity of every instance at once
+    if (CE_ECS_CreateEntities(context, count * nodeCount, entities, errorCode) != CE_OK) {
+        return CE_ERROR;
+    }
+
+    for (size_t instance = 0; instance < count && result == CE_OK; instance++) {
+        const CE_Id *instanceEntities = &entities[instance * nodeCount];
+
+        for (size_t nodeIndex = 0; nodeIndex < nodeCount; nodeIndex++) {
+            const CE_PrefabNode *node = cc_get(&prefab->m_nodes, nodeIndex);
+            const CE_Id entity = instanceEntities[nodeIndex];
+
+            if (node->m_componentCount > 0) {
+                result = CE_Entity_AddComponentsFromData(context, entity, node->m_componentCount,
+                    cc_get(&prefab->m_types, node->m_firstComponent), &sources[node->m_firstComponent],
+                    &componentIds[node->m_firstComponent], NULL, errorCode);
+                if (result != CE_OK) {
+                    break;
+                }
+            }
+
+            // Nodes are in pre-order so the parent already exists
+            if (node->m_parentIndex != CE_PREFAB_NO_PARENT) {
+                const CE_Id parent = instanceEntities[node->m_parentIndex];
+                if (CE_Entity_HasComponent(context, entity, CE_TRANSFORM_COMPONENT)) {
+                    result = CE_Scene_AddChild(context, parent, entity, false, errorCode);
+                } else {
+                    result = CE_Entity_AddRelationship(context, parent, CE_RELATIONSHIP_CHILD, entity, errorCode);
+                }
+                if (result != CE_OK) {
+                    break;
+                }
+            }
+        }
+
+        if (result == CE_OK && instanceFunction != NULL) {
+            result = instanceFunction(context, instanceEntities[0], instance, userData, errorCode);
+        }
+    }
+
+    if (result != CE_OK) {
+        // Destroying the entities also releases the copied components
+        for (size_t i = 0; i < count * nodeCount; i++) {
+            CE_ECS_DestroyEntity(context, entities[i], NULL);
+        }
+        return CE_ERROR;
+    }
+
+    return CE_OK;
+}
+
+CE_Result CE_Prefab_Instantiate(INOUT CE_ECS_Context* context, IN const char* name, IN size_t count, OUT_OPT CE_Id roots[], IN_OPT CE_PrefabInstanceFunction instanceFunction, INOUT void* userData, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_Result result = CE_ERROR;
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_PREFAB_REGISTRY, registry);
+
+    CE_Prefab *prefab = cc_get(&registry->m_prefabs, name);
+    if (prefab == NULL) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_ENGINE_PREFAB_NOT_FOUND);
+        return CE_ERROR;
+    }
+
+    if (count == 0) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+        return CE_OK;
+    }
+
+    const size_t nodeCount = cc_size(&prefab->m_nodes);
+    const size_t componentCount = cc_size(&prefab->m_types);
+
+    // Scratch buffers, the source pointers are resolved once for every instance of this call
+    cc_vec(CE_Id) entities;
+    cc_vec(CE_Id) componentIds;
+    cc_vec(const void *) sources;
+    cc_init(&entities);
+    cc_init(&componentIds);
+    cc_init(&sources);
+
+    // One extra slot keeps the buffers valid for prefabs without components
+    if (cc_resize(&entities, count * nodeCount) && cc_resize(&componentIds, componentCount + 1) && cc_resize(&sources, componentCount + 1)) {
+        for (size_t i = 0; i < componentCount; i++) {
+            const CE_TypeId type = *cc_get(&prefab->m_types, i);
+            *cc_get(&sources, i) = CE_ECS_GetComponentSize(context, type) != 0 ? (const void *)cc_get(&prefab->m_data, *cc_get(&prefab->m_dataOffsets, i)) : NULL;
+        }
+
+        result = CE_Prefab_instantiate(context, prefab, count, cc_first(&entities), cc_first(&componentIds), cc_first(&sources), instanceFunction, userData, errorCode);
+        if (result == CE_OK && roots != NULL) {
+            for (size_t instance = 0; instance < count; instance++) {
+                roots[instance] = *cc_get(&entities, instance * nodeCount);
+            }
+        }
+    } else {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+    }
+
+    cc_cleanup(&entities);
+    cc_cleanup(&componentIds);
+    cc_cleanup(&sources);
+
+    if (result == CE_OK) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    }
+    return result;
+}
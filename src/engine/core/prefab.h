@@ -0,0 +1,87 @@
+//
+//  engine/core/prefab.h
+//  Prefab templates, capture an entity hierarchy once and stamp out copies of it.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#ifndef CORGO_ENGINE_CORE_PREFAB_H
+#define CORGO_ENGINE_CORE_PREFAB_H
+
+#include "ecs/types.h"
+
+// Parent index of the root node of a prefab
+#define CE_PREFAB_NO_PARENT UINT16_MAX
+
+typedef struct CE_PrefabNode {
+    uint16_t m_parentIndex; // Index of the parent node, CE_PREFAB_NO_PARENT for the root
+    uint16_t m_firstComponent; // Index of the first component of this node in the prefab component arrays
+    uint16_t m_componentCount;
+} CE_PrefabNode;
+
+typedef struct CE_Prefab {
+    cc_vec(CE_PrefabNode) m_nodes; // Pre-order, parents always come before their children
+    cc_vec(CE_TypeId) m_types; // Component types of all nodes, kept apart so instantiation can pass them directly
+    cc_vec(uint16_t) m_dataOffsets; // Offset of each component in m_data, unused for no-storage components
+    cc_vec(uint8_t) m_data; // Captured component bytes, they hold their own asset references
+} CE_Prefab;
+
+typedef struct CE_PrefabRegistryComponent {
+    cc_map(const char *, CE_Prefab) m_prefabs; // Names are not copied, they must outlive the registry (use literals)
+} CE_PrefabRegistryComponent;
+
+/**
+ * @brief Called once per new instance after all its entities, components and relationships are in place.
+ * Use it to apply per-instance overrides such as the position.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] root The root entity of the new instance.
+ * @param[in] instanceIndex Index of the instance in the current call, from 0 to count - 1.
+ * @param[in,out] userData The user data passed to CE_Prefab_Instantiate.
+ * @param[out] errorCode Optional error code, returning CE_ERROR undoes the whole call.
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+typedef CE_Result (*CE_PrefabInstanceFunction)(INOUT CE_ECS_Context* context, IN CE_Id root, IN size_t instanceIndex, INOUT void* userData, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Register a prefab from an existing entity and its children.
+ * The components of the entity and of every entity below it (following child relationships) are copied into the prefab,
+ * so the source entities can be modified or destroyed afterwards. Asset references are retained by the copy.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] name Name of the prefab, must outlive the registry.
+ * @param[in] entity Root entity to capture.
+ * @param[out] errorCode Optional error code if registration fails.
+ * @return CE_OK on success, CE_ERROR on failure (e.g., the name is already registered).
+ */
+CE_Result CE_Prefab_Register(INOUT CE_ECS_Context* context, IN const char* name, IN CE_Id entity, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Remove a prefab from the registry and release its data.
+ * Instances already created are not affected.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] name Name of the prefab.
+ * @param[out] errorCode Optional error code if the prefab is not found.
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+CE_Result CE_Prefab_Unregister(INOUT CE_ECS_Context* context, IN const char* name, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Create several instances of a prefab.
+ * All entities are allocated in one go and each component is created with a memcpy of the prefab data,
+ * only components with a copy hook (assets, owned text) do any extra work.
+ * Child entities are parented like in the captured hierarchy, but the roots are not added to the scene graph.
+ * Either all instances are created or none are.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] name Name of the prefab.
+ * @param[in] count Number of instances to create.
+ * @param[out] roots Optional buffer of count entries to receive the root entity of each instance.
+ * @param[in] instanceFunction Optional per-instance override callback.
+ * @param[in,out] userData User data for instanceFunction.
+ * @param[out] errorCode Optional error code if instantiation fails.
+ * @return CE_OK on success, CE_ERROR on failure.
+ */
+CE_Result CE_Prefab_Instantiate(INOUT CE_ECS_Context* context, IN const char* name, IN size_t count, OUT_OPT CE_Id roots[], IN_OPT CE_PrefabInstanceFunction instanceFunction, INOUT void* userData, OUT_OPT CE_ERROR_CODE* errorCode);
+
+#endif // CORGO_ENGINE_CORE_PREFAB_H
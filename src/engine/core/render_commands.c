@@ -0,0 +1,326 @@
+//
+//  engine/core/render_commands.c
+//  Draw commands recorded by the render systems and submitted once per frame.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#include "engine/corgo.h"
+
+#include <string.h>
+
+CE_DEFINE_GLOBAL_COMPONENT_INIT(CE_ENGINE_RENDER_COMMANDS)
+{
+    cc_init(&component->m_commands);
+    cc_init(&component->m_commandsScratch);
+    component->m_stateCount = 0;
+    component->m_stateChanges = 0;
+    component->m_target = CE_RENDER_TARGET_SCREEN;
+    return CE_OK;
+}
+
+CE_DEFINE_GLOBAL_COMPONENT_CLEANUP(CE_ENGINE_RENDER_COMMANDS)
+{
+    cc_cleanup(&component->m_commands);
+    cc_cleanup(&component->m_commandsScratch);
+    return CE_OK;
+}
+
+// Number of the draw state within the frame. Past the table size the remaining states share the last number,
+// they are still drawn correctly but no longer grouped
+static uint16_t CE_RenderCommands_getStateIndex(INOUT CE_RenderCommandBufferComponent* buffer, IN const void* resource, IN uint8_t type, IN uint8_t drawMode)
+{
+    for (uint16_t i = 0; i < buffer->m_stateCount; i++) {
+        const CE_RenderCommandState *state = &buffer->m_states[i];
+        if (state->m_resource == resource && state->m_type == type && state->m_drawMode == drawMode) {
+            return i;
+        }
+    }
+    if (buffer->m_stateCount == CE_ENGINE_RENDER_COMMAND_MAX_STATES) {
+        return CE_ENGINE_RENDER_COMMAND_MAX_STATES;
+    }
+    buffer->m_states[buffer->m_stateCount] = (CE_RenderCommandState){ .m_resource = resource, .m_type = type, .m_drawMode = drawMode };
+    return buffer->m_stateCount++;
+}
+
+static CE_Result CE_RenderCommands_add(INOUT CE_ECS_Context* context, IN uint16_t layer, INOUT CE_RenderCommand* command, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_RENDER_COMMANDS, buffer);
+    if (cc_size(&buffer->m_commands) == UINT16_MAX) {
+        CE_Error("Render command buffer is full");
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+
+    command->m_target = buffer->m_target;
+    command->m_sortKey = ((uint32_t)command->m_target << 24) | ((uint32_t)layer << 8)
+        | CE_RenderCommands_getStateIndex(buffer, command->m_resource, command->m_type, command->m_drawMode);
+    if (cc_push(&buffer->m_commands, *command) == NULL) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+    return CE_OK;
+}
+
+CE_Result CE_RenderCommands_AddBitmap(INOUT CE_ECS_Context* context, IN uint16_t layer, IN const void* bitmap, IN int x, IN int y, IN int width, IN int height, IN CE_DrawFlip flip, IN CE_DrawMode drawMode, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_RenderCommand command = {
+        .m_resource = bitmap,
+        .m_text = NULL,
+        .m_textLength = 0,
+        .m_x = (int16_t)x,
+        .m_y = (int16_t)y,
+        .m_width = (int16_t)width,
+        .m_height = (int16_t)height,
+        .m_type = CE_RENDER_COMMAND_BITMAP,
+        .m_drawMode = (uint8_t)drawMode,
+        .m_flip = (uint8_t)flip,
+        .m_target = CE_RENDER_TARGET_SCREEN
+    };
+    return CE_RenderCommands_add(context, layer, &command, errorCode);
+}
+
+CE_Result CE_RenderCommands_AddText(INOUT CE_ECS_Context* context, IN uint16_t layer, IN const void* font, IN const char* text, IN size_t length, IN int x, IN int y, IN int width, IN int height, IN CE_DrawMode drawMode, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_RenderCommand command = {
+        .m_resource = font,
+        .m_text = text,
+        .m_textLength = (uint16_t)(length > UINT16_MAX ? UINT16_MAX : length),
+        .m_x = (int16_t)x,
+        .m_y = (int16_t)y,
+        .m_width = (int16_t)width,
+        .m_height = (int16_t)height,
+        .m_type = CE_RENDER_COMMAND_TEXT,
+        .m_drawMode = (uint8_t)drawMode,
+        .m_flip = CE_DRAW_FLIP_NONE,
+        .m_target = CE_RENDER_TARGET_SCREEN
+    };
+    return CE_RenderCommands_add(context, layer, &command, errorCode);
+}
+
+CE_Result CE_RenderCommands_AddRect(INOUT CE_ECS_Context* context, IN uint16_t layer, IN int x, IN int y, IN int width, IN int height, IN CE_DrawMode color, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_RenderCommand command = {
+        .m_resource = NULL,
+        .m_text = NULL,
+        .m_textLength = 0,
+        .m_x = (int16_t)x,
+        .m_y = (int16_t)y,
+        .m_width = (int16_t)width,
+        .m_height = (int16_t)height,
+        .m_type = CE_RENDER_COMMAND_RECT,
+        .m_drawMode = (uint8_t)color,
+        .m_flip = CE_DRAW_FLIP_NONE,
+        .m_target = CE_RENDER_TARGET_SCREEN
+    };
+    return CE_RenderCommands_add(context, layer, &command, errorCode);
+}
+
+void CE_RenderCommands_GetCommands(INOUT CE_ECS_Context* context, OUT const CE_RenderCommand** commands, OUT size_t* count)
+{
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_RENDER_COMMANDS, buffer);
+    *count = cc_size(&buffer->m_commands);
+    *commands = *count > 0 ? cc_first(&buffer->m_commands) : NULL;
+}
+
+void CE_RenderCommands_Clear(INOUT CE_ECS_Context* context)
+{
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_RENDER_COMMANDS, buffer);
+    cc_clear(&buffer->m_commands);
+    buffer->m_stateCount = 0;
+}
+
+// Stable LSD radix sort on the 32-bit key, one pass per byte. Commands arrive layer by layer from the render queue
+// and mostly go to the screen, so those passes are often skipped and the work is grouping the states
+static CE_Result CE_RenderCommands_sort(INOUT CE_RenderCommandBufferComponent* buffer, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    const size_t count = cc_size(&buffer->m_commands);
+    if (count < 2) {
+        return CE_OK;
+    }
+    if (!cc_resize(&buffer->m_commandsScratch, count)) {
+        CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+        return CE_ERROR;
+    }
+
+    uint16_t histogram[4][256] = { 0 };
+    const CE_RenderCommand *commands = cc_first(&buffer->m_commands);
+    for (size_t i = 0; i < count; i++) {
+        for (int pass = 0; pass < 4; pass++) {
+            histogram[pass][(commands[i].m_sortKey >> (pass * 8)) & 0xFF]++;
+        }
+    }
+
+    CE_RenderCommand *source = cc_first(&buffer->m_commands);
+    CE_RenderCommand *destination = cc_first(&buffer->m_commandsScratch);
+    for (int pass = 0; pass < 4; pass++) {
+        const int shift = pass * 8;
+        if (histogram[pass][(source[0].m_sortKey >> shift) & 0xFF] == count) {
+            continue; // Every key agrees on this byte
+        }
+
+        uint16_t offset = 0;
+        for (int bucket = 0; bucket < 256; bucket++) {
+            const uint16_t bucketCount = histogram[pass][bucket];
+            histogram[pass][bucket] = offset;
+            offset += bucketCount;
+        }
+        for (size_t i = 0; i < count; i++) {
+            destination[histogram[pass][(source[i].m_sortKey >> shift) & 0xFF]++] = source[i];
+        }
+
+        CE_RenderCommand *swap = source;
+        source = destination;
+        destination = swap;
+    }
+
+    if (source != cc_first(&buffer->m_commands)) {
+        memcpy(cc_first(&buffer->m_commands), source, count * sizeof(CE_RenderCommand));
+    }
+    return CE_OK;
+}
+
+// Draw the commands that reach the clip rectangle, or every command without one. Font and draw mode carry over between calls
+static void CE_RenderCommands_draw(INOUT CE_ECS_Context* context, INOUT CE_RenderCommandBufferComponent* buffer, IN const CE_RenderCommand* begin, IN const CE_RenderCommand* end,
+    IN const CE_DirtyRect* clip, INOUT const void** currentFont, INOUT uint8_t* currentDrawMode)
+{
+    const int32_t drawOffsetX = CE_GetDisplayDrawOffsetX(context);
+    const int32_t drawOffsetY = CE_GetDisplayDrawOffsetY(context);
+
+    for (const CE_RenderCommand *command = begin; command < end; command++)
+    {
+        if (clip != NULL && command->m_width > 0 && command->m_height > 0) {
+            const int32_t x = command->m_x + drawOffsetX;
+            const int32_t y = command->m_y + drawOffsetY;
+            if (x >= clip->m_maxX || x + command->m_width <= clip->m_minX || y >= clip->m_maxY || y + command->m_height <= clip->m_minY) {
+                continue;
+            }
+        }
+
+        // Fills ignore the draw mode, it only picks the color
+        if (command->m_type == CE_RENDER_COMMAND_RECT) {
+#ifdef CE_BACKEND_PLAYDATE
+            CE_GetPlaydateAPI()->graphics->fillRect(command->m_x, command->m_y, command->m_width, command->m_height,
+                command->m_drawMode == CE_DRAW_MODE_FILL_WHITE ? kColorWhite : kColorBlack);
+#endif
+            continue;
+        }
+
+        if (command->m_drawMode != *currentDrawMode) {
+            *currentDrawMode = command->m_drawMode;
+            buffer->m_stateChanges++;
+#ifdef CE_BACKEND_PLAYDATE
+            CE_GetPlaydateAPI()->graphics->setDrawMode((LCDBitmapDrawMode)*currentDrawMode);
+#endif
+        }
+
+        if (command->m_type == CE_RENDER_COMMAND_BITMAP) {
+#ifdef CE_BACKEND_PLAYDATE
+            if (command->m_resource != NULL) {
+                CE_GetPlaydateAPI()->graphics->drawBitmap((LCDBitmap*)command->m_resource, command->m_x, command->m_y, (LCDBitmapFlip)command->m_flip);
+            }
+#endif
+            continue;
+        }
+
+        if (command->m_resource != *currentFont) {
+            *currentFont = command->m_resource;
+            buffer->m_stateChanges++;
+#ifdef CE_BACKEND_PLAYDATE
+            CE_GetPlaydateAPI()->graphics->setFont((LCDFont*)*currentFont);
+#endif
+        }
+#ifdef CE_BACKEND_PLAYDATE
+        CE_GetPlaydateAPI()->graphics->drawText(command->m_text, command->m_textLength, kASCIIEncoding, command->m_x, command->m_y);
+#endif
+    }
+}
+
+// Go back to the default mode for whatever draws next
+static void CE_RenderCommands_resetDrawMode(INOUT uint8_t* currentDrawMode)
+{
+    if (*currentDrawMode != CE_DRAW_MODE_COPY) {
+        *currentDrawMode = CE_DRAW_MODE_COPY;
+#ifdef CE_BACKEND_PLAYDATE
+        CE_GetPlaydateAPI()->graphics->setDrawMode(kDrawModeCopy);
+#endif
+    }
+}
+
+// Draw each static layer that is baked this frame into its bitmap, the commands are sorted by target
+static void CE_RenderCommands_bakeStaticLayers(INOUT CE_ECS_Context* context, INOUT CE_RenderCommandBufferComponent* buffer, IN const CE_RenderCommand* begin, IN const CE_RenderCommand* end)
+{
+    const CE_SceneGraphComponent *sceneGraph = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_SCENE_GRAPH_COMPONENT);
+    while (begin < end) {
+        const uint8_t target = begin->m_target;
+        const CE_RenderCommand *targetEnd = begin;
+        while (targetEnd < end && targetEnd->m_target == target) {
+            targetEnd++;
+        }
+
+        // Commands are placed like on screen, moving them by the layer position puts the layer at the bitmap origin
+        const CE_SceneGraphStaticLayer *layer = &sceneGraph->m_staticLayers[target - 1];
+        if (layer->m_bitmap != NULL) {
+            const void *currentFont = NULL;
+            uint8_t currentDrawMode = CE_DRAW_MODE_COPY;
+            CE_Display_BeginBitmapDraw(context, layer->m_bitmap, (int)-layer->m_drawX, (int)-layer->m_drawY);
+            CE_RenderCommands_draw(context, buffer, begin, targetEnd, NULL, &currentFont, &currentDrawMode);
+            CE_RenderCommands_resetDrawMode(&currentDrawMode);
+            CE_Display_EndBitmapDraw(context);
+        }
+        begin = targetEnd;
+    }
+}
+
+CE_Result CE_RenderCommands_Submit(INOUT CE_ECS_Context* context, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_RENDER_COMMANDS, buffer);
+    if (CE_RenderCommands_sort(buffer, errorCode) != CE_OK) {
+        return CE_ERROR;
+    }
+
+    buffer->m_stateChanges = 0;
+    const CE_RenderCommand *begin = cc_size(&buffer->m_commands) > 0 ? cc_first(&buffer->m_commands) : NULL;
+    const CE_RenderCommand *end = begin != NULL ? begin + cc_size(&buffer->m_commands) : NULL;
+
+    // Screen commands sort first, the static layers they blit have to be baked before they are drawn
+    const CE_RenderCommand *screenEnd = begin;
+    while (screenEnd < end && screenEnd->m_target == CE_RENDER_TARGET_SCREEN) {
+        screenEnd++;
+    }
+    CE_RenderCommands_bakeStaticLayers(context, buffer, screenEnd, end);
+
+    // Font only matters for text, the draw mode for everything
+    const void *currentFont = NULL;
+    uint8_t currentDrawMode = CE_DRAW_MODE_COPY;
+
+    CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_DIRTY_REGION, region);
+    if (region->m_fullRedraw) {
+        CE_Display_Clear(context);
+        CE_RenderCommands_draw(context, buffer, begin, screenEnd, NULL, &currentFont, &currentDrawMode);
+    } else {
+        // The camera panned, what is still on screen moves with it and only the strips it exposed are in the rectangles
+        if (region->m_scrollX != 0 || region->m_scrollY != 0) {
+            CE_Display_ScrollFrame(context, (int)region->m_scrollX, (int)region->m_scrollY);
+        }
+
+        // Each rectangle is cleared and drawn again with what overlaps it, only its rows are sent to the LCD
+        for (uint8_t i = 0; i < region->m_rectCount; i++) {
+            const CE_DirtyRect *rect = &region->m_rects[i];
+            const int width = (int)(rect->m_maxX - rect->m_minX);
+            const int height = (int)(rect->m_maxY - rect->m_minY);
+            CE_Display_SetClipRect(context, (int)rect->m_minX, (int)rect->m_minY, width, height);
+            CE_Display_ClearRect(context, (int)rect->m_minX, (int)rect->m_minY, width, height);
+            CE_RenderCommands_draw(context, buffer, begin, screenEnd, rect, &currentFont, &currentDrawMode);
+            CE_Display_MarkUpdatedRows(context, (int)rect->m_minY, (int)rect->m_maxY - 1);
+        }
+        if (region->m_rectCount > 0) {
+            CE_Display_ClearClipRect(context);
+        }
+    }
+
+    // Leave the default mode for whatever draws directly after the scene
+    CE_RenderCommands_resetDrawMode(&currentDrawMode);
+
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
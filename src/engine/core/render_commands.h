@@ -0,0 +1,141 @@
+//
+//  engine/core/render_commands.h
+//  Draw commands recorded by the render systems and submitted once per frame.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#ifndef CORGO_ENGINE_CORE_RENDER_COMMANDS_H
+#define CORGO_ENGINE_CORE_RENDER_COMMANDS_H
+
+#include "ecs/types.h"
+
+// Same values as the Playdate LCDBitmapDrawMode
+typedef enum CE_DrawMode {
+    CE_DRAW_MODE_COPY,
+    CE_DRAW_MODE_WHITE_TRANSPARENT,
+    CE_DRAW_MODE_BLACK_TRANSPARENT,
+    CE_DRAW_MODE_FILL_WHITE,
+    CE_DRAW_MODE_FILL_BLACK,
+    CE_DRAW_MODE_XOR,
+    CE_DRAW_MODE_NXOR,
+    CE_DRAW_MODE_INVERTED
+} CE_DrawMode;
+
+// Same values as the Playdate LCDBitmapFlip
+typedef enum CE_DrawFlip {
+    CE_DRAW_FLIP_NONE,
+    CE_DRAW_FLIP_X,
+    CE_DRAW_FLIP_Y,
+    CE_DRAW_FLIP_XY
+} CE_DrawFlip;
+
+// Commands drawn to the screen, other targets are static layer bitmaps (static layer index + 1)
+#define CE_RENDER_TARGET_SCREEN 0
+
+typedef enum CE_RenderCommandType {
+    CE_RENDER_COMMAND_BITMAP,
+    CE_RENDER_COMMAND_TEXT,
+    CE_RENDER_COMMAND_RECT
+} CE_RenderCommandType;
+
+typedef struct CE_RenderCommand {
+    uint32_t m_sortKey; // Target in the top byte, then the layer, draw state in the low byte
+    const void *m_resource; // Bitmap or font, NULL for rectangles
+    const char *m_text; // Not copied, must stay valid until the buffer is submitted
+    uint16_t m_textLength;
+    int16_t m_x; // Final draw position, the draw offset still applies
+    int16_t m_y;
+    int16_t m_width; // Size on screen, 0 when unknown. Used to skip commands outside the dirty region
+    int16_t m_height;
+    uint8_t m_type; // CE_RenderCommandType
+    uint8_t m_drawMode; // CE_DrawMode, the fill color for rectangles
+    uint8_t m_flip; // CE_DrawFlip, bitmaps only
+    uint8_t m_target; // CE_RENDER_TARGET_SCREEN or a static layer bitmap
+} CE_RenderCommand;
+
+// Resource and draw mode shared by commands, numbered in order of first use within a frame
+typedef struct CE_RenderCommandState {
+    const void *m_resource;
+    uint8_t m_type;
+    uint8_t m_drawMode;
+} CE_RenderCommandState;
+
+typedef struct CE_RenderCommandBufferComponent {
+    cc_vec(CE_RenderCommand) m_commands; // Recorded this frame, sorted on submit
+    cc_vec(CE_RenderCommand) m_commandsScratch; // Radix sort buffer, kept to avoid allocating every frame
+    CE_RenderCommandState m_states[CE_ENGINE_RENDER_COMMAND_MAX_STATES];
+    uint16_t m_stateCount;
+    uint16_t m_stateChanges; // Font and draw mode changes made by the last submit
+    uint8_t m_target; // Target of the commands recorded now, set per entity while the render systems run
+} CE_RenderCommandBufferComponent;
+
+/**
+ * @brief Records a bitmap draw. Commands of the same layer are grouped by bitmap and draw mode on submit,
+ * layers are drawn in increasing order.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] layer Sort key of the render node, see CE_SceneGraphRenderNode.
+ * @param[in] bitmap The bitmap to draw.
+ * @param[in] x Draw position.
+ * @param[in] y Draw position.
+ * @param[in] width Size of the bitmap, 0 if unknown.
+ * @param[in] height Size of the bitmap, 0 if unknown.
+ * @param[in] flip How the bitmap is flipped.
+ * @param[in] drawMode Draw mode used for the bitmap.
+ * @param[out] errorCode Optional error code.
+ * @return CE_OK on success, CE_ERROR if the command could not be stored.
+ */
+CE_Result CE_RenderCommands_AddBitmap(INOUT CE_ECS_Context* context, IN uint16_t layer, IN const void* bitmap, IN int x, IN int y, IN int width, IN int height, IN CE_DrawFlip flip, IN CE_DrawMode drawMode, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Records a text draw, see CE_RenderCommands_AddBitmap. The text is not copied.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] layer Sort key of the render node, see CE_SceneGraphRenderNode.
+ * @param[in] font The font to draw with.
+ * @param[in] text The text, must stay valid until the buffer is submitted.
+ * @param[in] length Number of characters of the text.
+ * @param[in] x Draw position.
+ * @param[in] y Draw position.
+ * @param[in] width Size of the text, 0 if unknown.
+ * @param[in] height Size of the text, 0 if unknown.
+ * @param[in] drawMode Draw mode used for the text.
+ * @param[out] errorCode Optional error code.
+ * @return CE_OK on success, CE_ERROR if the command could not be stored.
+ */
+CE_Result CE_RenderCommands_AddText(INOUT CE_ECS_Context* context, IN uint16_t layer, IN const void* font, IN const char* text, IN size_t length, IN int x, IN int y, IN int width, IN int height, IN CE_DrawMode drawMode, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Records a filled rectangle, see CE_RenderCommands_AddBitmap. Meant for pixels and other small shapes.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[in] layer Sort key of the render node, see CE_SceneGraphRenderNode.
+ * @param[in] x Draw position.
+ * @param[in] y Draw position.
+ * @param[in] width Size of the rectangle.
+ * @param[in] height Size of the rectangle.
+ * @param[in] color CE_DRAW_MODE_FILL_BLACK or CE_DRAW_MODE_FILL_WHITE.
+ * @param[out] errorCode Optional error code.
+ * @return CE_OK on success, CE_ERROR if the command could not be stored.
+ */
+CE_Result CE_RenderCommands_AddRect(INOUT CE_ECS_Context* context, IN uint16_t layer, IN int x, IN int y, IN int width, IN int height, IN CE_DrawMode color, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Commands of the last submit in the order they were drawn, or the ones recorded so far this frame.
+ * Valid until the next command is recorded. Lets tests and tools inspect a frame without a display.
+ *
+ * @param[in,out] context The ECS context.
+ * @param[out] commands Receives the commands, NULL when there are none.
+ * @param[out] count Receives the number of commands.
+ */
+void CE_RenderCommands_GetCommands(INOUT CE_ECS_Context* context, OUT const CE_RenderCommand** commands, OUT size_t* count);
+
+/// Private API
+// Drop the commands of the previous frame, called before the render systems run
+void CE_RenderCommands_Clear(INOUT CE_ECS_Context* context);
+// Where the next commands draw, the screen unless the entity is part of a static layer being baked
+#define CE_RenderCommands_SetTarget(context, target) do { CE_ECS_AccessGlobalComponent(context, CE_ENGINE_RENDER_COMMANDS)->m_target = (target); } while (0)
+// Sort the recorded commands, bake the static layers and draw the dirty region, changing font and draw mode only between groups
+CE_Result CE_RenderCommands_Submit(INOUT CE_ECS_Context* context, OUT_OPT CE_ERROR_CODE* errorCode);
+
+#endif // CORGO_ENGINE_CORE_RENDER_COMMANDS_H
@@ -15,6 +15,8 @@ typedef const char * CE_SceneId;
 // Signatures for create and run functions
 typedef CE_Result (*CE_SceneRunFunction)(INOUT struct CE_ECS_Context* context, const IN float deltaTime, OUT_OPT CE_ERROR_CODE* errorCode);
 typedef CE_Result (*CE_SceneCreateFunction)(INOUT struct CE_ECS_Context* context, void *dataComponent, OUT_OPT CE_ERROR_CODE* errorCode);
+// Optional incremental construction, called after the create function until it sets done, once per frame for background loads
+typedef CE_Result (*CE_SceneBuildStepFunction)(INOUT struct CE_ECS_Context* context, void *dataComponent, IN uint16_t step, OUT bool* done, OUT_OPT CE_ERROR_CODE* errorCode);
 
 // Tracked states of a scene
 typedef enum CE_SceneState
@@ -26,6 +28,16 @@ typedef enum CE_SceneState
     CE_SCENE_STATE_UNLOADING
 } CE_SceneState;
 
+// Progress of a scene being built in the background while the current one runs
+typedef enum CE_SceneBackgroundLoadState
+{
+    CE_SCENE_BACKGROUND_LOAD_NONE,
+    CE_SCENE_BACKGROUND_LOAD_START, // Shadow context is created and the create function runs
+    CE_SCENE_BACKGROUND_LOAD_BUILDING, // One build step per frame
+    CE_SCENE_BACKGROUND_LOAD_SWAP, // Next scene is complete and replaces the current one
+    CE_SCENE_BACKGROUND_LOAD_TEARDOWN // Previous scene, now in the shadow context, is destroyed
+} CE_SceneBackgroundLoadState;
+
 // Runtime data for a scene
 typedef struct CE_Scene
 {
@@ -33,6 +45,7 @@ typedef struct CE_Scene
     CE_TypeId m_scriptDataComponentType;
     CE_SceneRunFunction m_runFunction;
     CE_SceneCreateFunction m_createFunction;
+    CE_SceneBuildStepFunction m_buildStepFunction;
 } CE_Scene;
 
 // Helper function to clear the scene
@@ -42,6 +55,7 @@ static inline void CE_Engine_Scene_Clear(IN CE_Scene* scene)
     scene->m_scriptDataComponentType = CE_INVALID_TYPE_ID;
     scene->m_runFunction = NULL;
     scene->m_createFunction = NULL;
+    scene->m_buildStepFunction = NULL;
 }
 
 // Function used to populate the scene data
@@ -96,6 +110,62 @@ CE_Result CE_Scene_RemoveChild(INOUT CE_ECS_Context* context, IN CE_Id parentId,
  */
 CE_SceneGraphRenderNode *CE_Scene_GetRenderNode(IN CE_ECS_Context* context, IN CE_Id entityId);
 
+/**
+ * @brief Function-like macros: Get the coordinates to draw a render node at.
+ * Render nodes are in world space and the camera is applied as a draw offset, screen space nodes cancel it out.
+ * 
+ * @param context[in] The ECS context.
+ * @param renderNode[in] The render node to draw.
+ * 
+ * @return The coordinate to pass to the draw call.
+ */
+#define CE_Scene_GetDrawX(context, renderNode) ((renderNode)->m_screenSpace ? (renderNode)->m_x - CE_GetDisplayDrawOffsetX(context) : (renderNode)->m_x)
+#define CE_Scene_GetDrawY(context, renderNode) ((renderNode)->m_screenSpace ? (renderNode)->m_y - CE_GetDisplayDrawOffsetY(context) : (renderNode)->m_y)
+
+/**
+ * @brief Finds the entities whose rectangle overlaps a region of the world.
+ * Uses the scene graph spatial hash, so positions are the ones of the last render list update. Only entities with a size
+ * that are not fixed to the screen are indexed.
+ * 
+ * @param context[in,out] The ECS context.
+ * @param x[in] Left edge of the region in world coordinates.
+ * @param y[in] Top edge of the region in world coordinates.
+ * @param width[in] Width of the region.
+ * @param height[in] Height of the region.
+ * @param results[out] Receives up to capacity entity IDs, in no particular order.
+ * @param capacity[in] Number of IDs results can hold.
+ * 
+ * @return The number of overlapping entities, when larger than capacity only the first ones were written.
+ */
+size_t CE_Scene_QueryRect(INOUT CE_ECS_Context* context, IN int32_t x, IN int32_t y, IN int32_t width, IN int32_t height, OUT CE_Id results[], IN size_t capacity);
+
+/**
+ * @brief Finds the entities whose rectangle contains a point of the world, see CE_Scene_QueryRect.
+ * 
+ * @param context[in,out] The ECS context.
+ * @param x[in] X position in world coordinates.
+ * @param y[in] Y position in world coordinates.
+ * @param results[out] Receives up to capacity entity IDs, in no particular order.
+ * @param capacity[in] Number of IDs results can hold.
+ * 
+ * @return The number of entities at the point, when larger than capacity only the first ones were written.
+ */
+size_t CE_Scene_QueryPoint(INOUT CE_ECS_Context* context, IN int32_t x, IN int32_t y, OUT CE_Id results[], IN size_t capacity);
+
+/**
+ * @brief Finds the entities whose rectangle is within a distance of a point of the world, see CE_Scene_QueryRect.
+ * 
+ * @param context[in,out] The ECS context.
+ * @param x[in] X position of the center in world coordinates.
+ * @param y[in] Y position of the center in world coordinates.
+ * @param radius[in] Distance in pixels.
+ * @param results[out] Receives up to capacity entity IDs, in no particular order.
+ * @param capacity[in] Number of IDs results can hold.
+ * 
+ * @return The number of entities in range, when larger than capacity only the first ones were written.
+ */
+size_t CE_Scene_QueryRadius(INOUT CE_ECS_Context* context, IN int32_t x, IN int32_t y, IN int32_t radius, OUT CE_Id results[], IN size_t capacity);
+
 /**
  * @brief Requests the loading of a scene and replace the current one.
  * The current scene will be fully unloaded first.
@@ -109,6 +179,32 @@ CE_SceneGraphRenderNode *CE_Scene_GetRenderNode(IN CE_ECS_Context* context, IN C
  */
 CE_Result CE_Scene_RequestLoad(INOUT struct CE_ECS_Context* context, IN CE_LoadSceneDataFunction loadFunction, OUT_OPT CE_ERROR_CODE* errorCode);
 
+/**
+ * @brief Requests building a scene in the background and switching to it without unloading first.
+ * The next scene is built in a separate context while the current one keeps running: the create function runs on one frame,
+ * then the build step function (if any) runs once per frame until it reports done. The scenes are then swapped in one frame
+ * and the previous scene is destroyed on the following one. Assets are shared with the current context, so the ones
+ * already loaded are reused.
+ * Entities, components and the scene graph, camera, prefab and entity pool globals follow the scene, other global components stay.
+ * Entity IDs from the previous scene must not be used after the swap.
+ * 
+ * @param context[in,out] The ECS context to operate on.
+ * @param loadFunction[in] The function that will populate the scene data, must be of signature CE_LoadSceneDataFunction.
+ * @param errorCode[out] Optional pointer to receive an error code if the request fails.
+ * 
+ * @return CE_OK if the load request was accepted, CE_ERROR if no scene is running or another load is in progress.
+ */
+CE_Result CE_Scene_RequestBackgroundLoad(INOUT struct CE_ECS_Context* context, IN CE_LoadSceneDataFunction loadFunction, OUT_OPT CE_ERROR_CODE* errorCode);
+
+/**
+ * @brief Checks if a scene is being built in the background.
+ * 
+ * @param context[in,out] The ECS context to operate on.
+ * 
+ * @return true if a background load is in progress, false otherwise.
+ */
+bool CE_Scene_IsBackgroundLoading(INOUT struct CE_ECS_Context* context);
+
 /**
  * @brief Requests the unloading of the current scene.
  * In general you don't want to call that unless you intend to manage the scene manually, as no scene will be loaded.
@@ -132,6 +228,7 @@ bool CE_Scene_IsSceneRunning(INOUT struct CE_ECS_Context* context);
 #define CE_SCENE_LOAD_FUNCTION(name) CE_PASTE(name, _LoadSceneDataFunction)
 #define CE_SCENE_CREATE_FUNCTION(name)  CE_PASTE(name, _CreateFunction)
 #define CE_SCENE_RUN_FUNCTION(name) CE_PASTE(name, _RunFunction)
+#define CE_SCENE_BUILD_STEP_FUNCTION(name) CE_PASTE(name, _BuildStepFunction)
 
 /**
  * @brief Macro to define a scene create function with the correct signature.
@@ -154,6 +251,13 @@ bool CE_Scene_IsSceneRunning(INOUT struct CE_ECS_Context* context);
 #define CE_DECLARE_SCENE_RUN_FUNCTION(sceneName) \
     CE_Result CE_SCENE_RUN_FUNCTION(sceneName)(INOUT struct CE_ECS_Context* context, const IN float deltaTime, OUT_OPT CE_ERROR_CODE* errorCode)
 
+/**
+ * @brief Macro to define a scene build step function with the correct signature.
+ * @param sceneName[in] unique name for the scene
+ */
+#define CE_DECLARE_SCENE_BUILD_STEP_FUNCTION(sceneName) \
+    CE_Result CE_SCENE_BUILD_STEP_FUNCTION(sceneName)(INOUT struct CE_ECS_Context* context, void *dataComponent, IN uint16_t step, OUT bool* done, OUT_OPT CE_ERROR_CODE* errorCode)
+
 /**
  * @brief Macro to define all scene functions (load data, create and run) with the correct signatures.
  * Optional, but saves some boilerplate when defining a new scene. You can still define the functions manually if you want to.
@@ -0,0 +1,268 @@
+//
+//  engine/core/spatial_hash.c
+//  Uniform grid over entity rectangles for region, point and radius queries.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#include "engine/corgo.h"
+
+#include <string.h>
+
+// Entities are placed with int16_t coordinates and uint16_t sizes, nothing can be found outside this range
+#define CE_SPATIAL_HASH_MIN_COORDINATE INT16_MIN
+#define CE_SPATIAL_HASH_MAX_COORDINATE (INT16_MAX + UINT16_MAX + 1)
+
+// Cell of a coordinate, rounds towards negative infinity so cells do not double up around 0
+static inline int32_t CE_SpatialHash_getCell(IN int32_t value)
+{
+    return ((value >= 0 ? value : value - (CE_ENGINE_SPATIAL_HASH_CELL_SIZE - 1)) / CE_ENGINE_SPATIAL_HASH_CELL_SIZE);
+}
+
+static inline uint32_t CE_SpatialHash_getCellKey(IN int16_t cellX, IN int16_t cellY)
+{
+    return ((uint32_t)(uint16_t)cellX << 16) | (uint16_t)cellY;
+}
+
+#define CE_SpatialHash_getKeyCellX(key) ((int16_t)(uint16_t)((key) >> 16))
+#define CE_SpatialHash_getKeyCellY(key) ((int16_t)(uint16_t)((key) & 0xFFFF))
+
+static void CE_SpatialHash_removeFromCells(INOUT CE_SpatialHash* hash, IN const CE_SpatialHashEntry* entry, IN CE_ShortId uniqueId)
+{
+    for (int32_t cellY = entry->m_minCellY; cellY <= entry->m_maxCellY; cellY++) {
+        for (int32_t cellX = entry->m_minCellX; cellX <= entry->m_maxCellX; cellX++) {
+            const uint32_t key = CE_SpatialHash_getCellKey((int16_t)cellX, (int16_t)cellY);
+            CE_SpatialHashCell *cell = cc_get(&hash->m_cells, key);
+            if (cell == NULL) {
+                continue;
+            }
+            // Cells are short and unordered, swap the last one in
+            for (size_t i = 0; i < cc_size(cell); i++) {
+                if (*cc_get(cell, i) == uniqueId) {
+                    *cc_get(cell, i) = *cc_last(cell);
+                    cc_erase(cell, cc_size(cell) - 1);
+                    break;
+                }
+            }
+            // Only occupied cells are kept, entities crossing a large world would grow the map forever otherwise
+            if (cc_size(cell) == 0) {
+                cc_cleanup(cell);
+                cc_erase(&hash->m_cells, key);
+            }
+        }
+    }
+}
+
+static CE_Result CE_SpatialHash_addToCells(INOUT CE_SpatialHash* hash, IN const CE_SpatialHashEntry* entry, IN CE_ShortId uniqueId, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    for (int32_t cellY = entry->m_minCellY; cellY <= entry->m_maxCellY; cellY++) {
+        for (int32_t cellX = entry->m_minCellX; cellX <= entry->m_maxCellX; cellX++) {
+            const uint32_t key = CE_SpatialHash_getCellKey((int16_t)cellX, (int16_t)cellY);
+            CE_SpatialHashCell *cell = cc_get(&hash->m_cells, key);
+            if (cell == NULL) {
+                CE_SpatialHashCell newCell;
+                cc_init(&newCell);
+                cell = cc_insert(&hash->m_cells, key, newCell);
+            }
+            if (cell == NULL || cc_push(cell, uniqueId) == NULL) {
+                CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+                return CE_ERROR;
+            }
+        }
+    }
+    return CE_OK;
+}
+
+void CE_SpatialHash_init(INOUT CE_SpatialHash* hash)
+{
+    cc_init(&hash->m_cells);
+    memset(hash->m_entries, 0, sizeof(hash->m_entries));
+    memset(hash->m_queryMarks, 0, sizeof(hash->m_queryMarks));
+    hash->m_queryCounter = 0;
+}
+
+void CE_SpatialHash_cleanup(INOUT CE_SpatialHash* hash)
+{
+    cc_for_each(&hash->m_cells, key, cell)
+    {
+        cc_cleanup(cell);
+    }
+    cc_cleanup(&hash->m_cells);
+}
+
+void CE_SpatialHash_clear(INOUT CE_SpatialHash* hash)
+{
+    cc_for_each(&hash->m_cells, key, cell)
+    {
+        cc_cleanup(cell);
+    }
+    cc_clear(&hash->m_cells);
+    for (size_t i = 0; i < CE_MAX_ENTITIES; i++) {
+        hash->m_entries[i].m_inserted = false;
+    }
+}
+
+CE_Result CE_SpatialHash_update(INOUT CE_SpatialHash* hash, IN CE_Id entityId, IN int32_t x, IN int32_t y, IN uint16_t width, IN uint16_t height, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    const CE_ShortId uniqueId = CE_Id_getUniqueId(entityId);
+    CE_SpatialHashEntry *entry = &hash->m_entries[uniqueId];
+    const int32_t maxX = x + (width > 0 ? width : 1);
+    const int32_t maxY = y + (height > 0 ? height : 1);
+
+    CE_SpatialHashEntry updated = {
+        .m_entityId = entityId,
+        .m_minX = x,
+        .m_minY = y,
+        .m_maxX = maxX,
+        .m_maxY = maxY,
+        .m_minCellX = (int16_t)CE_SpatialHash_getCell(x),
+        .m_minCellY = (int16_t)CE_SpatialHash_getCell(y),
+        .m_maxCellX = (int16_t)CE_SpatialHash_getCell(maxX - 1),
+        .m_maxCellY = (int16_t)CE_SpatialHash_getCell(maxY - 1),
+        .m_inserted = true
+    };
+
+    // Moving inside the same cells only needs the new rectangle
+    if (entry->m_inserted && entry->m_entityId == entityId
+        && entry->m_minCellX == updated.m_minCellX && entry->m_minCellY == updated.m_minCellY
+        && entry->m_maxCellX == updated.m_maxCellX && entry->m_maxCellY == updated.m_maxCellY) {
+        *entry = updated;
+        return CE_OK;
+    }
+
+    if (entry->m_inserted) {
+        CE_SpatialHash_removeFromCells(hash, entry, uniqueId);
+        entry->m_inserted = false;
+    }
+    if (CE_SpatialHash_addToCells(hash, &updated, uniqueId, errorCode) != CE_OK) {
+        CE_SpatialHash_removeFromCells(hash, &updated, uniqueId);
+        return CE_ERROR;
+    }
+    *entry = updated;
+    return CE_OK;
+}
+
+void CE_SpatialHash_remove(INOUT CE_SpatialHash* hash, IN CE_Id entityId)
+{
+    const CE_ShortId uniqueId = CE_Id_getUniqueId(entityId);
+    CE_SpatialHashEntry *entry = &hash->m_entries[uniqueId];
+    if (!entry->m_inserted) {
+        return;
+    }
+    CE_SpatialHash_removeFromCells(hash, entry, uniqueId);
+    entry->m_inserted = false;
+}
+
+// Query being run, shared by the cells it visits
+typedef struct CE_SpatialHashQuery {
+    int32_t m_minX; // Rectangle, max is exclusive
+    int32_t m_minY;
+    int32_t m_maxX;
+    int32_t m_maxY;
+    int32_t m_centerX; // Circle, only tested with a radius of 0 or more
+    int32_t m_centerY;
+    int32_t m_radius;
+    CE_Id *m_results;
+    size_t m_capacity;
+    size_t m_count;
+} CE_SpatialHashQuery;
+
+// Report the entities of a cell that overlap the query and were not reported by an earlier cell
+static void CE_SpatialHash_queryCell(INOUT CE_SpatialHash* hash, IN CE_SpatialHashCell* cell, INOUT CE_SpatialHashQuery* query)
+{
+    const int64_t radiusSquared = (int64_t)query->m_radius * query->m_radius;
+    cc_for_each(cell, uniqueId)
+    {
+        if (hash->m_queryMarks[*uniqueId] == hash->m_queryCounter) {
+            continue;
+        }
+        hash->m_queryMarks[*uniqueId] = hash->m_queryCounter;
+
+        const CE_SpatialHashEntry *entry = &hash->m_entries[*uniqueId];
+        if (entry->m_minX >= query->m_maxX || entry->m_maxX <= query->m_minX || entry->m_minY >= query->m_maxY || entry->m_maxY <= query->m_minY) {
+            continue;
+        }
+        if (query->m_radius >= 0) {
+            // Closest point of the rectangle to the center
+            const int32_t centerX = query->m_centerX;
+            const int32_t centerY = query->m_centerY;
+            const int32_t closestX = centerX < entry->m_minX ? entry->m_minX : (centerX >= entry->m_maxX ? entry->m_maxX - 1 : centerX);
+            const int32_t closestY = centerY < entry->m_minY ? entry->m_minY : (centerY >= entry->m_maxY ? entry->m_maxY - 1 : centerY);
+            const int64_t distanceX = closestX - centerX;
+            const int64_t distanceY = closestY - centerY;
+            if (distanceX * distanceX + distanceY * distanceY > radiusSquared) {
+                continue;
+            }
+        }
+
+        if (query->m_count < query->m_capacity) {
+            query->m_results[query->m_count] = entry->m_entityId;
+        }
+        query->m_count++;
+    }
+}
+
+// Visit the cells covering a rectangle and report each overlapping entity once.
+// With a radius the rectangle must be the bounding box of the circle and entries are also tested against the circle
+static size_t CE_SpatialHash_query(INOUT CE_SpatialHash* hash, IN int32_t minX, IN int32_t minY, IN int32_t maxX, IN int32_t maxY, IN int32_t centerX, IN int32_t centerY, IN int32_t radius, OUT CE_Id results[], IN size_t capacity)
+{
+    minX = minX < CE_SPATIAL_HASH_MIN_COORDINATE ? CE_SPATIAL_HASH_MIN_COORDINATE : minX;
+    minY = minY < CE_SPATIAL_HASH_MIN_COORDINATE ? CE_SPATIAL_HASH_MIN_COORDINATE : minY;
+    maxX = maxX > CE_SPATIAL_HASH_MAX_COORDINATE ? CE_SPATIAL_HASH_MAX_COORDINATE : maxX;
+    maxY = maxY > CE_SPATIAL_HASH_MAX_COORDINATE ? CE_SPATIAL_HASH_MAX_COORDINATE : maxY;
+    if (minX >= maxX || minY >= maxY || cc_size(&hash->m_cells) == 0) {
+        return 0;
+    }
+
+    if (++hash->m_queryCounter == 0) {
+        // Wrapped around, old marks could match again
+        memset(hash->m_queryMarks, 0, sizeof(hash->m_queryMarks));
+        hash->m_queryCounter = 1;
+    }
+
+    CE_SpatialHashQuery query = {
+        .m_minX = minX, .m_minY = minY, .m_maxX = maxX, .m_maxY = maxY,
+        .m_centerX = centerX, .m_centerY = centerY, .m_radius = radius,
+        .m_results = results, .m_capacity = capacity, .m_count = 0
+    };
+    const int32_t minCellX = CE_SpatialHash_getCell(minX);
+    const int32_t minCellY = CE_SpatialHash_getCell(minY);
+    const int32_t maxCellX = CE_SpatialHash_getCell(maxX - 1);
+    const int32_t maxCellY = CE_SpatialHash_getCell(maxY - 1);
+
+    // Every cell of the map is occupied, past that many lookups it is cheaper to go through the map itself
+    const int64_t rangeCellCount = (int64_t)(maxCellX - minCellX + 1) * (maxCellY - minCellY + 1);
+    if (rangeCellCount > (int64_t)cc_size(&hash->m_cells)) {
+        cc_for_each(&hash->m_cells, key, cell)
+        {
+            const int32_t cellX = CE_SpatialHash_getKeyCellX(*key);
+            const int32_t cellY = CE_SpatialHash_getKeyCellY(*key);
+            if (cellX >= minCellX && cellX <= maxCellX && cellY >= minCellY && cellY <= maxCellY) {
+                CE_SpatialHash_queryCell(hash, cell, &query);
+            }
+        }
+        return query.m_count;
+    }
+
+    for (int32_t cellY = minCellY; cellY <= maxCellY; cellY++) {
+        for (int32_t cellX = minCellX; cellX <= maxCellX; cellX++) {
+            CE_SpatialHashCell *cell = cc_get(&hash->m_cells, CE_SpatialHash_getCellKey((int16_t)cellX, (int16_t)cellY));
+            if (cell != NULL) {
+                CE_SpatialHash_queryCell(hash, cell, &query);
+            }
+        }
+    }
+    return query.m_count;
+}
+
+size_t CE_SpatialHash_queryRect(INOUT CE_SpatialHash* hash, IN int32_t x, IN int32_t y, IN int32_t width, IN int32_t height, OUT CE_Id results[], IN size_t capacity)
+{
+    return CE_SpatialHash_query(hash, x, y, x + width, y + height, 0, 0, -1, results, capacity);
+}
+
+size_t CE_SpatialHash_queryRadius(INOUT CE_SpatialHash* hash, IN int32_t x, IN int32_t y, IN int32_t radius, OUT CE_Id results[], IN size_t capacity)
+{
+    if (radius < 0) {
+        return 0;
+    }
+    return CE_SpatialHash_query(hash, x - radius, y - radius, x + radius + 1, y + radius + 1, x, y, radius, results, capacity);
+}
@@ -0,0 +1,48 @@
+//
+//  engine/core/spatial_hash.h
+//  Uniform grid over entity rectangles for region, point and radius queries.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#ifndef CORGO_ENGINE_CORE_SPATIAL_HASH_H
+#define CORGO_ENGINE_CORE_SPATIAL_HASH_H
+
+#include "ecs/types.h"
+
+typedef struct CE_SpatialHashEntry {
+    CE_Id m_entityId;
+    // Rectangle, max is exclusive
+    int32_t m_minX;
+    int32_t m_minY;
+    int32_t m_maxX;
+    int32_t m_maxY;
+    // Cells covered by the rectangle, inclusive
+    int16_t m_minCellX;
+    int16_t m_minCellY;
+    int16_t m_maxCellX;
+    int16_t m_maxCellY;
+    bool m_inserted;
+} CE_SpatialHashEntry;
+
+typedef cc_vec(CE_ShortId) CE_SpatialHashCell;
+
+typedef struct CE_SpatialHash {
+    cc_map(uint32_t, CE_SpatialHashCell) m_cells; // Entity unique IDs per occupied cell, a cell is erased once empty
+    CE_SpatialHashEntry m_entries[CE_MAX_ENTITIES]; // Indexed by entity unique ID
+    uint32_t m_queryMarks[CE_MAX_ENTITIES]; // Last query that reported each entity, avoids duplicates when an entity spans cells
+    uint32_t m_queryCounter;
+} CE_SpatialHash;
+
+/// Private API, the scene graph keeps its hash in sync with the render nodes
+void CE_SpatialHash_init(INOUT CE_SpatialHash* hash);
+void CE_SpatialHash_cleanup(INOUT CE_SpatialHash* hash);
+// Drop every entry and cell
+void CE_SpatialHash_clear(INOUT CE_SpatialHash* hash);
+// Insert an entity or move it, only the cells it enters or leaves are touched
+CE_Result CE_SpatialHash_update(INOUT CE_SpatialHash* hash, IN CE_Id entityId, IN int32_t x, IN int32_t y, IN uint16_t width, IN uint16_t height, OUT_OPT CE_ERROR_CODE* errorCode);
+void CE_SpatialHash_remove(INOUT CE_SpatialHash* hash, IN CE_Id entityId);
+// Queries write up to capacity ids into results and return the number of matches, which may be larger than capacity
+size_t CE_SpatialHash_queryRect(INOUT CE_SpatialHash* hash, IN int32_t x, IN int32_t y, IN int32_t width, IN int32_t height, OUT CE_Id results[], IN size_t capacity);
+size_t CE_SpatialHash_queryRadius(INOUT CE_SpatialHash* hash, IN int32_t x, IN int32_t y, IN int32_t radius, OUT CE_Id results[], IN size_t capacity);
+
+#endif // CORGO_ENGINE_CORE_SPATIAL_HASH_H
@@ -0,0 +1,45 @@
+//
+//  engine/core/transform_kernel.c
+//  Packed 2d position propagation over a flattened hierarchy.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#include "engine/corgo.h"
+
+#if defined(__ARM_FEATURE_SIMD32)
+#include <arm_acle.h>
+#endif
+
+// Add the two int16_t halves separately
+static inline CE_PackedPosition CE_TransformKernel_add(IN CE_PackedPosition a, IN CE_PackedPosition b)
+{
+#if defined(__ARM_FEATURE_SIMD32)
+    // Cortex-M7 has no NEON, but its DSP extension adds both halfwords in one instruction
+    return (CE_PackedPosition)__sadd16((int16x2_t)a, (int16x2_t)b);
+#else
+    // Add without the sign bits so no carry crosses into the Y half, then put the sign bits back
+    return ((a & 0x7FFF7FFFu) + (b & 0x7FFF7FFFu)) ^ ((a ^ b) & 0x80008000u);
+#endif
+}
+
+void CE_TransformKernel_Propagate(IN const CE_PackedPosition* local, IN const uint16_t* parents, OUT CE_PackedPosition* world, IN size_t count)
+{
+    // Each entry depends on an earlier one, so entries are done in order and the speedup is within the entry
+    for (size_t i = 0; i < count; i++) {
+        const uint16_t parent = parents[i];
+        world[i] = parent == CE_TRANSFORM_KERNEL_NO_PARENT ? local[i] : CE_TransformKernel_add(world[parent], local[i]);
+    }
+}
+
+void CE_TransformKernel_PropagateReference(IN const CE_PackedPosition* local, IN const uint16_t* parents, OUT CE_PackedPosition* world, IN size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        int16_t x = CE_PackedPosition_getX(local[i]);
+        int16_t y = CE_PackedPosition_getY(local[i]);
+        if (parents[i] != CE_TRANSFORM_KERNEL_NO_PARENT) {
+            x = (int16_t)(x + CE_PackedPosition_getX(world[parents[i]]));
+            y = (int16_t)(y + CE_PackedPosition_getY(world[parents[i]]));
+        }
+        world[i] = CE_PackedPosition_pack(x, y);
+    }
+}
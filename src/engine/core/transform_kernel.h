@@ -0,0 +1,39 @@
+//
+//  engine/core/transform_kernel.h
+//  Packed 2d position propagation over a flattened hierarchy.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#ifndef CORGO_ENGINE_CORE_TRANSFORM_KERNEL_H
+#define CORGO_ENGINE_CORE_TRANSFORM_KERNEL_H
+
+#include "ecs/types.h"
+
+// Both coordinates of a position in one word, X in the low half and Y in the high half, so one add moves both
+typedef uint32_t CE_PackedPosition;
+
+// Parent index of nodes that are placed at their local position
+#define CE_TRANSFORM_KERNEL_NO_PARENT UINT16_MAX
+
+#define CE_PackedPosition_pack(x, y) ((CE_PackedPosition)(uint16_t)(x) | ((CE_PackedPosition)(uint16_t)(y) << 16))
+#define CE_PackedPosition_getX(position) ((int16_t)(uint16_t)((position) & 0xFFFF))
+#define CE_PackedPosition_getY(position) ((int16_t)(uint16_t)((position) >> 16))
+
+/**
+ * @brief Computes world positions from local ones, world[i] = world[parents[i]] + local[i].
+ * Coordinates wrap around like int16_t additions. Parents must come before their children (parents[i] < i)
+ * or be CE_TRANSFORM_KERNEL_NO_PARENT. Adds both coordinates at once, with the DSP instructions on device.
+ *
+ * @param local[in] Local positions, count entries.
+ * @param parents[in] Parent index of each entry.
+ * @param world[out] Receives the world positions, count entries.
+ * @param count[in] Number of entries.
+ */
+void CE_TransformKernel_Propagate(IN const CE_PackedPosition* local, IN const uint16_t* parents, OUT CE_PackedPosition* world, IN size_t count);
+
+/**
+ * @brief Reference implementation of CE_TransformKernel_Propagate, one coordinate at a time. Used to check the fast path.
+ */
+void CE_TransformKernel_PropagateReference(IN const CE_PackedPosition* local, IN const uint16_t* parents, OUT CE_PackedPosition* world, IN size_t count);
+
+#endif // CORGO_ENGINE_CORE_TRANSFORM_KERNEL_H
@@ -10,4 +10,7 @@
 #define CE_RELATIONSHIP_DESC_ENGINE(CE_RELATIONSHIP_DESC) \
 
 
+#define CE_ONE_WAY_RELATIONSHIP_DESC_ENGINE(CE_ONE_WAY_RELATIONSHIP_DESC) \
+
+
 #endif // CORGO_ENGINE_RELATIONSHIPS_H
\ No newline at end of file
@@ -52,10 +52,8 @@ CE_DECLARE_SCENE_CREATE_FUNCTION(CrankDemo)
         CES_ADD_COMPONENT_EPTR(crank_angle_label, CE_TRANSFORM_COMPONENT, crankAngleTransform);
         CES_ADD_COMPONENT_EPTR(crank_angle_label, CE_TEXT_LABEL_COMPONENT, crankAngleText);
 
-        CES_BUILD_STRING(crankAngleText->m_text, "Crank Angle: 0");
-        
         CES_CHECK_RESULT(
-            CE_TextLabelComponent_update(context, crankAngleText, crankAngleTransform),
+            CE_TextLabelComponent_setText(context, crankAngleText, crankAngleTransform, "Crank Angle: 0"),
             "Failed to set crank angle text");
 
         CES_CHECK_RESULT(
@@ -93,10 +91,8 @@ CE_DECLARE_SCENE_RUN_FUNCTION(CrankDemo)
     }
 
     if (lastAngleRounded != angleRounded) {
-        CES_BUILD_STRING(crankAngleText->m_text, "Crank Angle: ", angleRounded);
-        
         CES_CHECK_RESULT(
-            CE_TextLabelComponent_update(context, crankAngleText, crankAngleTransform),
+            CE_TextLabelComponent_formatText(context, crankAngleText, crankAngleTransform, "Crank Angle: %d", angleRounded),
             "Failed to set crank angle text");
 
         lastAngleRounded = angleRounded;
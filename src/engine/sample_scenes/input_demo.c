@@ -138,6 +138,9 @@ CE_DECLARE_SCENE_CREATE_FUNCTION(InputDemo)
             CE_TextLabelComponent_setFont(context, mapping_text, mapping_transform, "/System/Fonts/Roobert-10-Bold.pft"), 
             "Failed to set font for TextLabelComponent");
 
+        // Only changes when the mapping does
+        CE_TextLabelComponent_setCached(context, mapping_text, true);
+
         CES_CHECK_RESULT(
         CE_TransformComponent_setPosition(context, mapping_transform, (CE_GetDisplayWidth(context)-mapping_transform->m_width)/2, 160),
         "Failed to set position for TransformComponent");
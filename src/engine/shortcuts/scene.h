@@ -26,6 +26,21 @@
         return CE_ERROR;\
     }
 
+/**
+ * @brief Macro to create several entities at once and check for errors.
+ * Declares an array of count entity IDs named 'name'. Prints error and returns CE_ERROR if creation fails.
+ * 
+ * @param name[in] The name of the array to hold the new entity IDs. Must be a valid C identifier.
+ * @param count[in] Number of entities to create, must be a compile time constant.
+ * @return void
+ */
+#define CES_CREATE_ENTITIES(name, count)\
+    CE_Id name[count];\
+    if (CE_ECS_CreateEntities(context, count, name, errorCode) != CE_OK) {\
+        CE_Error("Failed to create entities: " #name " Error: %s", CE_GetErrorMessage(*errorCode));\
+        return CE_ERROR;\
+    }
+
 // Component shortcuts
 
 /**
@@ -74,6 +89,20 @@
         return CE_ERROR;\
     }
 
+/**
+ * @brief Macro to add one component of each type in a bitset to an entity without storing pointers or ids.
+ * Prints error and returns CE_ERROR if adding the components fails.
+ * 
+ * @param entity[in] The entity ID to add the components to.
+ * @param mask[in] Pointer to a CE_Bitset with one bit set per component type.
+ * @return void
+ */
+#define CES_ADD_COMPONENTS(entity, mask)\
+    if (CE_Entity_AddComponents(context, entity, mask, NULL, 0, NULL, errorCode) != CE_OK) {\
+        CE_Error("Failed to add components " #mask " to entity: %s", CE_GetErrorMessage(*errorCode));\
+        return CE_ERROR;\
+    }
+
 // Generic error handling
 /**
  * @brief Macro to check the result of an operation and print an error message if it failed.
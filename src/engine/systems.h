@@ -32,9 +32,31 @@
 #define CE_IMAGE_SYSTEM_DEPENDENCIES \
     REQUIRE_COMPONENT(CE_IMAGE_COMPONENT, imageComponent)\
 
+#define CE_SPRITE_ANIMATION_SYSTEM_DEPENDENCIES \
+    REQUIRE_COMPONENT(CE_SPRITE_ANIMATION_COMPONENT, animationComponent)\
+    REQUIRE_COMPONENT(CE_TRANSFORM_COMPONENT, transformComponent)\
+
+#define CE_SPRITE_ANIMATION_RENDERER_DEPENDENCIES \
+    REQUIRE_COMPONENT(CE_SPRITE_ANIMATION_COMPONENT, animationComponent)\
+
+#define CE_TILEMAP_SYSTEM_DEPENDENCIES \
+    REQUIRE_COMPONENT(CE_TILEMAP_COMPONENT, tilemapComponent)\
+
+#define CE_PARTICLE_EMITTER_SYSTEM_DEPENDENCIES \
+    REQUIRE_COMPONENT(CE_PARTICLE_EMITTER_COMPONENT, emitterComponent)\
+    REQUIRE_COMPONENT(CE_TRANSFORM_COMPONENT, transformComponent)\
+
+#define CE_PARTICLE_EMITTER_RENDERER_DEPENDENCIES \
+    REQUIRE_COMPONENT(CE_PARTICLE_EMITTER_COMPONENT, emitterComponent)\
+
 #define CE_SYSTEM_DESC_ENGINE(CE_SYSTEM_DESC) \
+    CE_SYSTEM_DESC(CE_SPRITE_ANIMATION_SYSTEM, CE_ECS_SYSTEM_RUN_ORDER_AUTO, CE_ECS_SYSTEM_RUN_PHASE_LATE, CE_ECS_SYSTEM_RUN_FREQUENCY_DISPLAY, CE_SPRITE_ANIMATION_SYSTEM_DEPENDENCIES)\
     CE_SYSTEM_DESC(CE_TEXT_LABEL_RENDERER, CE_ECS_SYSTEM_RUN_ORDER_RENDER, CE_ECS_SYSTEM_RUN_PHASE_DEFAULT, CE_ECS_SYSTEM_RUN_FREQUENCY_DISPLAY, CE_TEXT_LABEL_SYSTEM_DEPENDENCIES)\
     CE_SYSTEM_DESC(CE_IMAGE_RENDERER, CE_ECS_SYSTEM_RUN_ORDER_RENDER, CE_ECS_SYSTEM_RUN_PHASE_DEFAULT, CE_ECS_SYSTEM_RUN_FREQUENCY_DISPLAY, CE_IMAGE_SYSTEM_DEPENDENCIES)\
+    CE_SYSTEM_DESC(CE_SPRITE_ANIMATION_RENDERER, CE_ECS_SYSTEM_RUN_ORDER_RENDER, CE_ECS_SYSTEM_RUN_PHASE_DEFAULT, CE_ECS_SYSTEM_RUN_FREQUENCY_DISPLAY, CE_SPRITE_ANIMATION_RENDERER_DEPENDENCIES)\
+    CE_SYSTEM_DESC(CE_TILEMAP_RENDERER, CE_ECS_SYSTEM_RUN_ORDER_RENDER, CE_ECS_SYSTEM_RUN_PHASE_DEFAULT, CE_ECS_SYSTEM_RUN_FREQUENCY_DISPLAY, CE_TILEMAP_SYSTEM_DEPENDENCIES)\
+    CE_SYSTEM_DESC(CE_PARTICLE_EMITTER_SYSTEM, CE_ECS_SYSTEM_RUN_ORDER_AUTO, CE_ECS_SYSTEM_RUN_PHASE_LATE, CE_ECS_SYSTEM_RUN_FREQUENCY_DISPLAY, CE_PARTICLE_EMITTER_SYSTEM_DEPENDENCIES)\
+    CE_SYSTEM_DESC(CE_PARTICLE_EMITTER_RENDERER, CE_ECS_SYSTEM_RUN_ORDER_RENDER, CE_ECS_SYSTEM_RUN_PHASE_DEFAULT, CE_ECS_SYSTEM_RUN_FREQUENCY_DISPLAY, CE_PARTICLE_EMITTER_RENDERER_DEPENDENCIES)\
     CE_ENGINE_DEBUG_SYSTEMS(CE_SYSTEM_DESC)
     
 
@@ -21,6 +21,23 @@ CE_START_GLOBAL_SYSTEM_IMPLEMENTATION(CE_ENGINE_GLOBAL_DEBUG_SYSTEM)
         #ifdef CE_BACKEND_PLAYDATE
             CE_GetPlaydateAPI()->system->drawFPS(0,0);
         #endif
+        CE_DirtyRegion_AddRect(context, 0, 0, CE_GetDisplayWidth(context), 16); // Drawn over the scene, erased with it next frame
+    }
+    if (globalDebugComponent->m_showRenderStats) {
+        #ifdef CE_BACKEND_PLAYDATE
+            CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_SCENE_GRAPH_COMPONENT, sceneGraph);
+            CE_ECS_AccessGlobalComponentToVariable(context, CE_ENGINE_RENDER_COMMANDS, renderCommands);
+            const char *stats = CE_FrameArena_Sprintf(context, "draw %u cull %u state %u", (unsigned)cc_size(&sceneGraph->m_renderQueue), (unsigned)sceneGraph->m_culledCount, (unsigned)renderCommands->m_stateChanges);
+            if (stats != NULL) {
+                // Overlay is in screen space, the camera offset is put back for anything reading it before the next frame
+                const int drawOffsetX = CE_GetDisplayDrawOffsetX(context);
+                const int drawOffsetY = CE_GetDisplayDrawOffsetY(context);
+                CE_Display_SetDrawOffset(context, 0, 0);
+                CE_GetPlaydateAPI()->graphics->drawText(stats, strlen(stats), kASCIIEncoding, 0, 16);
+                CE_Display_SetDrawOffset(context, drawOffsetX, drawOffsetY);
+            }
+        #endif
+        CE_DirtyRegion_AddRect(context, 0, 16, CE_GetDisplayWidth(context), 16);
     }
 }
 CE_END_GLOBAL_SYSTEM_IMPLEMENTATION
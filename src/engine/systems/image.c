@@ -8,7 +8,6 @@
 
 CE_START_SYSTEM_IMPLEMENTATION(CE_IMAGE_RENDERER, CE_IMAGE_SYSTEM_DEPENDENCIES)
 {
-#ifdef CE_BACKEND_PLAYDATE
     CE_SceneGraphRenderNode* renderNode = CE_Scene_GetRenderNode(context, entity);
     if (renderNode == NULL) {
         return CE_OK; // Entity not in scene graph, skip rendering
@@ -19,7 +18,22 @@ CE_START_SYSTEM_IMPLEMENTATION(CE_IMAGE_RENDERER, CE_IMAGE_SYSTEM_DEPENDENCIES)
         return CE_OK; // Image not set yet, skip rendering
     }
     
-    CE_GetPlaydateAPI()->graphics->drawBitmap(imageComponent->m_imagePtr, renderNode->m_x, renderNode->m_y, kBitmapUnflipped);
-#endif
+    if (renderNode->m_rotation == 0 && renderNode->m_scale == CE_TRANSFORM_SCALE_ONE)
+    {
+        return CE_RenderCommands_AddBitmap(context, renderNode->m_layer, imageComponent->m_imagePtr, CE_Scene_GetDrawX(context, renderNode), CE_Scene_GetDrawY(context, renderNode), renderNode->m_width, renderNode->m_height, CE_DRAW_FLIP_NONE, CE_DRAW_MODE_COPY, errorCode);
+    }
+
+    // Rotated and scaled images are a plain blit of a cached variant, centered on the node
+    const void *bitmap = NULL;
+    uint16_t width = 0, height = 0;
+    CE_BitmapCache_Get(context, imageComponent->m_imagePtr, renderNode->m_rotation, renderNode->m_scale, &bitmap, &width, &height);
+    if (width == 0 || height == 0)
+    {
+        width = (uint16_t)renderNode->m_width;
+        height = (uint16_t)renderNode->m_height;
+    }
+    const int x = CE_Scene_GetDrawX(context, renderNode) + (renderNode->m_width - (int)width) / 2;
+    const int y = CE_Scene_GetDrawY(context, renderNode) + (renderNode->m_height - (int)height) / 2;
+    return CE_RenderCommands_AddBitmap(context, renderNode->m_layer, bitmap, x, y, width, height, CE_DRAW_FLIP_NONE, CE_DRAW_MODE_COPY, errorCode);
 }
 CE_END_SYSTEM_IMPLEMENTATION
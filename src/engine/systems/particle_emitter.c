@@ -0,0 +1,66 @@
+//
+//  engine/systems/particle_emitter.c
+//  Systems that deal with particle emitters.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#include "engine/corgo.h"
+
+CE_START_SYSTEM_IMPLEMENTATION(CE_PARTICLE_EMITTER_SYSTEM, CE_PARTICLE_EMITTER_SYSTEM_DEPENDENCIES)
+{
+    CE_ParticleEmitterComponent_update(context, emitterComponent, transformComponent, deltaTime);
+}
+CE_END_SYSTEM_IMPLEMENTATION
+
+CE_START_SYSTEM_IMPLEMENTATION(CE_PARTICLE_EMITTER_RENDERER, CE_PARTICLE_EMITTER_RENDERER_DEPENDENCIES)
+{
+    CE_SceneGraphRenderNode* renderNode = CE_Scene_GetRenderNode(context, entity);
+    if (renderNode == NULL) {
+        return CE_OK; // Entity not in scene graph, skip rendering
+    }
+
+    const int drawX = CE_Scene_GetDrawX(context, renderNode);
+    const int drawY = CE_Scene_GetDrawY(context, renderNode);
+    const int drawOffsetX = CE_GetDisplayDrawOffsetX(context);
+    const int drawOffsetY = CE_GetDisplayDrawOffsetY(context);
+    const int halfWidth = emitterComponent->m_frameWidth / 2;
+    const int halfHeight = emitterComponent->m_frameHeight / 2;
+
+    // One command per particle, all sharing the same few draw states so the submit groups them. The scene graph culls
+    // and erases the particles through the overflow of the emitter transform, here only the ones off screen are skipped
+    const bool toScreen = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_RENDER_COMMANDS)->m_target == CE_RENDER_TARGET_SCREEN;
+    const int viewWidth = CE_GetDisplayWidth(context);
+    const int viewHeight = CE_GetDisplayHeight(context);
+    const float *x = emitterComponent->m_x;
+    const float *y = emitterComponent->m_y;
+    for (uint16_t i = 0; i < emitterComponent->m_count; i++)
+    {
+        const int particleX = drawX + (int)x[i] - halfWidth;
+        const int particleY = drawY + (int)y[i] - halfHeight;
+        if (toScreen && (particleX + drawOffsetX >= viewWidth || particleX + drawOffsetX + emitterComponent->m_frameWidth <= 0
+            || particleY + drawOffsetY >= viewHeight || particleY + drawOffsetY + emitterComponent->m_frameHeight <= 0))
+        {
+            continue;
+        }
+
+        CE_Result result;
+        if (emitterComponent->m_tablePtr == NULL)
+        {
+            result = CE_RenderCommands_AddRect(context, renderNode->m_layer, particleX, particleY, 1, 1, CE_DRAW_MODE_FILL_BLACK, errorCode);
+        }
+        else
+        {
+            const void *bitmap = NULL;
+#ifdef CE_BACKEND_PLAYDATE
+            bitmap = CE_GetPlaydateAPI()->graphics->getTableBitmap(emitterComponent->m_tablePtr, emitterComponent->m_frame[i]);
+#endif
+            result = CE_RenderCommands_AddBitmap(context, renderNode->m_layer, bitmap, particleX, particleY, emitterComponent->m_frameWidth, emitterComponent->m_frameHeight, CE_DRAW_FLIP_NONE, CE_DRAW_MODE_COPY, errorCode);
+        }
+        if (result != CE_OK)
+        {
+            return CE_ERROR;
+        }
+    }
+    return CE_OK;
+}
+CE_END_SYSTEM_IMPLEMENTATION
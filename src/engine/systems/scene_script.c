@@ -6,6 +6,105 @@
 
 #include "engine/corgo.h"
 
+// Advance a background load by one stage, the current scene keeps running in between
+static CE_Result CE_Engine_SceneScript_stepBackgroundLoad(INOUT CE_ECS_Context* context, INOUT CE_SceneScriptComponent* sceneScriptComp, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_ECS_Context *shadowContext = sceneScriptComp->m_shadowContext;
+    CE_Scene *pendingScene = &sceneScriptComp->m_pendingScene;
+
+    switch (sceneScriptComp->m_backgroundState)
+    {
+        case CE_SCENE_BACKGROUND_LOAD_NONE:
+            break;
+        case CE_SCENE_BACKGROUND_LOAD_START:
+        {
+            // Consume the request up front, a failed load must not be picked up later by the unload path
+            const CE_LoadSceneDataFunction loadSceneDataFunction = sceneScriptComp->m_loadSceneDataFunction;
+            sceneScriptComp->m_loadSceneDataFunction = NULL;
+
+            shadowContext = CE_realloc(NULL, sizeof(CE_ECS_Context));
+            if (shadowContext == NULL) {
+                CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_OUT_OF_MEMORY);
+                return CE_ERROR;
+            }
+            if (CE_ECS_Init(shadowContext, errorCode) != CE_OK) {
+                CE_free(shadowContext);
+                return CE_ERROR;
+            }
+            sceneScriptComp->m_shadowContext = shadowContext;
+
+            // Reuse the loaded assets and build with the same display settings
+            CE_Engine_ShareAssetCache(shadowContext, context);
+            *CE_ECS_AccessGlobalComponent(shadowContext, CE_ENGINE_DISPLAY_COMPONENT) = *CE_ECS_AccessGlobalComponent(context, CE_ENGINE_DISPLAY_COMPONENT);
+
+            CE_Engine_Scene_Clear(pendingScene);
+            if (loadSceneDataFunction == NULL || loadSceneDataFunction(shadowContext, pendingScene, errorCode) != CE_OK) {
+                return CE_ERROR;
+            }
+            if (pendingScene->m_id == NULL || pendingScene->m_createFunction == NULL) {
+                CE_Error("Invalid scene data loaded for background load.");
+                CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INTERNAL_ERROR);
+                return CE_ERROR;
+            }
+
+            CE_Debug("Building scene in the background: %s", pendingScene->m_id);
+            if (CE_Engine_SceneGraph_Init(shadowContext, errorCode) != CE_OK) {
+                return CE_ERROR;
+            }
+            if (pendingScene->m_scriptDataComponentType != CE_INVALID_TYPE_ID
+                && CE_Entity_AddComponent(shadowContext, CE_Scene_GetRootId(shadowContext), pendingScene->m_scriptDataComponentType, NULL, &sceneScriptComp->m_pendingScriptData, errorCode) != CE_OK) {
+                return CE_ERROR;
+            }
+            if (pendingScene->m_createFunction(shadowContext, sceneScriptComp->m_pendingScriptData, errorCode) != CE_OK) {
+                return CE_ERROR;
+            }
+
+            sceneScriptComp->m_buildStep = 0;
+            sceneScriptComp->m_backgroundState = pendingScene->m_buildStepFunction != NULL ? CE_SCENE_BACKGROUND_LOAD_BUILDING : CE_SCENE_BACKGROUND_LOAD_SWAP;
+            break;
+        }
+        case CE_SCENE_BACKGROUND_LOAD_BUILDING:
+        {
+            bool done = false;
+            if (pendingScene->m_buildStepFunction(shadowContext, sceneScriptComp->m_pendingScriptData, sceneScriptComp->m_buildStep, &done, errorCode) != CE_OK) {
+                return CE_ERROR;
+            }
+            sceneScriptComp->m_buildStep++;
+            if (done) {
+                sceneScriptComp->m_backgroundState = CE_SCENE_BACKGROUND_LOAD_SWAP;
+            }
+            break;
+        }
+        case CE_SCENE_BACKGROUND_LOAD_SWAP:
+            // Exchange the scenes, only pointers and fixed size tables move so this is cheap whatever the scene size
+            CE_Debug("Switching to background scene: %s", pendingScene->m_id);
+            CE_ECS_SwapEntities(context, shadowContext);
+            CE_ECS_SwapGlobalComponent(context, shadowContext, CE_ENGINE_SCENE_GRAPH_COMPONENT);
+            CE_ECS_SwapGlobalComponent(context, shadowContext, CE_ENGINE_CAMERA_COMPONENT);
+            CE_ECS_SwapGlobalComponent(context, shadowContext, CE_ENGINE_PREFAB_REGISTRY);
+            CE_ECS_SwapGlobalComponent(context, shadowContext, CE_ENGINE_ENTITY_POOL_REGISTRY);
+            CE_DirtyRegion_Invalidate(context); // Nothing on screen belongs to the new scene
+            CE_BitmapCache_Flush(context);
+
+            sceneScriptComp->m_activeScene = *pendingScene;
+            sceneScriptComp->m_scriptData = sceneScriptComp->m_pendingScriptData;
+            sceneScriptComp->m_pendingScriptData = NULL;
+            CE_Engine_Scene_Clear(pendingScene);
+
+            // The previous scene now sits in the shadow context, destroy it on the next frame
+            sceneScriptComp->m_backgroundState = CE_SCENE_BACKGROUND_LOAD_TEARDOWN;
+            break;
+        case CE_SCENE_BACKGROUND_LOAD_TEARDOWN:
+            CE_Engine_SceneScript_DestroyShadowContext(sceneScriptComp);
+            break;
+        default:
+            CE_Error("Invalid background scene load state");
+            return CE_ERROR;
+    }
+
+    return CE_OK;
+}
+
 CE_START_GLOBAL_SYSTEM_IMPLEMENTATION(CE_ENGINE_GLOBAL_SCENE_SCRIPT_SYSTEM)
 {
     CE_SceneScriptComponent* sceneScriptComp = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_SCENE_SCRIPT_COMPONENT);
@@ -66,6 +165,20 @@ CE_START_GLOBAL_SYSTEM_IMPLEMENTATION(CE_ENGINE_GLOBAL_SCENE_SCRIPT_SYSTEM)
                     CE_Engine_Scene_Clear(&sceneScriptComp->m_activeScene);
                     break;
                 }
+
+                // Run the whole incremental construction now, only background loads spread it over frames
+                bool done = sceneScriptComp->m_activeScene.m_buildStepFunction == NULL;
+                for (uint16_t step = 0; !done; step++) {
+                    if (sceneScriptComp->m_activeScene.m_buildStepFunction(context, sceneScriptComp->m_scriptData, step, &done, errorCode) != CE_OK) {
+                        CE_Error("Failed to build scene with error: %s", CE_GetErrorMessage(*errorCode));
+                        break;
+                    }
+                }
+                if (!done) {
+                    sceneScriptComp->m_state = CE_SCENE_STATE_UNLOADING;
+                    CE_Engine_Scene_Clear(&sceneScriptComp->m_activeScene);
+                    break;
+                }
                 CE_Debug("Scene created successfully. Running scene: %s", sceneScriptComp->m_activeScene.m_id);
                 sceneScriptComp->m_state = CE_SCENE_STATE_RUNNING;
             } else {
@@ -84,9 +197,18 @@ CE_START_GLOBAL_SYSTEM_IMPLEMENTATION(CE_ENGINE_GLOBAL_SCENE_SCRIPT_SYSTEM)
                     CE_Error("Failed to run scene: %s. Error: %s", sceneScriptComp->m_activeScene.m_id, CE_GetErrorMessage(*errorCode));
                 }
             }
+
+            // Build the next scene alongside, a failure drops it and the current scene carries on
+            if (CE_Engine_SceneScript_stepBackgroundLoad(context, sceneScriptComp, errorCode) != CE_OK) {
+                CE_Error("Failed to load scene in the background. Error: %s", CE_GetErrorMessage(*errorCode));
+                CE_Engine_SceneScript_DestroyShadowContext(sceneScriptComp);
+            }
             break;
         case CE_SCENE_STATE_UNLOADING:
             CE_Debug("Unloading scene: %s", sceneScriptComp->m_activeScene.m_id);
+            // Drop any scene being built in the background
+            CE_Engine_SceneScript_DestroyShadowContext(sceneScriptComp);
+
             // Clear scene graph
             if (CE_Engine_SceneGraph_Reset(context, errorCode) == CE_ERROR) {
                 CE_Error("Failed to reset scene graph when unloading scene: %s. Error: %s", sceneScriptComp->m_activeScene.m_id, CE_GetErrorMessage(*errorCode));
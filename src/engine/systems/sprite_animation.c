@@ -0,0 +1,29 @@
+//
+//  engine/systems/sprite_animation.c
+//  Systems that deal with sprite animations.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#include "engine/corgo.h"
+
+CE_START_SYSTEM_IMPLEMENTATION(CE_SPRITE_ANIMATION_SYSTEM, CE_SPRITE_ANIMATION_SYSTEM_DEPENDENCIES)
+{
+    CE_SpriteAnimationComponent_advance(context, animationComponent, transformComponent, deltaTime);
+}
+CE_END_SYSTEM_IMPLEMENTATION
+
+CE_START_SYSTEM_IMPLEMENTATION(CE_SPRITE_ANIMATION_RENDERER, CE_SPRITE_ANIMATION_RENDERER_DEPENDENCIES)
+{
+    CE_SceneGraphRenderNode* renderNode = CE_Scene_GetRenderNode(context, entity);
+    if (renderNode == NULL) {
+        return CE_OK; // Entity not in scene graph, skip rendering
+    }
+
+    if (animationComponent->m_frameBitmap == NULL)
+    {
+        return CE_OK; // No table or frame yet, skip rendering
+    }
+
+    return CE_RenderCommands_AddBitmap(context, renderNode->m_layer, animationComponent->m_frameBitmap, CE_Scene_GetDrawX(context, renderNode), CE_Scene_GetDrawY(context, renderNode), renderNode->m_width, renderNode->m_height, (CE_DrawFlip)animationComponent->m_flip, CE_DRAW_MODE_COPY, errorCode);
+}
+CE_END_SYSTEM_IMPLEMENTATION
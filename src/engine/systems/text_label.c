@@ -8,7 +8,6 @@
 
 CE_START_SYSTEM_IMPLEMENTATION(CE_TEXT_LABEL_RENDERER, CE_TEXT_LABEL_SYSTEM_DEPENDENCIES)
 {
-#ifdef CE_BACKEND_PLAYDATE
     CE_SceneGraphRenderNode* renderNode = CE_Scene_GetRenderNode(context, entity);
     if (renderNode == NULL) {
         return CE_OK; // Entity not in scene graph, skip rendering
@@ -19,21 +18,20 @@ CE_START_SYSTEM_IMPLEMENTATION(CE_TEXT_LABEL_RENDERER, CE_TEXT_LABEL_SYSTEM_DEPE
         return CE_OK; // Font not set yet, skip rendering
     }
 
-    LCDBitmapDrawMode previousDrawMode = kDrawModeCopy;
-    if (textLabelComponent->m_inverted) {
-        previousDrawMode = CE_GetPlaydateAPI()->graphics->setDrawMode(kDrawModeFillWhite);
-    }
-
-    const char *text = textLabelComponent->m_staticTextPtr != NULL ? textLabelComponent->m_staticTextPtr : cc_first(&textLabelComponent->m_text);
-    const int textLength = (int)(textLabelComponent->m_staticTextPtr != NULL ? strlen(textLabelComponent->m_staticTextPtr) : cc_size(&textLabelComponent->m_text));
+    const CE_DrawMode drawMode = textLabelComponent->m_inverted ? CE_DRAW_MODE_FILL_WHITE : CE_DRAW_MODE_COPY;
 
-    CE_GetPlaydateAPI()->graphics->setFont(textLabelComponent->m_fontPtr);
-    CE_GetPlaydateAPI()->graphics->drawText(text, textLength, kASCIIEncoding, renderNode->m_x, renderNode->m_y);
-
-    if (textLabelComponent->m_inverted) {
-        CE_GetPlaydateAPI()->graphics->setDrawMode(previousDrawMode);
+    // A cached label is a plain bitmap blit, the fill draw modes color it like the text
+    const void *cacheBitmap = NULL;
+    if (CE_TextLabelComponent_getCacheBitmap(context, textLabelComponent, renderNode->m_width, renderNode->m_height, &cacheBitmap, errorCode) != CE_OK)
+    {
+        return CE_ERROR;
     }
-#endif
+    if (cacheBitmap != NULL)
+    {
+        return CE_RenderCommands_AddBitmap(context, renderNode->m_layer, cacheBitmap, CE_Scene_GetDrawX(context, renderNode), CE_Scene_GetDrawY(context, renderNode), renderNode->m_width, renderNode->m_height, CE_DRAW_FLIP_NONE, drawMode, errorCode);
+    }
+
+    return CE_RenderCommands_AddText(context, renderNode->m_layer, textLabelComponent->m_fontPtr, CE_TextLabelComponent_getText(textLabelComponent), textLabelComponent->m_textLength, CE_Scene_GetDrawX(context, renderNode), CE_Scene_GetDrawY(context, renderNode), renderNode->m_width, renderNode->m_height, drawMode, errorCode);
 }
 CE_END_SYSTEM_IMPLEMENTATION
 
@@ -0,0 +1,86 @@
+//
+//  engine/systems/tilemap.c
+//  Systems that deal with tilemaps.
+//  Copyright (c) 2026 Carlos Camacho. All rights reserved.
+//
+
+#include "engine/corgo.h"
+
+// Chunks from first to last, inclusive, that overlap the span [0, size) of a map drawn at position
+static bool CE_Engine_Tilemap_visibleChunks(IN int position, IN int size, IN int chunkSize, IN uint16_t chunkCount, OUT uint16_t* first, OUT uint16_t* last)
+{
+    if (chunkCount == 0 || chunkSize <= 0 || position >= size || position + (int)chunkCount * chunkSize <= 0)
+    {
+        return false;
+    }
+    const int start = position < 0 ? -position / chunkSize : 0;
+    const int end = (size - 1 - position) / chunkSize;
+    *first = (uint16_t)start;
+    *last = (uint16_t)(end < chunkCount - 1 ? end : chunkCount - 1);
+    return true;
+}
+
+CE_START_SYSTEM_IMPLEMENTATION(CE_TILEMAP_RENDERER, CE_TILEMAP_SYSTEM_DEPENDENCIES)
+{
+    CE_SceneGraphRenderNode* renderNode = CE_Scene_GetRenderNode(context, entity);
+    if (renderNode == NULL) {
+        return CE_OK; // Entity not in scene graph, skip rendering
+    }
+
+    if (tilemapComponent->m_chunks == NULL || tilemapComponent->m_tilesetPtr == NULL)
+    {
+        return CE_OK; // Empty map or no tileset yet, skip rendering
+    }
+
+    const int drawX = CE_Scene_GetDrawX(context, renderNode);
+    const int drawY = CE_Scene_GetDrawY(context, renderNode);
+    const int chunkWidth = CE_ENGINE_TILEMAP_CHUNK_SIZE * tilemapComponent->m_tileWidth;
+    const int chunkHeight = CE_ENGINE_TILEMAP_CHUNK_SIZE * tilemapComponent->m_tileHeight;
+
+    // Only the chunks on screen are drawn, or all of them when baked into a static layer
+    const bool toScreen = CE_ECS_AccessGlobalComponent(context, CE_ENGINE_RENDER_COMMANDS)->m_target == CE_RENDER_TARGET_SCREEN;
+    const int screenX = drawX + CE_GetDisplayDrawOffsetX(context);
+    const int screenY = drawY + CE_GetDisplayDrawOffsetY(context);
+    uint16_t firstX = 0, lastX = tilemapComponent->m_chunksX - 1;
+    uint16_t firstY = 0, lastY = tilemapComponent->m_chunksY - 1;
+    if (toScreen
+        && (!CE_Engine_Tilemap_visibleChunks(screenX, CE_GetDisplayWidth(context), chunkWidth, tilemapComponent->m_chunksX, &firstX, &lastX)
+            || !CE_Engine_Tilemap_visibleChunks(screenY, CE_GetDisplayHeight(context), chunkHeight, tilemapComponent->m_chunksY, &firstY, &lastY)))
+    {
+        return CE_OK;
+    }
+
+    for (uint16_t chunkY = firstY; chunkY <= lastY; chunkY++)
+    {
+        for (uint16_t chunkX = firstX; chunkX <= lastX; chunkX++)
+        {
+            const CE_TilemapChunk *chunk = &tilemapComponent->m_chunks[(size_t)chunkY * tilemapComponent->m_chunksX + chunkX];
+            int width, height;
+            CE_TilemapComponent_getChunkSize(tilemapComponent, chunkX, chunkY, &width, &height);
+            const int x = drawX + chunkX * chunkWidth;
+            const int y = drawY + chunkY * chunkHeight;
+            if (chunk->m_dirty)
+            {
+                // A chunk drawn before changed tiles, the rest of the map on screen is still valid
+                if (chunk->m_baked && toScreen)
+                {
+                    CE_DirtyRegion_AddRect(context, screenX + chunkX * chunkWidth, screenY + chunkY * chunkHeight, width, height);
+                }
+                if (CE_TilemapComponent_bakeChunk(context, tilemapComponent, chunkX, chunkY, errorCode) != CE_OK)
+                {
+                    return CE_ERROR;
+                }
+            }
+
+            if (chunk->m_bitmap != NULL)
+            {
+                if (CE_RenderCommands_AddBitmap(context, renderNode->m_layer, chunk->m_bitmap, x, y, width, height, CE_DRAW_FLIP_NONE, CE_DRAW_MODE_COPY, errorCode) != CE_OK)
+                {
+                    return CE_ERROR;
+                }
+            }
+        }
+    }
+    return CE_OK;
+}
+CE_END_SYSTEM_IMPLEMENTATION
@@ -21,6 +21,15 @@
  *  Tips:
  *  - Don't forget the backslash at the end of the line when adding new relationships.
  *  - Add relationships in pairs with their reciprocal (e.g., parent-child). 
+ * 
+ * Links that are only ever followed from the source (targets, follows, owned-by) can be one-way instead:
+ * 
+ *   #define CE_ONE_WAY_RELATIONSHIP_DESC_GAME(CE_ONE_WAY_RELATIONSHIP_DESC) \
+ *    CE_ONE_WAY_RELATIONSHIP_DESC(CE_RELATIONSHIP_NAME)
+ * 
+ *  They are only stored on the source entity, so adding and removing them costs half as much.
+ *  The target is not told when the link is made, and when the target is destroyed the link is dropped
+ *  the next time it is queried on the source.
  */
 
 #define CE_RELATIONSHIP_DESC_GAME(CE_RELATIONSHIP_DESC) \
@@ -29,5 +38,11 @@
 
 **/
 
+#define CE_ONE_WAY_RELATIONSHIP_DESC_GAME(CE_ONE_WAY_RELATIONSHIP_DESC) \
+/**
+    CE_ONE_WAY_RELATIONSHIP_DESC(CE_RELATIONSHIP_NAME) \
+
+**/
+
 
 #endif // CORGO_GAME_RELATIONSHIPS_H
\ No newline at end of file
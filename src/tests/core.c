@@ -1,6 +1,7 @@
 #include "unity.h"
 
 #include "ecs/ecs.h"
+#include "ecs/core/ecs_internal.h"
 
 static CE_ECS_Context context;
 
@@ -601,6 +602,33 @@ static void test_CE_Bitset_AllBits(void) {
     }
 }
 
+static void test_CE_Bitset_FindFirstClear(void) {
+    CE_Bitset bitset;
+
+    CE_Bitset_init(&bitset, 100);
+    TEST_ASSERT_EQUAL_size_t(0, CE_Bitset_findFirstClear(&bitset, 0));
+    TEST_ASSERT_EQUAL_size_t(42, CE_Bitset_findFirstClear(&bitset, 42));
+
+    // Fill the first word and part of the second one
+    for (size_t i = 0; i < 40; i++) {
+        CE_Bitset_setBit(&bitset, i);
+    }
+    TEST_ASSERT_EQUAL_size_t(40, CE_Bitset_findFirstClear(&bitset, 0));
+    TEST_ASSERT_EQUAL_size_t(41, CE_Bitset_findFirstClear(&bitset, 41));
+
+    // Holes behind the start index are ignored
+    CE_Bitset_clearBit(&bitset, 3);
+    TEST_ASSERT_EQUAL_size_t(3, CE_Bitset_findFirstClear(&bitset, 0));
+    TEST_ASSERT_EQUAL_size_t(40, CE_Bitset_findFirstClear(&bitset, 4));
+
+    // Full bitset returns the size, even though the last word has spare bits
+    for (size_t i = 0; i < 100; i++) {
+        CE_Bitset_setBit(&bitset, i);
+    }
+    TEST_ASSERT_EQUAL_size_t(100, CE_Bitset_findFirstClear(&bitset, 0));
+    TEST_ASSERT_EQUAL_size_t(100, CE_Bitset_findFirstClear(&bitset, 200));
+}
+
 static void test_CE_EntityConstruction(void) {
     CE_ERROR_CODE errorCode;
     CE_Result result = CE_ERROR;
@@ -871,6 +899,51 @@ void test_Entity_Deletion(void) {
     TEST_ASSERT_FALSE(CE_Entity_IsValid(&context, entity_1));
 }
 
+void test_Entity_SubtreeDeletion(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id ids[5] = { CE_INVALID_ID, CE_INVALID_ID, CE_INVALID_ID, CE_INVALID_ID, CE_INVALID_ID };
+    CE_Id componentId = CE_INVALID_ID;
+
+    // ids[0] is kept, ids[1] is the subtree root with children ids[2] and ids[3], and ids[4] below ids[2]
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntities(&context, 5, ids, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddRelationship(&context, ids[0], CE_RELATIONSHIP_CHILD, ids[1], &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddRelationship(&context, ids[1], CE_RELATIONSHIP_CHILD, ids[2], &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddRelationship(&context, ids[1], CE_RELATIONSHIP_CHILD, ids[3], &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddRelationship(&context, ids[2], CE_RELATIONSHIP_CHILD, ids[4], &errorCode));
+    for (size_t i = 0; i < 5; i++) {
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, ids[i], CE_CORE_DEBUG_COMPONENT, &componentId, NULL, &errorCode));
+    }
+    CE_ECS_ComponentStorage* debugStorage = context.m_storage.m_componentTypeStorage[CE_CORE_DEBUG_COMPONENT];
+    TEST_ASSERT_EQUAL_size_t(5, debugStorage->m_count);
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_DestroySubtree(&context, ids[1], &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_NONE, errorCode);
+
+    // Only the entity outside the subtree survives, and it no longer points to its destroyed child
+    TEST_ASSERT_TRUE(CE_Entity_IsValid(&context, ids[0]));
+    for (size_t i = 1; i < 5; i++) {
+        TEST_ASSERT_FALSE(CE_Entity_IsValid(&context, ids[i]));
+    }
+    TEST_ASSERT_EQUAL_size_t(1, debugStorage->m_count);
+    TEST_ASSERT_EQUAL_size_t(0, CE_Entity_GetRelationshipCount(&context, ids[0]));
+    TEST_ASSERT_FALSE(CE_Entity_HasRelationship(&context, ids[0], CE_RELATIONSHIP_CHILD));
+
+    // Wiping the scene graph drops every entity in it and its render cache
+    CE_Id node = CE_INVALID_ID;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Init(&context, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &node, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, node, CE_TRANSFORM_COMPONENT, &componentId, NULL, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, CE_Scene_GetRootId(&context), node, false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_NOT_NULL(CE_Scene_GetRenderNode(&context, node));
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Reset(&context, &errorCode));
+    TEST_ASSERT_FALSE(CE_Entity_IsValid(&context, node));
+    TEST_ASSERT_EQUAL_UINT32(CE_INVALID_ID, CE_Scene_GetRootId(&context));
+    TEST_ASSERT_EQUAL_size_t(0, cc_size(&CE_ECS_AccessGlobalComponent(&context, CE_ENGINE_SCENE_GRAPH_COMPONENT)->m_renderList));
+    TEST_ASSERT_TRUE(CE_Entity_IsValid(&context, ids[0]));
+}
+
 void test_Entity_MultipleComponents(void) {
     CE_ERROR_CODE errorCode;
     CE_Result result = CE_ERROR;
@@ -937,6 +1010,83 @@ void test_Entity_MultipleComponents(void) {
     TEST_ASSERT_FALSE(CE_Entity_HasComponent(&context, entity_1, CE_CORE_DEBUG_COMPONENT));
 }
 
+void test_Entity_BulkCreation(void) {
+    CE_ERROR_CODE errorCode;
+    CE_Result result = CE_ERROR;
+    CE_Id entities[8];
+    CE_Id componentIds[4];
+    size_t componentCount = 0;
+    CE_Bitset mask;
+    CE_TransformComponent* transformData = NULL;
+
+    // Transform is registered as trivial, the debug component has its own init
+    TEST_ASSERT_TRUE(context.m_componentDefinitions[CE_TRANSFORM_COMPONENT].m_isTrivial);
+    TEST_ASSERT_FALSE(context.m_componentDefinitions[CE_CORE_DEBUG_COMPONENT].m_isTrivial);
+
+    // Create a batch of entities
+    result = CE_ECS_CreateEntities(&context, 8, entities, &errorCode);
+    TEST_ASSERT_EQUAL_INT(CE_OK, result);
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_NONE, errorCode);
+    TEST_ASSERT_EQUAL_UINT16(8, context.m_storage.m_entityStorage.m_count);
+    for (size_t i = 0; i < 8; i++) {
+        TEST_ASSERT_TRUE(CE_Entity_IsValid(&context, entities[i]));
+        TEST_ASSERT_EQUAL_UINT32(i, CE_Id_getUniqueId(entities[i]));
+    }
+
+    // Freed slots are reused in order
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_DestroyEntity(&context, entities[2], &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_DestroyEntity(&context, entities[5], &errorCode));
+    CE_Id refill[3];
+    result = CE_ECS_CreateEntities(&context, 3, refill, &errorCode);
+    TEST_ASSERT_EQUAL_INT(CE_OK, result);
+    TEST_ASSERT_EQUAL_UINT32(2, CE_Id_getUniqueId(refill[0]));
+    TEST_ASSERT_EQUAL_UINT32(5, CE_Id_getUniqueId(refill[1]));
+    TEST_ASSERT_EQUAL_UINT32(8, CE_Id_getUniqueId(refill[2]));
+    TEST_ASSERT_FALSE(CE_Entity_IsValid(&context, entities[2])); // Generation was bumped
+
+    // Requests that don't fit fail without creating anything
+    const uint16_t countBefore = context.m_storage.m_entityStorage.m_count;
+    CE_Id tooMany[CE_MAX_ENTITIES];
+    result = CE_ECS_CreateEntities(&context, CE_MAX_ENTITIES, tooMany, &errorCode);
+    TEST_ASSERT_EQUAL_INT(CE_ERROR, result);
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_MAX_ENTITIES_REACHED, errorCode);
+    TEST_ASSERT_EQUAL_UINT16(countBefore, context.m_storage.m_entityStorage.m_count);
+
+    // Add a transform and a debug component in one call
+    CE_Bitset_init(&mask, CE_COMPONENT_TYPES_COUNT);
+    CE_Bitset_setBit(&mask, CE_TRANSFORM_COMPONENT);
+    CE_Bitset_setBit(&mask, CE_CORE_DEBUG_COMPONENT);
+    result = CE_Entity_AddComponents(&context, entities[0], &mask, componentIds, 4, &componentCount, &errorCode);
+    TEST_ASSERT_EQUAL_INT(CE_OK, result);
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_NONE, errorCode);
+    TEST_ASSERT_EQUAL_size_t(2, componentCount);
+    TEST_ASSERT_EQUAL_size_t(2, CE_Entity_GetComponentCount(&context, entities[0]));
+    TEST_ASSERT_TRUE(CE_Entity_HasComponent(&context, entities[0], CE_TRANSFORM_COMPONENT));
+    TEST_ASSERT_TRUE(CE_Entity_HasComponent(&context, entities[0], CE_CORE_DEBUG_COMPONENT));
+    TEST_ASSERT_EQUAL_UINT8(CE_CORE_DEBUG_COMPONENT, CE_Id_getComponentTypeId(componentIds[0])); // Ascending type order
+    TEST_ASSERT_EQUAL_UINT8(CE_TRANSFORM_COMPONENT, CE_Id_getComponentTypeId(componentIds[1]));
+
+    // Dirty the transform, release it and make sure the recycled slot comes back zeroed
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_GetComponent(&context, entities[0], componentIds[1], (void**)&transformData, &errorCode));
+    transformData->m_x = 10;
+    transformData->m_width = 20;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_RemoveComponent(&context, entities[0], componentIds[1], &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entities[1], CE_TRANSFORM_COMPONENT, &componentIds[2], (void**)&transformData, &errorCode));
+    TEST_ASSERT_EQUAL_UINT32(componentIds[1], componentIds[2]);
+    TEST_ASSERT_EQUAL_INT16(0, transformData->m_x);
+    TEST_ASSERT_EQUAL_UINT16(0, transformData->m_width);
+    TEST_ASSERT_EQUAL_INT(CE_TransformComponent_Flags_None, transformData->m_flags);
+
+    // Invalid types are rejected before anything is created
+    CE_Bitset_init(&mask, CE_BITSET_MAX_BITS);
+    CE_Bitset_setBit(&mask, CE_CORE_DEBUG_COMPONENT);
+    CE_Bitset_setBit(&mask, CE_COMPONENT_TYPES_COUNT);
+    result = CE_Entity_AddComponents(&context, entities[3], &mask, NULL, 0, NULL, &errorCode);
+    TEST_ASSERT_EQUAL_INT(CE_ERROR, result);
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_INVALID_COMPONENT_TYPE, errorCode);
+    TEST_ASSERT_EQUAL_size_t(0, CE_Entity_GetComponentCount(&context, entities[3]));
+}
+
 void test_ECS_Relationships(void) {
     CE_ERROR_CODE errorCode;
     CE_Result result = CE_ERROR;
@@ -1103,6 +1253,167 @@ void test_ECS_Clean_Relationships(void) {
     TEST_ASSERT_EQUAL_UINT32(0, CE_Entity_GetRelationshipCount(&context, childEntity2));
 }
 
+void test_ECS_RelationshipTargets(void) {
+    CE_ERROR_CODE errorCode;
+    CE_Id parentEntity = CE_INVALID_ID;
+    CE_Id children[3];
+    const CE_Id *targets = NULL;
+    size_t targetCount = 0;
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &parentEntity, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntities(&context, 3, children, &errorCode));
+
+    // No targets yet
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_GetRelationshipTargets(&context, parentEntity, CE_RELATIONSHIP_CHILD, &targets, &targetCount, &errorCode));
+    TEST_ASSERT_EQUAL_size_t(0, targetCount);
+    TEST_ASSERT_NULL(targets);
+
+    // Add in reverse slot order, targets must come back in insertion order
+    for (size_t i = 3; i > 0; i--) {
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddRelationship(&context, parentEntity, CE_RELATIONSHIP_CHILD, children[i - 1], &errorCode));
+    }
+    // Adding twice does not duplicate the target
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddRelationship(&context, parentEntity, CE_RELATIONSHIP_CHILD, children[0], &errorCode));
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_GetRelationshipTargets(&context, parentEntity, CE_RELATIONSHIP_CHILD, &targets, &targetCount, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_NONE, errorCode);
+    TEST_ASSERT_EQUAL_size_t(3, targetCount);
+    TEST_ASSERT_EQUAL_UINT32(children[2], targets[0]);
+    TEST_ASSERT_EQUAL_UINT32(children[1], targets[1]);
+    TEST_ASSERT_EQUAL_UINT32(children[0], targets[2]);
+
+    // Every child is found, not only the first one of the type
+    bool exists = false;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_HasSpecificRelationship(&context, parentEntity, CE_RELATIONSHIP_CHILD, children[0], &exists, &errorCode));
+    TEST_ASSERT_TRUE(exists);
+
+    // Reciprocals are indexed too
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_GetRelationshipTargets(&context, children[1], CE_RELATIONSHIP_PARENT, &targets, &targetCount, &errorCode));
+    TEST_ASSERT_EQUAL_size_t(1, targetCount);
+    TEST_ASSERT_EQUAL_UINT32(parentEntity, targets[0]);
+
+    // Removing from the middle keeps the order of the others
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_RemoveRelationship(&context, parentEntity, CE_RELATIONSHIP_CHILD, children[1], &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_GetRelationshipTargets(&context, parentEntity, CE_RELATIONSHIP_CHILD, &targets, &targetCount, &errorCode));
+    TEST_ASSERT_EQUAL_size_t(2, targetCount);
+    TEST_ASSERT_EQUAL_UINT32(children[2], targets[0]);
+    TEST_ASSERT_EQUAL_UINT32(children[0], targets[1]);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_GetRelationshipTargets(&context, children[1], CE_RELATIONSHIP_PARENT, &targets, &targetCount, &errorCode));
+    TEST_ASSERT_EQUAL_size_t(0, targetCount);
+
+    // Destroying the whole tree leaves no stale targets behind for the next occupant of the slots
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_DestroySubtree(&context, parentEntity, &errorCode));
+    CE_Id reused = CE_INVALID_ID;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &reused, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_GetRelationshipTargets(&context, reused, CE_RELATIONSHIP_CHILD, &targets, &targetCount, &errorCode));
+    TEST_ASSERT_EQUAL_size_t(0, targetCount);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_GetRelationshipTargets(&context, reused, CE_RELATIONSHIP_PARENT, &targets, &targetCount, &errorCode));
+    TEST_ASSERT_EQUAL_size_t(0, targetCount);
+}
+
+void test_ECS_OneWayRelationships(void) {
+    CE_ERROR_CODE errorCode;
+    CE_Id source = CE_INVALID_ID;
+    CE_Id target = CE_INVALID_ID;
+    const CE_Id *targets = NULL;
+    size_t targetCount = 0;
+
+    TEST_ASSERT_TRUE(CE_ECS_IsOneWayRelationship(CE_RELATIONSHIP_TEST_TARGETS));
+    TEST_ASSERT_FALSE(CE_ECS_IsOneWayRelationship(CE_RELATIONSHIP_CHILD));
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &source, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &target, &errorCode));
+
+    // Only the source stores the link
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddRelationship(&context, source, CE_RELATIONSHIP_TEST_TARGETS, target, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_NONE, errorCode);
+    TEST_ASSERT_EQUAL_size_t(1, CE_Entity_GetRelationshipCount(&context, source));
+    TEST_ASSERT_EQUAL_size_t(0, CE_Entity_GetRelationshipCount(&context, target));
+    TEST_ASSERT_TRUE(CE_Entity_HasRelationship(&context, source, CE_RELATIONSHIP_TEST_TARGETS));
+
+    // Removing does not touch the target either
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_RemoveRelationship(&context, source, CE_RELATIONSHIP_TEST_TARGETS, target, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_NONE, errorCode);
+    TEST_ASSERT_EQUAL_size_t(0, CE_Entity_GetRelationshipCount(&context, source));
+    TEST_ASSERT_FALSE(CE_Entity_HasRelationship(&context, source, CE_RELATIONSHIP_TEST_TARGETS));
+
+    // Destroying the target leaves the link behind until the source is queried
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddRelationship(&context, source, CE_RELATIONSHIP_TEST_TARGETS, target, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_DestroyEntity(&context, target, &errorCode));
+    TEST_ASSERT_EQUAL_size_t(1, CE_Entity_GetRelationshipCount(&context, source));
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_GetRelationshipTargets(&context, source, CE_RELATIONSHIP_TEST_TARGETS, &targets, &targetCount, &errorCode));
+    TEST_ASSERT_EQUAL_size_t(0, targetCount);
+    TEST_ASSERT_EQUAL_size_t(0, CE_Entity_GetRelationshipCount(&context, source));
+    TEST_ASSERT_FALSE(CE_Entity_HasRelationship(&context, source, CE_RELATIONSHIP_TEST_TARGETS));
+
+    // Links to dead entities are refused up front
+    TEST_ASSERT_EQUAL_INT(CE_ERROR, CE_Entity_AddRelationship(&context, source, CE_RELATIONSHIP_TEST_TARGETS, target, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_STALE_ENTITY_ID, errorCode);
+
+    // A new entity in the same slot is not mistaken for the old target
+    CE_Id oldTarget = CE_INVALID_ID;
+    CE_Id recycled = CE_INVALID_ID;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &oldTarget, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddRelationship(&context, source, CE_RELATIONSHIP_TEST_TARGETS, oldTarget, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_DestroyEntity(&context, oldTarget, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &recycled, &errorCode));
+    TEST_ASSERT_EQUAL_UINT16(CE_Id_getUniqueId(oldTarget), CE_Id_getUniqueId(recycled));
+
+    bool exists = true;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_HasSpecificRelationship(&context, source, CE_RELATIONSHIP_TEST_TARGETS, recycled, &exists, &errorCode));
+    TEST_ASSERT_FALSE(exists);
+    TEST_ASSERT_FALSE(CE_Entity_HasRelationship(&context, source, CE_RELATIONSHIP_TEST_TARGETS));
+
+    // Destroying the source with a live one-way link works as usual
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddRelationship(&context, source, CE_RELATIONSHIP_TEST_TARGETS, recycled, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_DestroyEntity(&context, source, &errorCode));
+    TEST_ASSERT_TRUE(CE_Entity_IsValid(&context, recycled));
+    TEST_ASSERT_EQUAL_size_t(0, CE_Entity_GetRelationshipCount(&context, recycled));
+}
+
+void test_ECS_OneWayRelationshipSystem(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id source = CE_INVALID_ID;
+    CE_Id target = CE_INVALID_ID;
+    CE_Id componentId = CE_INVALID_ID;
+    CE_Core_DebugComponent* debugData = NULL;
+    CE_ECS_EntityData* sourceData = NULL;
+    CE_Id_Set* relationships = NULL;
+
+    TEST_ASSERT_TRUE(context.m_systemDefinitions[CE_CORE_TEST_SYSTEM_ONE_WAY].m_requiresOneWayRelationship);
+    TEST_ASSERT_FALSE(context.m_systemDefinitions[CE_CORE_TEST_SYSTEM_REL].m_requiresOneWayRelationship);
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Init(&context, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &source, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &target, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, source, CE_CORE_DEBUG_COMPONENT, &componentId, &debugData, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddRelationship(&context, source, CE_RELATIONSHIP_TEST_TARGETS, target, &errorCode));
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_Tick(&context, 0.0f, &errorCode));
+    TEST_ASSERT_TRUE(debugData->m_ticked_oneWay);
+
+    // Once the target dies the stale link must not match, and the dispatch must not fail
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_DestroyEntity(&context, target, &errorCode));
+    debugData->m_ticked_oneWay = false;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_MainStorage_getEntityData(&context.m_storage, source, &sourceData, &errorCode));
+    TEST_ASSERT_TRUE(CE_Bitset_isBitSet(&sourceData->m_entityRelationshipBitset, CE_RELATIONSHIP_TEST_TARGETS));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_RunSystemOnEntity(&context, 0.0f, CE_CORE_TEST_SYSTEM_ONE_WAY, sourceData));
+    TEST_ASSERT_FALSE(debugData->m_ticked_oneWay);
+    TEST_ASSERT_FALSE(CE_Bitset_isBitSet(&sourceData->m_entityRelationshipBitset, CE_RELATIONSHIP_TEST_TARGETS));
+    TEST_ASSERT_EQUAL_size_t(0, CE_Entity_GetRelationshipCount(&context, source));
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_Tick(&context, 0.0f, &errorCode));
+    TEST_ASSERT_FALSE(debugData->m_ticked_oneWay);
+
+    // The raw relationship set drops dead one-way targets as well
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &target, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddRelationship(&context, source, CE_RELATIONSHIP_TEST_TARGETS, target, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_DestroyEntity(&context, target, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_GetAllRelationshipsIter(&context, source, &relationships, &errorCode));
+    TEST_ASSERT_EQUAL_size_t(0, cc_size(relationships));
+}
+
 void test_ECS_tick(void) {
     CE_ERROR_CODE errorCode = CE_ERROR_CODE_NONE;
     CE_Result result = CE_ERROR;
@@ -1186,6 +1497,44 @@ void test_ECS_tick(void) {
     TEST_ASSERT_TRUE(componentData->m_ticked_second);
 }
 
+void test_ECS_SwapEntities(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id current = CE_INVALID_ID;
+    CE_Id next = CE_INVALID_ID;
+    CE_Id componentId = CE_INVALID_ID;
+    CE_Core_DebugComponent* debugData = NULL;
+
+    CE_ECS_Context* shadow = CE_realloc(NULL, sizeof(CE_ECS_Context));
+    TEST_ASSERT_NOT_NULL(shadow);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_Init(shadow, &errorCode));
+
+    // One entity in the main context, two in the shadow one with a scene graph
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &current, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, current, CE_CORE_DEBUG_COMPONENT, &componentId, (void**)&debugData, &errorCode));
+    debugData->m_testValue = 1;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Init(shadow, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(shadow, &next, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(shadow, next, CE_CORE_DEBUG_COMPONENT, &componentId, (void**)&debugData, &errorCode));
+    debugData->m_testValue = 2;
+    const CE_Id shadowRoot = CE_Scene_GetRootId(shadow);
+
+    CE_ECS_SwapEntities(&context, shadow);
+    CE_ECS_SwapGlobalComponent(&context, shadow, CE_ENGINE_SCENE_GRAPH_COMPONENT);
+
+    TEST_ASSERT_EQUAL_UINT16(2, context.m_storage.m_entityStorage.m_count);
+    TEST_ASSERT_EQUAL_UINT16(1, shadow->m_storage.m_entityStorage.m_count);
+    TEST_ASSERT_EQUAL_UINT32(shadowRoot, CE_Scene_GetRootId(&context));
+    TEST_ASSERT_TRUE(CE_Entity_IsValid(&context, shadowRoot));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_FindFirstComponent(&context, next, CE_CORE_DEBUG_COMPONENT, NULL, (void**)&debugData, &errorCode));
+    TEST_ASSERT_EQUAL_UINT8(2, debugData->m_testValue);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_FindFirstComponent(shadow, current, CE_CORE_DEBUG_COMPONENT, NULL, (void**)&debugData, &errorCode));
+    TEST_ASSERT_EQUAL_UINT8(1, debugData->m_testValue);
+
+    // Each context cleans up what it now holds
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_Cleanup(shadow, &errorCode));
+    CE_free(shadow);
+}
+
 void test_ECS_GlobalComponents(void) {
     CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
     CE_Result result = CE_ERROR;
@@ -1443,6 +1792,1281 @@ void test_SceneGraph(void) {
     TEST_ASSERT_EQUAL_INT(43, debugData1->m_testValue2);
 }
 
+void test_SceneGraph_Hierarchy(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id entities[3];
+    CE_TransformComponent* transforms[3];
+    const CE_SceneGraphHierarchyNode *nodes = NULL;
+    size_t nodeCount = 0;
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Init(&context, &errorCode));
+    const CE_Id rootId = CE_Scene_GetRootId(&context);
+    CE_ECS_AccessGlobalComponentToVariable(&context, CE_ENGINE_CAMERA_COMPONENT, camera);
+    camera->m_x = 0;
+    camera->m_y = 0;
+
+    for (size_t i = 0; i < 3; i++) {
+        CE_Id transformId = CE_INVALID_ID;
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entities[i], &errorCode));
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entities[i], CE_TRANSFORM_COMPONENT, &transformId, (void**)&transforms[i], &errorCode));
+        transforms[i]->m_x = (int16_t)(10 * (i + 1));
+        transforms[i]->m_y = 1;
+    }
+
+    // root -> 0 -> 1, root -> 2
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, rootId, entities[0], false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, entities[0], entities[1], false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, rootId, entities[2], false, &errorCode));
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_GetHierarchy(&context, &nodes, &nodeCount, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_NONE, errorCode);
+    TEST_ASSERT_EQUAL_size_t(4, nodeCount);
+    TEST_ASSERT_EQUAL_UINT32(rootId, nodes[0].m_entityId);
+    TEST_ASSERT_EQUAL_UINT16(CE_SCENE_GRAPH_NO_PARENT, nodes[0].m_parentIndex);
+    TEST_ASSERT_EQUAL_UINT32(entities[0], nodes[1].m_entityId);
+    TEST_ASSERT_EQUAL_UINT16(0, nodes[1].m_parentIndex);
+    TEST_ASSERT_EQUAL_UINT32(entities[2], nodes[2].m_entityId);
+    TEST_ASSERT_EQUAL_UINT16(0, nodes[2].m_parentIndex);
+    TEST_ASSERT_EQUAL_UINT32(entities[1], nodes[3].m_entityId);
+    TEST_ASSERT_EQUAL_UINT16(1, nodes[3].m_parentIndex);
+
+    // World positions come from the parent node in one pass
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_EQUAL_INT16(30, CE_Scene_GetRenderNode(&context, entities[1])->m_x);
+    TEST_ASSERT_EQUAL_INT16(2, CE_Scene_GetRenderNode(&context, entities[1])->m_y);
+    TEST_ASSERT_EQUAL_INT16(30, CE_Scene_GetRenderNode(&context, entities[2])->m_x);
+
+    // Moving a subtree updates the hierarchy on the next access
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_RemoveChild(&context, entities[0], entities[1], &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, entities[2], entities[1], false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_GetHierarchy(&context, &nodes, &nodeCount, &errorCode));
+    TEST_ASSERT_EQUAL_size_t(4, nodeCount);
+    TEST_ASSERT_EQUAL_UINT32(entities[1], nodes[3].m_entityId);
+    TEST_ASSERT_EQUAL_UINT16(2, nodes[3].m_parentIndex);
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_EQUAL_INT16(50, CE_Scene_GetRenderNode(&context, entities[1])->m_x);
+
+    // Destroying a branch drops it as well
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_DestroySubtree(&context, entities[2], &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_GetHierarchy(&context, &nodes, &nodeCount, &errorCode));
+    TEST_ASSERT_EQUAL_size_t(2, nodeCount);
+    TEST_ASSERT_EQUAL_UINT32(entities[0], nodes[1].m_entityId);
+}
+
+void test_SceneGraph_DirtyPropagation(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id entities[3];
+    CE_TransformComponent* transforms[3];
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Init(&context, &errorCode));
+    const CE_Id rootId = CE_Scene_GetRootId(&context);
+    CE_ECS_AccessGlobalComponentToVariable(&context, CE_ENGINE_CAMERA_COMPONENT, camera);
+    camera->m_x = 0;
+    camera->m_y = 0;
+
+    for (size_t i = 0; i < 3; i++) {
+        CE_Id transformId = CE_INVALID_ID;
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entities[i], &errorCode));
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entities[i], CE_TRANSFORM_COMPONENT, &transformId, (void**)&transforms[i], &errorCode));
+        transforms[i]->m_x = 10;
+    }
+
+    // root -> 0 -> 1, root -> 2
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, rootId, entities[0], false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, entities[0], entities[1], false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, rootId, entities[2], false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_EQUAL_INT16(20, CE_Scene_GetRenderNode(&context, entities[1])->m_x);
+
+    // Writes that skip the setters leave the cached render node alone
+    transforms[2]->m_x = 40;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_EQUAL_INT16(10, CE_Scene_GetRenderNode(&context, entities[2])->m_x);
+
+    // A dirty parent drags its subtree along, its sibling is untouched
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TransformComponent_setPosition(&context, transforms[0], 15, 0));
+    TEST_ASSERT_TRUE(CE_TransformComponent_isDirty(transforms[0]));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_FALSE(CE_TransformComponent_isDirty(transforms[0]));
+    TEST_ASSERT_EQUAL_INT16(15, CE_Scene_GetRenderNode(&context, entities[0])->m_x);
+    TEST_ASSERT_EQUAL_INT16(25, CE_Scene_GetRenderNode(&context, entities[1])->m_x);
+    TEST_ASSERT_EQUAL_INT16(10, CE_Scene_GetRenderNode(&context, entities[2])->m_x);
+
+    // The camera is a draw offset, scrolling and shaking leave the render nodes in world space
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_Camera_SetPosition(&context, 5, 3));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_Camera_SetShake(&context, 2, 0));
+    TEST_ASSERT_TRUE(CE_Engine_SceneGraph_IsDirty(&context));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_EQUAL_INT16(15, CE_Scene_GetRenderNode(&context, entities[0])->m_x);
+    TEST_ASSERT_EQUAL_INT16(25, CE_Scene_GetRenderNode(&context, entities[1])->m_x);
+    TEST_ASSERT_EQUAL_INT16(10, CE_Scene_GetRenderNode(&context, entities[2])->m_x);
+
+    CE_Engine_Camera_ApplyDrawOffset(&context);
+    TEST_ASSERT_EQUAL_INT(-3, CE_GetDisplayDrawOffsetX(&context));
+    TEST_ASSERT_EQUAL_INT(-3, CE_GetDisplayDrawOffsetY(&context));
+    TEST_ASSERT_EQUAL_INT(15, CE_Scene_GetDrawX(&context, CE_Scene_GetRenderNode(&context, entities[0])));
+
+    // Fixed nodes and their children are drawn in screen space
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TransformComponent_setPosition(&context, transforms[0], 4, 0));
+    CE_TransformComponent_setFlags(transforms[0], CE_TransformComponent_Flags_FixedPosition);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    const CE_SceneGraphRenderNode *childNode = CE_Scene_GetRenderNode(&context, entities[1]);
+    TEST_ASSERT_TRUE(childNode->m_screenSpace);
+    TEST_ASSERT_EQUAL_INT(14, CE_Scene_GetDrawX(&context, childNode) + CE_GetDisplayDrawOffsetX(&context));
+    TEST_ASSERT_FALSE(CE_Scene_GetRenderNode(&context, entities[2])->m_screenSpace);
+}
+
+void test_SceneGraph_RenderQueue(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    const int16_t zIndices[4] = { 2, -1, 2, 300 };
+    CE_Id entities[4];
+    CE_TransformComponent* transforms[4];
+    const CE_SceneGraphRenderQueueEntry *queue = NULL;
+    size_t queueCount = 0;
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Init(&context, &errorCode));
+    const CE_Id rootId = CE_Scene_GetRootId(&context);
+    CE_ECS_AccessGlobalComponentToVariable(&context, CE_ENGINE_CAMERA_COMPONENT, camera);
+    camera->m_x = 0;
+    camera->m_y = 0;
+
+    for (size_t i = 0; i < 4; i++) {
+        CE_Id transformId = CE_INVALID_ID;
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entities[i], &errorCode));
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entities[i], CE_TRANSFORM_COMPONENT, &transformId, (void**)&transforms[i], &errorCode));
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_TransformComponent_setZIndex(&context, transforms[i], zIndices[i]));
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, rootId, entities[i], false, &errorCode));
+    }
+
+    // Back to front, equal keys keep the scene tree order
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    CE_Engine_SceneGraph_GetRenderQueue(&context, &queue, &queueCount);
+    TEST_ASSERT_EQUAL_size_t(5, queueCount);
+    TEST_ASSERT_EQUAL_UINT16(CE_Id_getUniqueId(entities[1]), queue[0].m_uniqueId);
+    TEST_ASSERT_EQUAL_UINT16(CE_Id_getUniqueId(rootId), queue[1].m_uniqueId);
+    TEST_ASSERT_EQUAL_UINT16(CE_Id_getUniqueId(entities[0]), queue[2].m_uniqueId);
+    TEST_ASSERT_EQUAL_UINT16(CE_Id_getUniqueId(entities[2]), queue[3].m_uniqueId);
+    TEST_ASSERT_EQUAL_UINT16(CE_Id_getUniqueId(entities[3]), queue[4].m_uniqueId);
+
+    // Y sorting uses the bottom edge in place of the Z-index
+    transforms[3]->m_height = 1;
+    CE_TransformComponent_setFlags(transforms[3], CE_TransformComponent_Flags_YZIndex);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    CE_Engine_SceneGraph_GetRenderQueue(&context, &queue, &queueCount);
+    TEST_ASSERT_EQUAL_UINT16(CE_Id_getUniqueId(rootId), queue[1].m_uniqueId);
+    TEST_ASSERT_EQUAL_UINT16(CE_Id_getUniqueId(entities[3]), queue[2].m_uniqueId);
+    TEST_ASSERT_EQUAL_UINT16(CE_Id_getUniqueId(entities[0]), queue[3].m_uniqueId);
+
+    // A Z change is just a new key, the render node stays in place
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TransformComponent_setZIndex(&context, transforms[1], 5));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    CE_Engine_SceneGraph_GetRenderQueue(&context, &queue, &queueCount);
+    TEST_ASSERT_EQUAL_UINT16(CE_Id_getUniqueId(entities[1]), queue[4].m_uniqueId);
+    TEST_ASSERT_EQUAL_INT16(5, CE_Scene_GetRenderNode(&context, entities[1])->m_z);
+}
+
+void test_SceneGraph_Culling(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    const int16_t positions[4] = { 1000, 0, 20, 10 };
+    const uint16_t sizes[4] = { 0, 10, 10, 10 };
+    CE_Id entities[4];
+    CE_TransformComponent* transforms[4];
+    const CE_SceneGraphRenderQueueEntry *queue = NULL;
+    size_t queueCount = 0;
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Init(&context, &errorCode));
+    const CE_Id rootId = CE_Scene_GetRootId(&context);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_Camera_SetPosition(&context, 0, 0));
+
+    for (size_t i = 0; i < 4; i++) {
+        CE_Id transformId = CE_INVALID_ID;
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entities[i], &errorCode));
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entities[i], CE_TRANSFORM_COMPONENT, &transformId, (void**)&transforms[i], &errorCode));
+        transforms[i]->m_x = positions[i];
+        transforms[i]->m_width = sizes[i];
+        transforms[i]->m_height = sizes[i];
+    }
+
+    // An off screen group with two children, and one visible entity
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, rootId, entities[0], false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, entities[0], entities[1], false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, entities[0], entities[2], false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, rootId, entities[3], false, &errorCode));
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    CE_Engine_SceneGraph_GetRenderQueue(&context, &queue, &queueCount);
+    TEST_ASSERT_EQUAL_size_t(2, queueCount);
+    TEST_ASSERT_EQUAL_UINT16(3, CE_ECS_AccessGlobalComponent(&context, CE_ENGINE_SCENE_GRAPH_COMPONENT)->m_culledCount);
+
+    // Subtree bounds cover both children
+    const CE_SceneGraphHierarchyNode *nodes = NULL;
+    size_t nodeCount = 0;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_GetHierarchy(&context, &nodes, &nodeCount, &errorCode));
+    TEST_ASSERT_EQUAL_UINT32(entities[0], nodes[1].m_entityId);
+    TEST_ASSERT_EQUAL_INT32(1000, nodes[1].m_boundsMinX);
+    TEST_ASSERT_EQUAL_INT32(1030, nodes[1].m_boundsMaxX);
+
+    // Scrolling brings the group in and pushes the other entity out
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_Camera_SetPosition(&context, 995, 0));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    CE_Engine_SceneGraph_GetRenderQueue(&context, &queue, &queueCount);
+    TEST_ASSERT_EQUAL_size_t(4, queueCount);
+    TEST_ASSERT_EQUAL_UINT16(1, CE_ECS_AccessGlobalComponent(&context, CE_ENGINE_SCENE_GRAPH_COMPONENT)->m_culledCount);
+    for (size_t i = 0; i < queueCount; i++) {
+        TEST_ASSERT_NOT_EQUAL(CE_Id_getUniqueId(entities[3]), queue[i].m_uniqueId);
+    }
+}
+
+void test_SceneGraph_SpatialHash(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    const int16_t positions[4][2] = { { 10, 10 }, { 100, 100 }, { 60, 10 }, { 10, 10 } };
+    const uint16_t sizes[4] = { 20, 10, 10, 10 };
+    CE_Id entities[4];
+    CE_TransformComponent* transforms[4];
+    CE_Id results[4];
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Init(&context, &errorCode));
+    const CE_Id rootId = CE_Scene_GetRootId(&context);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_Camera_SetPosition(&context, 0, 0));
+
+    for (size_t i = 0; i < 4; i++) {
+        CE_Id transformId = CE_INVALID_ID;
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entities[i], &errorCode));
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entities[i], CE_TRANSFORM_COMPONENT, &transformId, (void**)&transforms[i], &errorCode));
+        transforms[i]->m_x = positions[i][0];
+        transforms[i]->m_y = positions[i][1];
+        transforms[i]->m_width = sizes[i];
+        transforms[i]->m_height = sizes[i];
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, rootId, entities[i], false, &errorCode));
+    }
+    // Screen space entities are not part of the world
+    CE_TransformComponent_setFlags(transforms[3], CE_TransformComponent_Flags_FixedPosition);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+
+    TEST_ASSERT_EQUAL_size_t(2, CE_Scene_QueryRect(&context, 0, 0, 80, 40, results, 4));
+    TEST_ASSERT_TRUE((results[0] == entities[0] && results[1] == entities[2]) || (results[0] == entities[2] && results[1] == entities[0]));
+    TEST_ASSERT_EQUAL_size_t(2, CE_Scene_QueryRect(&context, 0, 0, 80, 40, results, 1));
+
+    // Entities spanning several cells are reported once
+    TEST_ASSERT_EQUAL_size_t(1, CE_Scene_QueryPoint(&context, 65, 15, results, 4));
+    TEST_ASSERT_EQUAL_UINT32(entities[2], results[0]);
+
+    // Corner just inside and just outside the radius
+    TEST_ASSERT_EQUAL_size_t(1, CE_Scene_QueryRadius(&context, 113, 97, 5, results, 4));
+    TEST_ASSERT_EQUAL_UINT32(entities[1], results[0]);
+    TEST_ASSERT_EQUAL_size_t(0, CE_Scene_QueryRadius(&context, 114, 97, 5, results, 4));
+
+    // Moves are picked up by the next render list update
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TransformComponent_setPosition(&context, transforms[1], 12, 12));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_EQUAL_size_t(2, CE_Scene_QueryPoint(&context, 15, 15, results, 4));
+    TEST_ASSERT_EQUAL_size_t(0, CE_Scene_QueryRect(&context, 100, 100, 10, 10, results, 4));
+
+    // Destroyed entities leave right away
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_DestroyEntity(&context, entities[0], &errorCode));
+    TEST_ASSERT_EQUAL_size_t(1, CE_Scene_QueryPoint(&context, 15, 15, results, 4));
+    TEST_ASSERT_EQUAL_UINT32(entities[1], results[0]);
+
+    // Only occupied cells are kept, crossing the world does not leave empty ones behind
+    CE_SceneGraphComponent *sceneGraph = CE_ECS_AccessGlobalComponent(&context, CE_ENGINE_SCENE_GRAPH_COMPONENT);
+    TEST_ASSERT_EQUAL_size_t(2, cc_size(&sceneGraph->m_spatialHash.m_cells));
+    for (int16_t x = 1000; x <= 9000; x += 1000) {
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_TransformComponent_setPosition(&context, transforms[2], x, x));
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    }
+    TEST_ASSERT_EQUAL_size_t(2, cc_size(&sceneGraph->m_spatialHash.m_cells));
+
+    // A rectangle over the whole world goes through the few occupied cells
+    TEST_ASSERT_EQUAL_size_t(2, CE_Scene_QueryRect(&context, INT16_MIN, INT16_MIN, UINT16_MAX, UINT16_MAX, results, 4));
+    TEST_ASSERT_EQUAL_size_t(1, CE_Scene_QueryRect(&context, 8000, 8000, 2000, 2000, results, 4));
+    TEST_ASSERT_EQUAL_UINT32(entities[2], results[0]);
+}
+
+void test_TransformKernel(void) {
+    enum { NODE_COUNT = 300 };
+    static CE_PackedPosition local[NODE_COUNT];
+    static uint16_t parents[NODE_COUNT];
+    static CE_PackedPosition world[NODE_COUNT];
+    static CE_PackedPosition reference[NODE_COUNT];
+
+    // Carries and borrows stay within their half
+    local[0] = CE_PackedPosition_pack(-1, 5);
+    local[1] = CE_PackedPosition_pack(1, 1);
+    local[2] = CE_PackedPosition_pack(INT16_MAX, INT16_MIN);
+    parents[0] = CE_TRANSFORM_KERNEL_NO_PARENT;
+    parents[1] = 0;
+    parents[2] = 1;
+    CE_TransformKernel_Propagate(local, parents, world, 3);
+    TEST_ASSERT_EQUAL_INT16(0, CE_PackedPosition_getX(world[1]));
+    TEST_ASSERT_EQUAL_INT16(6, CE_PackedPosition_getY(world[1]));
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, CE_PackedPosition_getX(world[2]));
+    TEST_ASSERT_EQUAL_INT16(INT16_MIN + 6, CE_PackedPosition_getY(world[2]));
+
+    // Random trees, the packed path must match the reference bit for bit
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < NODE_COUNT; i++) {
+        seed = seed * 1103515245u + 12345u;
+        const uint32_t random = seed >> 8;
+        parents[i] = (i == 0 || random % 7 == 0) ? CE_TRANSFORM_KERNEL_NO_PARENT : (uint16_t)(random % i);
+        local[i] = CE_PackedPosition_pack((int16_t)(random * 31u), (int16_t)(random >> 3));
+    }
+    CE_TransformKernel_Propagate(local, parents, world, NODE_COUNT);
+    CE_TransformKernel_PropagateReference(local, parents, reference, NODE_COUNT);
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(reference, world, NODE_COUNT);
+}
+
+static CE_Result test_FrameArena_countNode(IN CE_ECS_Context* context, IN CE_Id entityId, IN CE_Id parentId, INOUT void* userData, CE_ERROR_CODE* errorCode) {
+    (void)context;
+    (void)entityId;
+    (void)parentId;
+    (void)errorCode;
+    (*(size_t*)userData)++;
+    return CE_OK;
+}
+
+void test_FrameArena(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+
+    // Allocations are aligned and rewinding gives the memory back
+    const size_t mark = CE_FrameArena_GetMark(&context);
+    uint8_t *bytes = CE_FrameArena_Alloc(&context, 3);
+    uint32_t *words = CE_FrameArena_AllocArray(&context, uint32_t, 4);
+    TEST_ASSERT_NOT_NULL(bytes);
+    TEST_ASSERT_NOT_NULL(words);
+    TEST_ASSERT_EQUAL_UINT(0, (uintptr_t)words % 8);
+    TEST_ASSERT_TRUE((uint8_t*)words >= bytes + 3);
+    CE_FrameArena_Rewind(&context, mark);
+    TEST_ASSERT_EQUAL_PTR(bytes, CE_FrameArena_Alloc(&context, 1));
+    CE_FrameArena_Rewind(&context, mark);
+
+    char *text = CE_FrameArena_Sprintf(&context, "draw %u cull %u", 12u, 3u);
+    TEST_ASSERT_EQUAL_STRING("draw 12 cull 3", text);
+    CE_FrameArena_Rewind(&context, mark);
+
+    // A full arena fails instead of growing
+    TEST_ASSERT_NULL(CE_FrameArena_Alloc(&context, CE_ENGINE_FRAME_ARENA_SIZE + 1));
+    TEST_ASSERT_NOT_NULL(CE_FrameArena_Alloc(&context, CE_ENGINE_FRAME_ARENA_SIZE - mark));
+    TEST_ASSERT_NULL(CE_FrameArena_Alloc(&context, 1));
+    CE_FrameArena_Rewind(&context, mark);
+
+    // Traversal takes its stack from the arena and gives it back
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Init(&context, &errorCode));
+    const CE_Id rootId = CE_Scene_GetRootId(&context);
+    CE_Id entities[3];
+    for (size_t i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entities[i], &errorCode));
+    }
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, rootId, entities[0], false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, entities[0], entities[1], false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, rootId, entities[2], false, &errorCode));
+
+    size_t visited = 0;
+    const size_t traverseMark = CE_FrameArena_GetMark(&context);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Traverse(&context, rootId, test_FrameArena_countNode, &visited, &errorCode));
+    TEST_ASSERT_EQUAL_size_t(4, visited);
+    TEST_ASSERT_EQUAL_size_t(traverseMark, CE_FrameArena_GetMark(&context));
+}
+
+void test_RenderCommands(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    const CE_RenderCommand *commands = NULL;
+    size_t count = 0;
+    static const int bitmapA = 0, bitmapB = 0, font = 0;
+
+    // Recorded in render queue order, drawn grouped by layer then state
+    CE_RenderCommands_Clear(&context);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_RenderCommands_AddBitmap(&context, 2, &bitmapA, 0, 0, 1, 1, CE_DRAW_FLIP_NONE, CE_DRAW_MODE_COPY, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_RenderCommands_AddText(&context, 2, &font, "hi", 2, 1, 0, 1, 1, CE_DRAW_MODE_FILL_WHITE, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_RenderCommands_AddBitmap(&context, 2, &bitmapB, 2, 0, 1, 1, CE_DRAW_FLIP_X, CE_DRAW_MODE_COPY, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_RenderCommands_AddBitmap(&context, 2, &bitmapA, 3, 0, 1, 1, CE_DRAW_FLIP_NONE, CE_DRAW_MODE_COPY, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_RenderCommands_AddBitmap(&context, 1, &bitmapB, 4, 0, 1, 1, CE_DRAW_FLIP_NONE, CE_DRAW_MODE_COPY, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_RenderCommands_Submit(&context, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_NONE, errorCode);
+
+    CE_RenderCommands_GetCommands(&context, &commands, &count);
+    TEST_ASSERT_EQUAL_size_t(5, count);
+    const int16_t expectedX[5] = { 4, 0, 3, 1, 2 };
+    for (size_t i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL_INT16(expectedX[i], commands[i].m_x);
+    }
+    TEST_ASSERT_EQUAL_PTR(&font, commands[3].m_resource);
+    TEST_ASSERT_EQUAL_STRING_LEN("hi", commands[3].m_text, commands[3].m_textLength);
+    TEST_ASSERT_EQUAL_UINT8(CE_DRAW_FLIP_X, commands[4].m_flip);
+
+    // Fill white and the font for the text, back to copy for the last bitmap
+    TEST_ASSERT_EQUAL_UINT16(3, CE_ECS_AccessGlobalComponent(&context, CE_ENGINE_RENDER_COMMANDS)->m_stateChanges);
+
+    CE_RenderCommands_Clear(&context);
+    CE_RenderCommands_GetCommands(&context, &commands, &count);
+    TEST_ASSERT_EQUAL_size_t(0, count);
+    TEST_ASSERT_NULL(commands);
+}
+
+void test_DirtyRegion(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id entities[2];
+    CE_TransformComponent* transforms[2];
+    CE_ECS_AccessGlobalComponentToVariable(&context, CE_ENGINE_DIRTY_REGION, region);
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Init(&context, &errorCode));
+    const CE_Id rootId = CE_Scene_GetRootId(&context);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_Camera_SetPosition(&context, 0, 0));
+    for (size_t i = 0; i < 2; i++) {
+        CE_Id transformId = CE_INVALID_ID;
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entities[i], &errorCode));
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entities[i], CE_TRANSFORM_COMPONENT, &transformId, (void**)&transforms[i], &errorCode));
+        transforms[i]->m_x = (int16_t)(10 + 90 * i);
+        transforms[i]->m_y = (int16_t)(10 + 90 * i);
+        transforms[i]->m_width = 10;
+        transforms[i]->m_height = 10;
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, rootId, entities[i], false, &errorCode));
+    }
+
+    // The first frame draws everything, then nothing until something changes
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_TRUE(region->m_fullRedraw);
+    CE_DirtyRegion_Clear(&context);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_FALSE(region->m_fullRedraw);
+    TEST_ASSERT_EQUAL_UINT8(0, region->m_rectCount);
+
+    // Moving covers where the node was and where it is
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TransformComponent_setPosition(&context, transforms[0], 20, 10));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_FALSE(region->m_fullRedraw);
+    TEST_ASSERT_EQUAL_UINT8(1, region->m_rectCount);
+    TEST_ASSERT_EQUAL_INT32(10, region->m_rects[0].m_minX);
+    TEST_ASSERT_EQUAL_INT32(10, region->m_rects[0].m_minY);
+    TEST_ASSERT_EQUAL_INT32(30, region->m_rects[0].m_maxX);
+    TEST_ASSERT_EQUAL_INT32(20, region->m_rects[0].m_maxY);
+    CE_DirtyRegion_Clear(&context);
+
+    // Content changes redraw in place
+    CE_TransformComponent_markDirty(&context, transforms[1]);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_EQUAL_UINT8(1, region->m_rectCount);
+    TEST_ASSERT_EQUAL_INT32(100, region->m_rects[0].m_minX);
+    TEST_ASSERT_EQUAL_INT32(110, region->m_rects[0].m_maxY);
+    CE_DirtyRegion_Clear(&context);
+
+    // Leaving the screen only erases the old place
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TransformComponent_setPosition(&context, transforms[0], 500, 10));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_EQUAL_UINT8(1, region->m_rectCount);
+    TEST_ASSERT_EQUAL_INT32(20, region->m_rects[0].m_minX);
+    TEST_ASSERT_EQUAL_INT32(30, region->m_rects[0].m_maxX);
+    CE_DirtyRegion_Clear(&context);
+
+    // Manual rectangles are clipped to the screen
+    CE_DirtyRegion_AddRect(&context, -5, -5, 10, 10);
+    TEST_ASSERT_EQUAL_UINT8(1, region->m_rectCount);
+    TEST_ASSERT_EQUAL_INT32(0, region->m_rects[0].m_minX);
+    TEST_ASSERT_EQUAL_INT32(5, region->m_rects[0].m_maxY);
+    CE_DirtyRegion_Clear(&context);
+
+    // Scrolling moves everything
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_Camera_SetPosition(&context, 1, 0));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_TRUE(region->m_fullRedraw);
+}
+
+void test_SceneGraph_StaticLayer(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id entities[4];
+    CE_TransformComponent* transforms[4];
+    const CE_SceneGraphRenderQueueEntry *queue = NULL;
+    size_t queueCount = 0;
+    const int16_t positions[4] = { 10, 5, 20, 200 };
+    const uint16_t sizes[4] = { 100, 10, 10, 10 };
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Init(&context, &errorCode));
+    const CE_Id rootId = CE_Scene_GetRootId(&context);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_Camera_SetPosition(&context, 0, 0));
+    CE_SceneGraphComponent *sceneGraph = CE_ECS_AccessGlobalComponent(&context, CE_ENGINE_SCENE_GRAPH_COMPONENT);
+
+    for (size_t i = 0; i < 4; i++) {
+        CE_Id transformId = CE_INVALID_ID;
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entities[i], &errorCode));
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entities[i], CE_TRANSFORM_COMPONENT, &transformId, (void**)&transforms[i], &errorCode));
+        transforms[i]->m_x = positions[i];
+        transforms[i]->m_y = 10;
+        transforms[i]->m_width = sizes[i];
+        transforms[i]->m_height = (uint16_t)(sizes[i] / 2);
+    }
+
+    // A static panel with two widgets, and a sprite outside of it
+    CE_TransformComponent_setFlags(transforms[0], CE_TransformComponent_Flags_StaticLayer);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, rootId, entities[0], false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, entities[0], entities[1], false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, entities[0], entities[2], false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, rootId, entities[3], false, &errorCode));
+
+    // First frame bakes the panel, its nodes draw into the layer bitmap
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    CE_Engine_SceneGraph_GetRenderQueue(&context, &queue, &queueCount);
+    TEST_ASSERT_EQUAL_size_t(5, queueCount);
+    for (size_t i = 0; i < queueCount; i++) {
+        const bool inLayer = queue[i].m_uniqueId != CE_Id_getUniqueId(rootId) && queue[i].m_uniqueId != CE_Id_getUniqueId(entities[3]);
+        TEST_ASSERT_EQUAL_UINT8(inLayer ? 1 : CE_RENDER_TARGET_SCREEN, queue[i].m_target);
+    }
+    TEST_ASSERT_EQUAL_UINT32(entities[0], sceneGraph->m_staticLayers[0].m_entityId);
+    TEST_ASSERT_TRUE(sceneGraph->m_staticLayers[0].m_baked);
+
+    // The layer is blitted at the panel position
+    CE_RenderCommands_Clear(&context);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_AddStaticLayerCommands(&context, &errorCode));
+    const CE_RenderCommand *commands = NULL;
+    size_t commandCount = 0;
+    CE_RenderCommands_GetCommands(&context, &commands, &commandCount);
+    TEST_ASSERT_EQUAL_size_t(1, commandCount);
+    TEST_ASSERT_EQUAL_INT16(10, commands[0].m_x);
+    TEST_ASSERT_EQUAL_INT16(100, commands[0].m_width);
+    TEST_ASSERT_EQUAL_UINT8(CE_RENDER_TARGET_SCREEN, commands[0].m_target);
+
+    // Next frames only draw what is outside the layer
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    CE_Engine_SceneGraph_GetRenderQueue(&context, &queue, &queueCount);
+    TEST_ASSERT_EQUAL_size_t(2, queueCount);
+
+    // A change inside bakes it again
+    CE_TransformComponent_markDirty(&context, transforms[2]);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    CE_Engine_SceneGraph_GetRenderQueue(&context, &queue, &queueCount);
+    TEST_ASSERT_EQUAL_size_t(5, queueCount);
+
+    // Without the flag the widgets are drawn on their own and the slot is released
+    CE_TransformComponent_clearFlags(transforms[0], CE_TransformComponent_Flags_StaticLayer);
+    CE_TransformComponent_markDirty(&context, transforms[0]);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    CE_Engine_SceneGraph_GetRenderQueue(&context, &queue, &queueCount);
+    TEST_ASSERT_EQUAL_size_t(5, queueCount);
+    for (size_t i = 0; i < queueCount; i++) {
+        TEST_ASSERT_EQUAL_UINT8(CE_RENDER_TARGET_SCREEN, queue[i].m_target);
+    }
+    TEST_ASSERT_EQUAL_UINT32(CE_INVALID_ID, sceneGraph->m_staticLayers[0].m_entityId);
+}
+
+void test_DirtyRegion_Scroll(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id entities[2];
+    CE_TransformComponent* transforms[2];
+    CE_ECS_AccessGlobalComponentToVariable(&context, CE_ENGINE_DIRTY_REGION, region);
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Init(&context, &errorCode));
+    const CE_Id rootId = CE_Scene_GetRootId(&context);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_Camera_SetPosition(&context, 0, 0));
+    for (size_t i = 0; i < 2; i++) {
+        CE_Id transformId = CE_INVALID_ID;
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entities[i], &errorCode));
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entities[i], CE_TRANSFORM_COMPONENT, &transformId, (void**)&transforms[i], &errorCode));
+        transforms[i]->m_x = (int16_t)(10 + 90 * i);
+        transforms[i]->m_y = (int16_t)(10 + 90 * i);
+        transforms[i]->m_width = 10;
+        transforms[i]->m_height = 10;
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, rootId, entities[i], false, &errorCode));
+    }
+    // The second node is a HUD element that stays in place
+    CE_TransformComponent_setFlags(transforms[1], CE_TransformComponent_Flags_FixedPosition);
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    CE_DirtyRegion_Clear(&context);
+
+    // Panning right scrolls the frame left, the world node is still valid
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_Camera_SetPosition(&context, 4, 0));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_FALSE(region->m_fullRedraw);
+    TEST_ASSERT_EQUAL_INT32(-4, region->m_scrollX);
+    TEST_ASSERT_EQUAL_INT32(0, region->m_scrollY);
+    TEST_ASSERT_EQUAL_UINT8(2, region->m_rectCount);
+
+    // The strip scrolled in on the right
+    const int32_t width = CE_GetDisplayWidth(&context);
+    TEST_ASSERT_EQUAL_INT32(width - 4, region->m_rects[0].m_minX);
+    TEST_ASSERT_EQUAL_INT32(0, region->m_rects[0].m_minY);
+    TEST_ASSERT_EQUAL_INT32(width, region->m_rects[0].m_maxX);
+
+    // The HUD node over its scrolled copy
+    TEST_ASSERT_EQUAL_INT32(96, region->m_rects[1].m_minX);
+    TEST_ASSERT_EQUAL_INT32(100, region->m_rects[1].m_minY);
+    TEST_ASSERT_EQUAL_INT32(110, region->m_rects[1].m_maxX);
+    TEST_ASSERT_EQUAL_INT32(110, region->m_rects[1].m_maxY);
+    CE_DirtyRegion_Clear(&context);
+    TEST_ASSERT_EQUAL_INT32(0, region->m_scrollX);
+
+    // A pan as large as the screen has nothing to reuse
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_Camera_SetPosition(&context, (int16_t)(4 + width), 0));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_TRUE(region->m_fullRedraw);
+    CE_DirtyRegion_Clear(&context);
+}
+
+void test_TextLabel_Cache(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id entity = CE_INVALID_ID;
+    CE_Id componentId = CE_INVALID_ID;
+    CE_TransformComponent* transform = NULL;
+    CE_TextLabelComponent* label = NULL;
+    const void *bitmap = NULL;
+    char text[] = "Score: 10";
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entity, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entity, CE_TRANSFORM_COMPONENT, &componentId, (void**)&transform, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entity, CE_TEXT_LABEL_COMPONENT, &componentId, (void**)&label, &errorCode));
+
+    // The length is known without scanning the text every frame
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TextLabelComponent_setStaticText(&context, label, transform, text));
+    TEST_ASSERT_EQUAL_UINT16(9, label->m_textLength);
+    const uint32_t hash = label->m_textHash;
+
+    // Setting the same text keeps the key, new text changes it
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TextLabelComponent_setStaticText(&context, label, transform, "Score: 10"));
+    TEST_ASSERT_EQUAL_UINT32(hash, label->m_textHash);
+    text[8] = '1';
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TextLabelComponent_update(&context, label, transform));
+    TEST_ASSERT_NOT_EQUAL(hash, label->m_textHash);
+
+    // Labels are only rasterized when asked to, and never without a size
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TextLabelComponent_getCacheBitmap(&context, label, 40, 10, &bitmap, &errorCode));
+    TEST_ASSERT_NULL(bitmap);
+    CE_TextLabelComponent_setCached(&context, label, true);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TextLabelComponent_getCacheBitmap(&context, label, 0, 0, &bitmap, &errorCode));
+    TEST_ASSERT_NULL(bitmap);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TextLabelComponent_getCacheBitmap(&context, label, 40, 10, &bitmap, &errorCode));
+    TEST_ASSERT_EQUAL_UINT32(label->m_textHash, label->m_cacheTextHash);
+    TEST_ASSERT_EQUAL_UINT16(40, label->m_cacheWidth);
+
+    // The rasterized text is kept to rule out hash collisions
+    TEST_ASSERT_EQUAL_size_t(label->m_textLength, cc_size(&label->m_cacheText));
+    TEST_ASSERT_EQUAL_MEMORY(text, cc_first(&label->m_cacheText), label->m_textLength);
+    CE_TextLabelComponent_setCached(&context, label, false);
+    TEST_ASSERT_NULL(label->m_cacheBitmap);
+    TEST_ASSERT_EQUAL_size_t(0, cc_size(&label->m_cacheText));
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_DestroyEntity(&context, entity, &errorCode));
+}
+
+void test_TextLabel_InlineText(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id entity = CE_INVALID_ID;
+    CE_Id componentId = CE_INVALID_ID;
+    CE_TransformComponent* transform = NULL;
+    CE_TextLabelComponent* label = NULL;
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entity, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entity, CE_TRANSFORM_COMPONENT, &componentId, (void**)&transform, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entity, CE_TEXT_LABEL_COMPONENT, &componentId, (void**)&label, &errorCode));
+
+    // Short text lives in the component
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TextLabelComponent_formatText(&context, label, transform, "Score: %d", 1234));
+    TEST_ASSERT_EQUAL_PTR(label->m_inlineText, CE_TextLabelComponent_getText(label));
+    TEST_ASSERT_EQUAL_STRING("Score: 1234", CE_TextLabelComponent_getText(label));
+    TEST_ASSERT_EQUAL_UINT16(11, label->m_textLength);
+    TEST_ASSERT_EQUAL_size_t(0, cc_size(&label->m_text));
+
+    // Longer text overflows and takes over until short text is set again
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TextLabelComponent_setText(&context, label, transform, "A line of text that does not fit inline"));
+    TEST_ASSERT_EQUAL_STRING("A line of text that does not fit inline", CE_TextLabelComponent_getText(label));
+    TEST_ASSERT_EQUAL_UINT16(39, label->m_textLength);
+    TEST_ASSERT_EQUAL_size_t(39, cc_size(&label->m_text));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TextLabelComponent_formatText(&context, label, transform, "%02d:%02d", 3, 7));
+    TEST_ASSERT_EQUAL_STRING("03:07", CE_TextLabelComponent_getText(label));
+    TEST_ASSERT_EQUAL_UINT16(5, label->m_textLength);
+
+    // Static text still wins until dynamic text is set
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TextLabelComponent_setStaticText(&context, label, transform, "Paused"));
+    TEST_ASSERT_EQUAL_STRING("Paused", CE_TextLabelComponent_getText(label));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TextLabelComponent_setText(&context, label, transform, "Go"));
+    TEST_ASSERT_NULL(label->m_staticTextPtr);
+    TEST_ASSERT_EQUAL_STRING("Go", CE_TextLabelComponent_getText(label));
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_DestroyEntity(&context, entity, &errorCode));
+}
+
+void test_SpriteAnimation(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id entity = CE_INVALID_ID;
+    CE_Id componentId = CE_INVALID_ID;
+    CE_TransformComponent* transform = NULL;
+    CE_SpriteAnimationComponent* animation = NULL;
+    uint8_t walk = 0, idle = 0, jump = 0;
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entity, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entity, CE_TRANSFORM_COMPONENT, &componentId, (void**)&transform, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entity, CE_SPRITE_ANIMATION_COMPONENT, &componentId, (void**)&animation, &errorCode));
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_SpriteAnimationComponent_addClip(animation, 0, 4, 4, CE_SPRITE_ANIMATION_LOOP, &walk, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_SpriteAnimationComponent_addClip(animation, 4, 3, 4, CE_SPRITE_ANIMATION_PING_PONG, &idle, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_SpriteAnimationComponent_addClip(animation, 7, 3, 4, CE_SPRITE_ANIMATION_ONCE, &jump, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR, CE_SpriteAnimationComponent_addClip(animation, 10, 0, 4, CE_SPRITE_ANIMATION_ONCE, NULL, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_ENGINE_ANIMATION_INVALID_CLIP, errorCode);
+    TEST_ASSERT_EQUAL_INT(CE_ERROR, CE_SpriteAnimationComponent_play(&context, animation, transform, 5, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_ENGINE_ANIMATION_INVALID_CLIP, errorCode);
+
+    // Looping, time adds up until a frame is due and long frames skip ahead
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_SpriteAnimationComponent_play(&context, animation, transform, walk, &errorCode));
+    CE_SpriteAnimationComponent_advance(&context, animation, transform, 0.125f);
+    TEST_ASSERT_EQUAL_UINT16(0, animation->m_tableIndex);
+    CE_SpriteAnimationComponent_advance(&context, animation, transform, 0.125f);
+    TEST_ASSERT_EQUAL_UINT16(1, animation->m_tableIndex);
+    CE_SpriteAnimationComponent_advance(&context, animation, transform, 0.75f);
+    TEST_ASSERT_EQUAL_UINT16(0, animation->m_tableIndex);
+
+    // Ping-pong goes back without repeating the end frames
+    const uint16_t idleFrames[] = { 5, 6, 5, 4, 5 };
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_SpriteAnimationComponent_play(&context, animation, transform, idle, &errorCode));
+    TEST_ASSERT_EQUAL_UINT16(4, animation->m_tableIndex);
+    for (size_t i = 0; i < sizeof(idleFrames) / sizeof(idleFrames[0]); i++) {
+        CE_SpriteAnimationComponent_advance(&context, animation, transform, 0.25f);
+        TEST_ASSERT_EQUAL_UINT16(idleFrames[i], animation->m_tableIndex);
+    }
+
+    // Playing once stops on the last frame
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_SpriteAnimationComponent_play(&context, animation, transform, jump, &errorCode));
+    CE_SpriteAnimationComponent_advance(&context, animation, transform, 1.0f);
+    TEST_ASSERT_EQUAL_UINT16(9, animation->m_tableIndex);
+    TEST_ASSERT_FALSE(animation->m_playing);
+    CE_SpriteAnimationComponent_advance(&context, animation, transform, 1.0f);
+    TEST_ASSERT_EQUAL_UINT16(9, animation->m_tableIndex);
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_DestroyEntity(&context, entity, &errorCode));
+}
+
+void test_BitmapCache(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id entity = CE_INVALID_ID;
+    CE_Id transformId = CE_INVALID_ID;
+    CE_TransformComponent* transform = NULL;
+    CE_ECS_AccessGlobalComponentToVariable(&context, CE_ENGINE_DIRTY_REGION, region);
+
+    // Requests are rounded so nearby rotations and scales share a variant
+    TEST_ASSERT_EQUAL_UINT16(0, CE_BitmapCache_QuantizeRotation(0));
+    TEST_ASSERT_EQUAL_UINT16(1, CE_BitmapCache_QuantizeRotation(11));
+    TEST_ASSERT_EQUAL_UINT16(CE_ENGINE_BITMAP_CACHE_ANGLE_STEPS / 4, CE_BitmapCache_QuantizeRotation(90));
+    TEST_ASSERT_EQUAL_UINT16(0, CE_BitmapCache_QuantizeRotation(359));
+    TEST_ASSERT_EQUAL_UINT16(CE_TRANSFORM_SCALE_ONE, CE_BitmapCache_QuantizeScale(CE_TRANSFORM_SCALE_ONE + 10));
+    TEST_ASSERT_EQUAL_UINT16(CE_ENGINE_BITMAP_CACHE_SCALE_STEP, CE_BitmapCache_QuantizeScale(1));
+
+    // Nothing to transform is the source itself
+    const void *bitmap = NULL;
+    uint16_t width = 1, height = 1;
+    CE_BitmapCache_Get(&context, NULL, 90, CE_TRANSFORM_SCALE_ONE, &bitmap, &width, &height);
+    TEST_ASSERT_NULL(bitmap);
+    TEST_ASSERT_EQUAL_UINT16(0, width);
+
+    // Rotation and scale wrap and mark the transform dirty
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Init(&context, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_Camera_SetPosition(&context, 0, 0));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entity, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entity, CE_TRANSFORM_COMPONENT, &transformId, (void**)&transform, &errorCode));
+    TEST_ASSERT_EQUAL_UINT16(CE_TRANSFORM_SCALE_ONE, CE_TransformComponent_getScale(transform));
+    transform->m_x = 100;
+    transform->m_y = 100;
+    transform->m_width = 20;
+    transform->m_height = 10;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, CE_Scene_GetRootId(&context), entity, false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    CE_DirtyRegion_Clear(&context);
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TransformComponent_setRotation(&context, transform, -315));
+    TEST_ASSERT_EQUAL_UINT16(45, transform->m_rotation);
+    TEST_ASSERT_TRUE(CE_TransformComponent_isDirty(transform));
+
+    // A rotated node may cover more than its size, around its center
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_FALSE(region->m_fullRedraw);
+    TEST_ASSERT_EQUAL_UINT8(1, region->m_rectCount);
+    TEST_ASSERT_EQUAL_INT32(94, region->m_rects[0].m_minX);
+    TEST_ASSERT_EQUAL_INT32(89, region->m_rects[0].m_minY);
+    TEST_ASSERT_EQUAL_INT32(126, region->m_rects[0].m_maxX);
+    TEST_ASSERT_EQUAL_INT32(121, region->m_rects[0].m_maxY);
+    CE_DirtyRegion_Clear(&context);
+
+    const CE_SceneGraphRenderNode *renderNode = CE_Scene_GetRenderNode(&context, entity);
+    TEST_ASSERT_NOT_NULL(renderNode);
+    TEST_ASSERT_EQUAL_UINT16(45, renderNode->m_rotation);
+    TEST_ASSERT_EQUAL_UINT16(CE_TRANSFORM_SCALE_ONE, renderNode->m_scale);
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TransformComponent_setScale(&context, transform, CE_TRANSFORM_SCALE_ONE * 2));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_EQUAL_UINT16(CE_TRANSFORM_SCALE_ONE * 2, renderNode->m_scale);
+    CE_DirtyRegion_Clear(&context);
+}
+
+void test_Tilemap(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id entity = CE_INVALID_ID;
+    CE_Id componentId = CE_INVALID_ID;
+    CE_TransformComponent* transform = NULL;
+    CE_TilemapComponent* tilemap = NULL;
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entity, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entity, CE_TRANSFORM_COMPONENT, &componentId, (void**)&transform, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entity, CE_TILEMAP_COMPONENT, &componentId, (void**)&tilemap, &errorCode));
+
+    // Chunks cover the map, the last ones are cut to its edge
+    const uint16_t columns = CE_ENGINE_TILEMAP_CHUNK_SIZE + 4;
+    const uint16_t rows = CE_ENGINE_TILEMAP_CHUNK_SIZE * 2;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TilemapComponent_setSize(&context, tilemap, transform, columns, rows, 8, 16, &errorCode));
+    TEST_ASSERT_EQUAL_UINT16(columns * 8, transform->m_width);
+    TEST_ASSERT_EQUAL_UINT16(rows * 16, transform->m_height);
+    TEST_ASSERT_EQUAL_UINT16(2, tilemap->m_chunksX);
+    TEST_ASSERT_EQUAL_UINT16(2, tilemap->m_chunksY);
+    int width = 0, height = 0;
+    CE_TilemapComponent_getChunkSize(tilemap, 1, 1, &width, &height);
+    TEST_ASSERT_EQUAL_INT(4 * 8, width);
+    TEST_ASSERT_EQUAL_INT(CE_ENGINE_TILEMAP_CHUNK_SIZE * 16, height);
+    TEST_ASSERT_EQUAL_UINT8(CE_TILEMAP_EMPTY_TILE, CE_TilemapComponent_getTile(tilemap, columns - 1, rows - 1));
+
+    for (uint16_t y = 0; y < tilemap->m_chunksY; y++) {
+        for (uint16_t x = 0; x < tilemap->m_chunksX; x++) {
+            TEST_ASSERT_EQUAL_INT(CE_OK, CE_TilemapComponent_bakeChunk(&context, tilemap, x, y, &errorCode));
+        }
+    }
+
+    // A changed cell only dirties its own chunk, setting the same tile again does nothing
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TilemapComponent_setTile(&context, tilemap, transform, CE_ENGINE_TILEMAP_CHUNK_SIZE + 1, 2, 3, &errorCode));
+    TEST_ASSERT_EQUAL_UINT8(3, CE_TilemapComponent_getTile(tilemap, CE_ENGINE_TILEMAP_CHUNK_SIZE + 1, 2));
+    TEST_ASSERT_FALSE(tilemap->m_chunks[0].m_dirty);
+    TEST_ASSERT_TRUE(tilemap->m_chunks[1].m_dirty);
+    TEST_ASSERT_FALSE(tilemap->m_chunks[2].m_dirty);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TilemapComponent_bakeChunk(&context, tilemap, 1, 0, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TilemapComponent_setTile(&context, tilemap, transform, CE_ENGINE_TILEMAP_CHUNK_SIZE + 1, 2, 3, &errorCode));
+    TEST_ASSERT_FALSE(tilemap->m_chunks[1].m_dirty);
+    TEST_ASSERT_EQUAL_INT(CE_ERROR, CE_TilemapComponent_setTile(&context, tilemap, transform, columns, 0, 1, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_ENGINE_TILEMAP_OUT_OF_BOUNDS, errorCode);
+
+    // Copies own their cells
+    CE_TilemapComponent copy;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CopyComponentData(&context, CE_TILEMAP_COMPONENT, &copy, tilemap, &errorCode));
+    TEST_ASSERT_TRUE(copy.m_tiles != tilemap->m_tiles);
+    TEST_ASSERT_EQUAL_UINT8(3, CE_TilemapComponent_getTile(&copy, CE_ENGINE_TILEMAP_CHUNK_SIZE + 1, 2));
+    TEST_ASSERT_FALSE(copy.m_chunks[0].m_baked);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CleanupComponentData(&context, CE_TILEMAP_COMPONENT, &copy, &errorCode));
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_DestroyEntity(&context, entity, &errorCode));
+}
+
+void test_Tilemap_StaticLayer(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id panel = CE_INVALID_ID;
+    CE_Id entity = CE_INVALID_ID;
+    CE_Id componentId = CE_INVALID_ID;
+    CE_TransformComponent* panelTransform = NULL;
+    CE_TransformComponent* transform = NULL;
+    CE_TilemapComponent* tilemap = NULL;
+    const CE_SceneGraphRenderQueueEntry *queue = NULL;
+    size_t queueCount = 0;
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Init(&context, &errorCode));
+    const CE_Id rootId = CE_Scene_GetRootId(&context);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_Camera_SetPosition(&context, 0, 0));
+    CE_SceneGraphComponent *sceneGraph = CE_ECS_AccessGlobalComponent(&context, CE_ENGINE_SCENE_GRAPH_COMPONENT);
+
+    // A small map inside a static panel
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &panel, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, panel, CE_TRANSFORM_COMPONENT, &componentId, (void**)&panelTransform, &errorCode));
+    panelTransform->m_width = 64;
+    panelTransform->m_height = 64;
+    CE_TransformComponent_setFlags(panelTransform, CE_TransformComponent_Flags_StaticLayer);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entity, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entity, CE_TRANSFORM_COMPONENT, &componentId, (void**)&transform, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entity, CE_TILEMAP_COMPONENT, &componentId, (void**)&tilemap, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TilemapComponent_setSize(&context, tilemap, transform, 4, 4, 8, 8, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, rootId, panel, false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, panel, entity, false, &errorCode));
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_TRUE(sceneGraph->m_staticLayers[0].m_baked);
+    TEST_ASSERT_TRUE(CE_TransformComponent_checkFlags(transform, CE_TransformComponent_Flags_InStaticLayer));
+    TEST_ASSERT_FALSE(CE_TransformComponent_isDirty(transform));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    CE_Engine_SceneGraph_GetRenderQueue(&context, &queue, &queueCount);
+    TEST_ASSERT_EQUAL_size_t(1, queueCount);
+
+    // An edited tile bakes the layer again, the map draws into it
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TilemapComponent_setTile(&context, tilemap, transform, 1, 1, 2, &errorCode));
+    TEST_ASSERT_TRUE(CE_TransformComponent_isDirty(transform));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    CE_Engine_SceneGraph_GetRenderQueue(&context, &queue, &queueCount);
+    bool queued = false;
+    for (size_t i = 0; i < queueCount; i++) {
+        if (queue[i].m_uniqueId == CE_Id_getUniqueId(entity)) {
+            queued = true;
+            TEST_ASSERT_EQUAL_UINT8(1, queue[i].m_target);
+        }
+    }
+    TEST_ASSERT_TRUE(queued);
+
+    // Out of the layer the map is left to redraw its own chunks
+    CE_TransformComponent_clearFlags(panelTransform, CE_TransformComponent_Flags_StaticLayer);
+    CE_TransformComponent_markDirty(&context, panelTransform);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    TEST_ASSERT_FALSE(CE_TransformComponent_checkFlags(transform, CE_TransformComponent_Flags_InStaticLayer));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TilemapComponent_setTile(&context, tilemap, transform, 2, 2, 2, &errorCode));
+    TEST_ASSERT_FALSE(CE_TransformComponent_isDirty(transform));
+}
+
+void test_ParticleEmitter(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id entity = CE_INVALID_ID;
+    CE_Id componentId = CE_INVALID_ID;
+    CE_TransformComponent* transform = NULL;
+    CE_ParticleEmitterComponent* emitter = NULL;
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entity, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entity, CE_TRANSFORM_COMPONENT, &componentId, (void**)&transform, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entity, CE_PARTICLE_EMITTER_COMPONENT, &componentId, (void**)&emitter, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR, CE_ParticleEmitterComponent_setCapacity(&context, emitter, CE_ENGINE_PARTICLE_MAX_POOL_SIZE + 1, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_ENGINE_PARTICLE_POOL_TOO_LARGE, errorCode);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ParticleEmitterComponent_setCapacity(&context, emitter, 64, &errorCode));
+
+    // Straight to the right at 10 pixels per second, four frames over one second of life
+    emitter->m_settings.m_lifetime = 1.0f;
+    emitter->m_settings.m_speedMin = 10.0f;
+    emitter->m_settings.m_speedMax = 10.0f;
+    emitter->m_settings.m_angle = 0;
+    emitter->m_settings.m_spread = 0;
+    emitter->m_frameCount = 4;
+
+    // A burst larger than the pool fills it
+    TEST_ASSERT_EQUAL_UINT16(64, CE_ParticleEmitterComponent_burst(&context, emitter, transform, 100));
+    TEST_ASSERT_EQUAL_UINT16(64, emitter->m_count);
+    CE_ParticleEmitterComponent_update(&context, emitter, transform, 0.5f);
+    TEST_ASSERT_EQUAL_UINT16(64, emitter->m_count);
+    for (uint16_t i = 0; i < emitter->m_count; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(0.05f, 5.0f, emitter->m_x[i]);
+        TEST_ASSERT_FLOAT_WITHIN(0.05f, 0.0f, emitter->m_y[i]);
+        TEST_ASSERT_EQUAL_UINT8(2, emitter->m_frame[i]);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 5.0f, emitter->m_maxX);
+
+    // The transform overflow covers the pixels, with one to spare on each side
+    TEST_ASSERT_EQUAL_INT16(4, transform->m_overflowMinX);
+    TEST_ASSERT_EQUAL_INT16(-1, transform->m_overflowMinY);
+    TEST_ASSERT_EQUAL_INT16(7, transform->m_overflowMaxX);
+    TEST_ASSERT_EQUAL_INT16(2, transform->m_overflowMaxY);
+
+    // Dead particles leave the pool, and nothing is left to cover
+    CE_ParticleEmitterComponent_update(&context, emitter, transform, 0.6f);
+    TEST_ASSERT_EQUAL_UINT16(0, emitter->m_count);
+    TEST_ASSERT_FALSE(CE_TransformComponent_hasOverflow(transform));
+
+    // Emission at a rate carries the fraction of a particle over
+    emitter->m_settings.m_rate = 10.0f;
+    CE_ParticleEmitterComponent_start(emitter);
+    CE_ParticleEmitterComponent_update(&context, emitter, transform, 0.25f);
+    TEST_ASSERT_EQUAL_UINT16(2, emitter->m_count);
+    CE_ParticleEmitterComponent_update(&context, emitter, transform, 0.25f);
+    TEST_ASSERT_EQUAL_UINT16(5, emitter->m_count);
+    CE_ParticleEmitterComponent_stop(emitter);
+    CE_ParticleEmitterComponent_update(&context, emitter, transform, 0.25f);
+    TEST_ASSERT_EQUAL_UINT16(5, emitter->m_count);
+
+    // Copies are reseeded and each plays its own pattern
+    CE_ParticleEmitterComponent copies[2];
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CopyComponentData(&context, CE_PARTICLE_EMITTER_COMPONENT, &copies[0], emitter, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CopyComponentData(&context, CE_PARTICLE_EMITTER_COMPONENT, &copies[1], emitter, &errorCode));
+    TEST_ASSERT_NOT_EQUAL_UINT32(0, copies[0].m_random);
+    TEST_ASSERT_NOT_EQUAL_UINT32(emitter->m_random, copies[0].m_random);
+    TEST_ASSERT_NOT_EQUAL_UINT32(copies[0].m_random, copies[1].m_random);
+    TEST_ASSERT_EQUAL_UINT16(emitter->m_capacity, copies[0].m_capacity);
+    TEST_ASSERT_EQUAL_UINT16(0, copies[0].m_count);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CleanupComponentData(&context, CE_PARTICLE_EMITTER_COMPONENT, &copies[0], &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CleanupComponentData(&context, CE_PARTICLE_EMITTER_COMPONENT, &copies[1], &errorCode));
+
+    // Pixel particles are recorded as rectangles
+    const CE_RenderCommand *commands = NULL;
+    size_t commandCount = 0;
+    CE_RenderCommands_Clear(&context);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_RenderCommands_AddRect(&context, 0, 3, 4, 1, 1, CE_DRAW_MODE_FILL_BLACK, &errorCode));
+    CE_RenderCommands_GetCommands(&context, &commands, &commandCount);
+    TEST_ASSERT_EQUAL_size_t(1, commandCount);
+    TEST_ASSERT_EQUAL_UINT8(CE_RENDER_COMMAND_RECT, commands[0].m_type);
+    TEST_ASSERT_NULL(commands[0].m_resource);
+    CE_RenderCommands_Clear(&context);
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_DestroyEntity(&context, entity, &errorCode));
+}
+
+void test_ParticleEmitter_Culling(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id parent = CE_INVALID_ID;
+    CE_Id entity = CE_INVALID_ID;
+    CE_Id componentId = CE_INVALID_ID;
+    CE_TransformComponent* parentTransform = NULL;
+    CE_TransformComponent* transform = NULL;
+    CE_ParticleEmitterComponent* emitter = NULL;
+    const CE_SceneGraphRenderQueueEntry *queue = NULL;
+    size_t queueCount = 0;
+    CE_ECS_AccessGlobalComponentToVariable(&context, CE_ENGINE_DIRTY_REGION, region);
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Init(&context, &errorCode));
+    const CE_Id rootId = CE_Scene_GetRootId(&context);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_Camera_SetPosition(&context, 0, 0));
+
+    // A sprite carrying an emitter, its particles stay still at the emitter position
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &parent, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, parent, CE_TRANSFORM_COMPONENT, &componentId, (void**)&parentTransform, &errorCode));
+    parentTransform->m_x = 100;
+    parentTransform->m_y = 100;
+    parentTransform->m_width = 10;
+    parentTransform->m_height = 10;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &entity, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entity, CE_TRANSFORM_COMPONENT, &componentId, (void**)&transform, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, entity, CE_PARTICLE_EMITTER_COMPONENT, &componentId, (void**)&emitter, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, rootId, parent, false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, parent, entity, false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ParticleEmitterComponent_setCapacity(&context, emitter, 8, &errorCode));
+    emitter->m_settings.m_lifetime = 10.0f;
+    TEST_ASSERT_EQUAL_UINT16(1, CE_ParticleEmitterComponent_burst(&context, emitter, transform, 1));
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    CE_DirtyRegion_Clear(&context);
+
+    // The sprite leaves the view, the particle drawn last frame is erased with it
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_TransformComponent_setPosition(&context, parentTransform, 1000, 100));
+    CE_ParticleEmitterComponent_update(&context, emitter, transform, 0.1f);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    CE_Engine_SceneGraph_GetRenderQueue(&context, &queue, &queueCount);
+    TEST_ASSERT_EQUAL_size_t(1, queueCount);
+    TEST_ASSERT_FALSE(region->m_drawn[CE_Id_getUniqueId(entity)]);
+    TEST_ASSERT_FALSE(region->m_fullRedraw);
+    TEST_ASSERT_EQUAL_UINT8(1, region->m_rectCount);
+    TEST_ASSERT_EQUAL_INT32(99, region->m_rects[0].m_minX);
+    TEST_ASSERT_EQUAL_INT32(99, region->m_rects[0].m_minY);
+    TEST_ASSERT_EQUAL_INT32(110, region->m_rects[0].m_maxX);
+    TEST_ASSERT_EQUAL_INT32(110, region->m_rects[0].m_maxY);
+    CE_DirtyRegion_Clear(&context);
+
+    // A particle still on screen keeps the emitter drawn even with the sprite away
+    transform->m_x = -900;
+    CE_TransformComponent_markDirty(&context, transform);
+    CE_ParticleEmitterComponent_update(&context, emitter, transform, 0.1f);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_UpdateRenderList(&context, &errorCode));
+    CE_Engine_SceneGraph_GetRenderQueue(&context, &queue, &queueCount);
+    TEST_ASSERT_EQUAL_size_t(2, queueCount);
+    TEST_ASSERT_TRUE(queue[0].m_uniqueId == CE_Id_getUniqueId(entity) || queue[1].m_uniqueId == CE_Id_getUniqueId(entity));
+    TEST_ASSERT_TRUE(region->m_drawn[CE_Id_getUniqueId(entity)]);
+}
+
+// Scene callbacks used by test_Scene_FailedBackgroundLoad
+static CE_Result test_Scene_Create(INOUT CE_ECS_Context* ctx, INOUT void* scriptData, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    (void)ctx;
+    (void)scriptData;
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+static CE_Result test_Scene_LoadData(INOUT CE_ECS_Context* ctx, OUT CE_Scene* scene, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    (void)ctx;
+    CE_Engine_Scene_Clear(scene);
+    scene->m_id = "test_scene";
+    scene->m_createFunction = test_Scene_Create;
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_NONE);
+    return CE_OK;
+}
+
+static CE_Result test_Scene_FailLoadData(INOUT CE_ECS_Context* ctx, OUT CE_Scene* scene, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    (void)ctx;
+    (void)scene;
+    CE_SET_ERROR_CODE(errorCode, CE_ERROR_CODE_INTERNAL_ERROR);
+    return CE_ERROR;
+}
+
+void test_Scene_FailedBackgroundLoad(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_SceneScriptComponent* sceneScriptComp = CE_ECS_AccessGlobalComponent(&context, CE_ENGINE_SCENE_SCRIPT_COMPONENT);
+
+    // Load and run a scene in the foreground
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_RequestLoad(&context, test_Scene_LoadData, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_Tick(&context, 0.0f, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_Tick(&context, 0.0f, &errorCode));
+    TEST_ASSERT_TRUE(CE_Scene_IsSceneRunning(&context));
+
+    // A background load that fails is dropped and the current scene carries on
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_RequestBackgroundLoad(&context, test_Scene_FailLoadData, &errorCode));
+    TEST_ASSERT_TRUE(CE_Scene_IsBackgroundLoading(&context));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_Tick(&context, 0.0f, &errorCode));
+    TEST_ASSERT_FALSE(CE_Scene_IsBackgroundLoading(&context));
+    TEST_ASSERT_NULL(sceneScriptComp->m_shadowContext);
+    TEST_ASSERT_NULL(sceneScriptComp->m_loadSceneDataFunction);
+    TEST_ASSERT_TRUE(CE_Scene_IsSceneRunning(&context));
+
+    // Unloading afterwards must not retry the failed scene in the foreground
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_RequestUnload(&context, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_Tick(&context, 0.0f, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_SCENE_STATE_UNLOADED, sceneScriptComp->m_state);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_Tick(&context, 0.0f, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_SCENE_STATE_UNLOADED, sceneScriptComp->m_state);
+}
+
+// Per-instance override used by test_Prefab_Instantiate
+static CE_Result test_Prefab_PlaceInstance(INOUT CE_ECS_Context* ctx, IN CE_Id root, IN size_t instanceIndex, INOUT void* userData, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_TransformComponent* transform = NULL;
+    if (CE_Entity_FindFirstComponent(ctx, root, CE_TRANSFORM_COMPONENT, NULL, (void**)&transform, errorCode) != CE_OK) {
+        return CE_ERROR;
+    }
+    (*(int*)userData)++;
+    return CE_TransformComponent_setPosition(ctx, transform, (int16_t)(instanceIndex * 10), 5);
+}
+
+void test_Prefab_Instantiate(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Id source = CE_INVALID_ID;
+    CE_Id sourceChild = CE_INVALID_ID;
+    CE_TransformComponent* transform = NULL;
+    CE_Core_DebugComponent* debugData = NULL;
+
+    // Build the template: a root with a transform and a debug component, and a child with a transform
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &source, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, source, CE_TRANSFORM_COMPONENT, NULL, (void**)&transform, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, source, CE_CORE_DEBUG_COMPONENT, NULL, (void**)&debugData, &errorCode));
+    debugData->m_testValue = 7;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_ECS_CreateEntity(&context, &sourceChild, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_AddComponent(&context, sourceChild, CE_TRANSFORM_COMPONENT, NULL, (void**)&transform, &errorCode));
+    transform->m_x = 3;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, source, sourceChild, false, &errorCode));
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Prefab_Register(&context, "enemy", source, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_NONE, errorCode);
+    TEST_ASSERT_EQUAL_INT(CE_ERROR, CE_Prefab_Register(&context, "enemy", source, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_ENGINE_PREFAB_ALREADY_REGISTERED, errorCode);
+
+    // The prefab owns a copy, changing the source afterwards must not leak into instances
+    debugData->m_testValue = 99;
+
+    CE_Id roots[3] = { CE_INVALID_ID, CE_INVALID_ID, CE_INVALID_ID };
+    int calls = 0;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Prefab_Instantiate(&context, "enemy", 3, roots, test_Prefab_PlaceInstance, &calls, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_NONE, errorCode);
+    TEST_ASSERT_EQUAL_INT(3, calls);
+
+    for (size_t i = 0; i < 3; i++) {
+        TEST_ASSERT_TRUE(CE_Entity_IsValid(&context, roots[i]));
+        TEST_ASSERT_NOT_EQUAL_UINT32(source, roots[i]);
+        TEST_ASSERT_EQUAL_UINT32(2, CE_Entity_GetComponentCount(&context, roots[i]));
+
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_FindFirstComponent(&context, roots[i], CE_TRANSFORM_COMPONENT, NULL, (void**)&transform, &errorCode));
+        TEST_ASSERT_EQUAL_INT16((int16_t)(i * 10), transform->m_x);
+        TEST_ASSERT_EQUAL_INT16(5, transform->m_y);
+        TEST_ASSERT_FALSE(CE_TransformComponent_isInSceneGraph(transform));
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_FindFirstComponent(&context, roots[i], CE_CORE_DEBUG_COMPONENT, NULL, (void**)&debugData, &errorCode));
+        TEST_ASSERT_EQUAL_UINT8(7, debugData->m_testValue);
+
+        // Child was recreated and parented to this instance's root
+        CE_Id child = CE_INVALID_ID;
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_FindFirstRelationship(&context, roots[i], CE_RELATIONSHIP_CHILD, &child, &errorCode));
+        TEST_ASSERT_NOT_EQUAL_UINT32(sourceChild, child);
+        TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_FindFirstComponent(&context, child, CE_TRANSFORM_COMPONENT, NULL, (void**)&transform, &errorCode));
+        TEST_ASSERT_EQUAL_INT16(3, transform->m_x);
+        TEST_ASSERT_TRUE(CE_TransformComponent_isInSceneGraph(transform));
+    }
+
+    // Unknown prefab and unregistering
+    TEST_ASSERT_EQUAL_INT(CE_ERROR, CE_Prefab_Instantiate(&context, "missing", 1, NULL, NULL, NULL, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_ENGINE_PREFAB_NOT_FOUND, errorCode);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Prefab_Unregister(&context, "enemy", &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR, CE_Prefab_Unregister(&context, "enemy", &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_ENGINE_PREFAB_NOT_FOUND, errorCode);
+    TEST_ASSERT_TRUE(CE_Entity_IsValid(&context, roots[0]));
+}
+
+// Pool factory used by test_EntityPool: a root with a transform and a debug component, and a child with a transform
+static CE_Result test_EntityPool_Create(INOUT CE_ECS_Context* ctx, INOUT void* userData, OUT CE_Id* entity, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_Id child = CE_INVALID_ID;
+    if (CE_ECS_CreateEntity(ctx, entity, errorCode) != CE_OK
+        || CE_Entity_AddComponent(ctx, *entity, CE_TRANSFORM_COMPONENT, NULL, NULL, errorCode) != CE_OK
+        || CE_Entity_AddComponent(ctx, *entity, CE_CORE_DEBUG_COMPONENT, NULL, NULL, errorCode) != CE_OK
+        || CE_ECS_CreateEntity(ctx, &child, errorCode) != CE_OK
+        || CE_Entity_AddComponent(ctx, child, CE_TRANSFORM_COMPONENT, NULL, NULL, errorCode) != CE_OK
+        || CE_Scene_AddChild(ctx, *entity, child, false, errorCode) != CE_OK) {
+        return CE_ERROR;
+    }
+    ((int*)userData)[0]++;
+    return CE_OK;
+}
+
+// Pool reset hook used by test_EntityPool
+static CE_Result test_EntityPool_Reset(INOUT CE_ECS_Context* ctx, IN CE_Id entity, INOUT void* userData, OUT_OPT CE_ERROR_CODE* errorCode)
+{
+    CE_Core_DebugComponent* debugData = NULL;
+    if (CE_Entity_FindFirstComponent(ctx, entity, CE_CORE_DEBUG_COMPONENT, NULL, (void**)&debugData, errorCode) != CE_OK) {
+        return CE_ERROR;
+    }
+    debugData->m_testValue = 0;
+    ((int*)userData)[1]++;
+    return CE_OK;
+}
+
+void test_EntityPool(void) {
+    CE_ERROR_CODE errorCode = CE_ERROR_CODE_COUNT;
+    CE_Core_DebugComponent* debugData = NULL;
+    int calls[2] = { 0, 0 }; // Create and reset calls
+
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Engine_SceneGraph_Init(&context, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_EntityPool_Register(&context, "bullet", test_EntityPool_Create, test_EntityPool_Reset, calls, 2, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_NONE, errorCode);
+    TEST_ASSERT_EQUAL_INT(2, calls[0]);
+    TEST_ASSERT_EQUAL_size_t(2, CE_EntityPool_GetParkedCount(&context, "bullet"));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR, CE_EntityPool_Register(&context, "bullet", test_EntityPool_Create, NULL, calls, 0, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_ENGINE_ENTITY_POOL_ALREADY_REGISTERED, errorCode);
+
+    // Acquire a parked entity, no new entity is built
+    CE_Id bullet = CE_INVALID_ID;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_EntityPool_Acquire(&context, "bullet", &bullet, &errorCode));
+    TEST_ASSERT_EQUAL_INT(2, calls[0]);
+    TEST_ASSERT_EQUAL_INT(1, calls[1]);
+    TEST_ASSERT_EQUAL_size_t(1, CE_EntityPool_GetParkedCount(&context, "bullet"));
+    TEST_ASSERT_TRUE(CE_Entity_IsActive(&context, bullet));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Scene_AddChild(&context, CE_Scene_GetRootId(&context), bullet, false, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_FindFirstComponent(&context, bullet, CE_CORE_DEBUG_COMPONENT, NULL, (void**)&debugData, &errorCode));
+    debugData->m_testValue = 42;
+
+    // Release parks it again, the caller's id becomes stale
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_EntityPool_Release(&context, "bullet", bullet, &errorCode));
+    TEST_ASSERT_EQUAL_size_t(2, CE_EntityPool_GetParkedCount(&context, "bullet"));
+    TEST_ASSERT_FALSE(CE_Entity_IsValid(&context, bullet));
+    TEST_ASSERT_FALSE(CE_Entity_IsActive(&context, bullet));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR, CE_EntityPool_Release(&context, "bullet", bullet, &errorCode));
+
+    // The same slot comes back with a new generation, its child still points to it and the reset hook ran
+    CE_Id recycled = CE_INVALID_ID;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_EntityPool_Acquire(&context, "bullet", &recycled, &errorCode));
+    TEST_ASSERT_EQUAL_UINT16(CE_Id_getUniqueId(bullet), CE_Id_getUniqueId(recycled));
+    TEST_ASSERT_NOT_EQUAL_UINT32(bullet, recycled);
+    TEST_ASSERT_EQUAL_INT(2, calls[1]);
+    TEST_ASSERT_FALSE(CE_Entity_HasRelationship(&context, recycled, CE_RELATIONSHIP_PARENT));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_FindFirstComponent(&context, recycled, CE_CORE_DEBUG_COMPONENT, NULL, (void**)&debugData, &errorCode));
+    TEST_ASSERT_EQUAL_UINT8(0, debugData->m_testValue);
+    CE_Id child = CE_INVALID_ID;
+    CE_Id childParent = CE_INVALID_ID;
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_FindFirstRelationship(&context, recycled, CE_RELATIONSHIP_CHILD, &child, &errorCode));
+    TEST_ASSERT_TRUE(CE_Entity_IsActive(&context, child));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_Entity_FindFirstRelationship(&context, child, CE_RELATIONSHIP_PARENT, &childParent, &errorCode));
+    TEST_ASSERT_EQUAL_UINT32(recycled, childParent);
+
+    // Draining the pool builds new entities
+    CE_Id extra[2] = { CE_INVALID_ID, CE_INVALID_ID };
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_EntityPool_Acquire(&context, "bullet", &extra[0], &errorCode));
+    TEST_ASSERT_EQUAL_INT(2, calls[0]);
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_EntityPool_Acquire(&context, "bullet", &extra[1], &errorCode));
+    TEST_ASSERT_EQUAL_INT(3, calls[0]);
+    TEST_ASSERT_EQUAL_size_t(0, CE_EntityPool_GetParkedCount(&context, "bullet"));
+
+    // Unregistering destroys parked entities only
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_EntityPool_Release(&context, "bullet", extra[0], &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_OK, CE_EntityPool_Unregister(&context, "bullet", &errorCode));
+    TEST_ASSERT_TRUE(CE_Entity_IsActive(&context, recycled));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR, CE_EntityPool_Acquire(&context, "bullet", &bullet, &errorCode));
+    TEST_ASSERT_EQUAL_INT(CE_ERROR_CODE_ENGINE_ENTITY_POOL_NOT_FOUND, errorCode);
+}
+
 int main(void) {
     UNITY_BEGIN();
     RUN_TEST(test_CE_Id_Helpers);
@@ -1455,25 +3079,54 @@ int main(void) {
     RUN_TEST(test_CE_Bitset_IsBitSet);
     RUN_TEST(test_CE_Bitset_ByteBoundaries);
     RUN_TEST(test_CE_Bitset_AllBits);
+    RUN_TEST(test_CE_Bitset_FindFirstClear);
     RUN_TEST(test_CE_EntityConstruction);
 
     RUN_TEST(test_ECS_ContextSetup);
     RUN_TEST(test_ECS_ComponentStorage);
     RUN_TEST(test_ECS_Relationships);
     RUN_TEST(test_ECS_Clean_Relationships);
+    RUN_TEST(test_ECS_RelationshipTargets);
+    RUN_TEST(test_ECS_OneWayRelationships);
+    RUN_TEST(test_ECS_OneWayRelationshipSystem);
     
     RUN_TEST(test_Entity_ComponentCreation);
     RUN_TEST(test_Entity_ComponentDeletion);
     RUN_TEST(test_Entity_Deletion);
+    RUN_TEST(test_Entity_SubtreeDeletion);
     RUN_TEST(test_Entity_MultipleComponents);
+    RUN_TEST(test_Entity_BulkCreation);
 
     RUN_TEST(test_ECS_tick);
     RUN_TEST(test_ECS_GlobalComponents);
+    RUN_TEST(test_ECS_SwapEntities);
+    RUN_TEST(test_Scene_FailedBackgroundLoad);
     RUN_TEST(test_ECS_DebugSystems);
     RUN_TEST(test_ECS_NoStorageSystemTick);
     RUN_TEST(test_ECS_NoStorageSystemFiltersEntities);
 
     RUN_TEST(test_SceneGraph);
+    RUN_TEST(test_SceneGraph_Hierarchy);
+    RUN_TEST(test_SceneGraph_DirtyPropagation);
+    RUN_TEST(test_SceneGraph_RenderQueue);
+    RUN_TEST(test_SceneGraph_Culling);
+    RUN_TEST(test_SceneGraph_SpatialHash);
+    RUN_TEST(test_TransformKernel);
+    RUN_TEST(test_FrameArena);
+    RUN_TEST(test_RenderCommands);
+    RUN_TEST(test_DirtyRegion);
+    RUN_TEST(test_SceneGraph_StaticLayer);
+    RUN_TEST(test_DirtyRegion_Scroll);
+    RUN_TEST(test_TextLabel_Cache);
+    RUN_TEST(test_TextLabel_InlineText);
+    RUN_TEST(test_SpriteAnimation);
+    RUN_TEST(test_BitmapCache);
+    RUN_TEST(test_Tilemap);
+    RUN_TEST(test_Tilemap_StaticLayer);
+    RUN_TEST(test_ParticleEmitter);
+    RUN_TEST(test_ParticleEmitter_Culling);
+    RUN_TEST(test_Prefab_Instantiate);
+    RUN_TEST(test_EntityPool);
 
     return UNITY_END();
 }
@@ -61,6 +61,30 @@ CE_Result CE_Bitset_clear(INOUT CE_Bitset* bitset)
     return CE_OK;
 }
 
+size_t CE_Bitset_findFirstClear(IN const CE_Bitset* bitset, IN size_t start)
+{
+    const size_t bitsPerWord = sizeof(CE_BITSET_STORAGE_TYPE) * 8;
+    const size_t wordCount = (bitset->m_size + bitsPerWord - 1) / bitsPerWord;
+
+    if (start >= bitset->m_size) {
+        return bitset->m_size;
+    }
+
+    // Ignore the bits below start on the first word
+    size_t word = start / bitsPerWord;
+    CE_BITSET_STORAGE_TYPE candidates = ~bitset->m_bits[word] & (~(CE_BITSET_STORAGE_TYPE)0 << (start % bitsPerWord));
+    while (candidates == 0) {
+        if (++word >= wordCount) {
+            return bitset->m_size;
+        }
+        candidates = ~bitset->m_bits[word];
+    }
+
+    // The last word may have clear bits past the end of the bitset
+    const size_t index = word * bitsPerWord + CE_ctz(candidates);
+    return index < bitset->m_size ? index : bitset->m_size;
+}
+
 bool CE_Bitset_containsBits(IN const CE_Bitset* a, IN const CE_Bitset* b)
 {
     if (a->m_size != b->m_size) {
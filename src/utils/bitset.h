@@ -90,6 +90,18 @@ bool CE_Bitset_isBitSet(IN const CE_Bitset* bitset, IN size_t index);
  */
 CE_Result CE_Bitset_clear(INOUT CE_Bitset* bitset);
 
+/**
+ * @brief Find the first cleared bit at or after the given index.
+ * 
+ * Scans a whole storage word at a time, so it is much cheaper than calling CE_Bitset_isBitSet in a loop.
+ * 
+ * @param[in] bitset The bitset to query.
+ * @param[in] start The index to start searching from.
+ * 
+ * @return The index of the first clear bit, or the bitset size if every bit from start onwards is set.
+ */
+size_t CE_Bitset_findFirstClear(IN const CE_Bitset* bitset, IN size_t start);
+
 /**
  * @brief Get the size of the bitset.
  * 
@@ -67,6 +67,15 @@ typedef int CE_Result;
     CE_ERROR_CODE_DESC(ENGINE_SCENE_GRAPH_MISSING_TRANSFORM, 74, "Scene graph entity is missing a transform component") \
     CE_ERROR_CODE_DESC(ENGINE_INPUT_TOO_MANY_ACTION_MAPS, 75, "Too many input mappings, increase CE_ENGINE_INPUT_MAP_STACK_SIZE") \
     CE_ERROR_CODE_DESC(ENGINE_INPUT_NO_ACTION_MAPS, 76, "No input mappings available") \
+    CE_ERROR_CODE_DESC(ENGINE_PREFAB_ALREADY_REGISTERED, 77, "A prefab with this name is already registered") \
+    CE_ERROR_CODE_DESC(ENGINE_PREFAB_NOT_FOUND, 78, "Prefab not found") \
+    CE_ERROR_CODE_DESC(ENGINE_ENTITY_POOL_ALREADY_REGISTERED, 79, "An entity pool with this name is already registered") \
+    CE_ERROR_CODE_DESC(ENGINE_ENTITY_POOL_NOT_FOUND, 80, "Entity pool not found") \
+    CE_ERROR_CODE_DESC(ENGINE_SCENE_LOAD_IN_PROGRESS, 81, "Scene cannot be changed while a load is in progress") \
+    CE_ERROR_CODE_DESC(ENGINE_ANIMATION_TOO_MANY_CLIPS, 82, "Too many animation clips, increase CE_ENGINE_SPRITE_ANIMATION_MAX_CLIPS") \
+    CE_ERROR_CODE_DESC(ENGINE_ANIMATION_INVALID_CLIP, 83, "Animation clip does not exist or has no frames") \
+    CE_ERROR_CODE_DESC(ENGINE_TILEMAP_OUT_OF_BOUNDS, 84, "Tile position is outside of the tilemap") \
+    CE_ERROR_CODE_DESC(ENGINE_PARTICLE_POOL_TOO_LARGE, 85, "Particle pool is larger than CE_ENGINE_PARTICLE_MAX_POOL_SIZE") \
 
     /* Add new error codes here */
 
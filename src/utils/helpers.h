@@ -42,4 +42,11 @@
 	#define CE_popcnt __builtin_popcount
 #endif
 
+// Count trailing zeros, undefined for 0
+#if(_WINDLL)
+	#define CE_ctz _tzcnt_u32
+#else
+	#define CE_ctz __builtin_ctz
+#endif
+
 #endif // CORGO_UTILS_HELPERS_H